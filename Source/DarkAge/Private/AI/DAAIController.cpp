@@ -243,12 +243,9 @@ float ADAAIController::GetMemoryBasedInfluence(EMemoryType MemoryType) const
 	}
 
 	float TotalInfluence = 0.f;
-	for (const FAIMemory& Memory : MemoryComponent->GetMemories())
+	for (const FAIMemory& Memory : MemoryComponent->GetMemoriesByType(MemoryType))
 	{
-		if (Memory.MemoryType == MemoryType)
-		{
-			TotalInfluence += Memory.EmotionalImpact * Memory.MemoryStrength;
-		}
+		TotalInfluence += Memory.EmotionalImpact * Memory.MemoryStrength;
 	}
 	return TotalInfluence;
 }
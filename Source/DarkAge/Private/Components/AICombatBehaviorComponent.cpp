@@ -18,7 +18,7 @@ void UAICombatBehaviorComponent::PerformAttack()
         if (TargetStats)
         {
             // Assuming a base damage of 10 for now
-            TargetStats->UpdateStat(FName("Health"), -10.0f);
+            TargetStats->ModifyHealth(-10.0f);
         }
     }
     else
@@ -38,6 +38,7 @@ UAICombatBehaviorComponent::UAICombatBehaviorComponent()
     PrimaryComponentTick.bCanEverTick = true;
     CombatState = EAICombatState::Idle;
     CurrentTarget = nullptr;
+    TickElision.IdleTickInterval = 0.5f;
 }
 
 void UAICombatBehaviorComponent::BeginPlay()
@@ -45,11 +46,19 @@ void UAICombatBehaviorComponent::BeginPlay()
     Super::BeginPlay();
     CombatState = EAICombatState::Idle;
     CurrentTarget = nullptr;
+    TickElision.Initialize(this, true);
+}
+
+void UAICombatBehaviorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TickElision.Shutdown();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UAICombatBehaviorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    const FDAScopedTickAccounting TickAccounting(this);
     HandleCombatState(DeltaTime);
 }
 
@@ -75,6 +84,7 @@ void UAICombatBehaviorComponent::ClearTarget()
 void UAICombatBehaviorComponent::EnterCombatState(EAICombatState NewState)
 {
     CombatState = NewState;
+    TickElision.SetIdle(NewState == EAICombatState::Idle);
 }
 
 void UAICombatBehaviorComponent::HandleCombatState(float DeltaTime)
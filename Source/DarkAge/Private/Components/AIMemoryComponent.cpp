@@ -9,11 +9,18 @@
 TArray<FAIMemory> UAIMemoryComponent::GetMemoriesByType(EMemoryType MemoryType) const
 {
 	TArray<FAIMemory> Result;
-	for (const FAIMemory& Memory : Memories)
+	const TArray<int32>* Indices = MemoryIndicesByType.Find(MemoryType);
+	if (!Indices)
+	{
+		return Result;
+	}
+
+	const double Now = GetMemoryTime();
+	for (const int32 Index : *Indices)
 	{
-		if (Memory.MemoryType == MemoryType)
+		if (GetCurrentStrength(Memories[Index], Now) > 0.0f)
 		{
-			Result.Add(Memory);
+			Result.Add(MakeMemorySnapshot(Memories[Index], Now));
 		}
 	}
 	return Result;
@@ -23,11 +30,13 @@ TArray<FAIMemory> UAIMemoryComponent::GetMemoriesByType(EMemoryType MemoryType)
 TArray<FAIMemory> UAIMemoryComponent::GetMemoriesByContext(FName ContextKey, FString ContextValue) const
 {
 	TArray<FAIMemory> Result;
+	const double Now = GetMemoryTime();
 	for (const FAIMemory& Memory : Memories)
 	{
-		if (Memory.Context.Contains(ContextKey) && Memory.Context[ContextKey] == ContextValue)
+		const FString* Value = Memory.Context.Find(ContextKey);
+		if (Value && *Value == ContextValue && GetCurrentStrength(Memory, Now) > 0.0f)
 		{
-			Result.Add(Memory);
+			Result.Add(MakeMemorySnapshot(Memory, Now));
 		}
 	}
 	return Result;
@@ -37,7 +46,8 @@ UAIMemoryComponent::UAIMemoryComponent()
 	: FactionManager(nullptr)
 	, GlobalEventBus(nullptr)
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Strength decays lazily and forgotten memories are swept on a timer
+	PrimaryComponentTick.bCanEverTick = false;
 	MemoryDecayRate = 0.1f;
 }
 
@@ -53,43 +63,41 @@ void UAIMemoryComponent::BeginPlay()
 			FactionManager = GameInstance->GetSubsystem<UFactionManagerSubsystem>();
 			GlobalEventBus = GameInstance->GetSubsystem<UGlobalEventBus>();
 		}
+
+		if (UDATimerWheelSubsystem* TimerWheel = World->GetSubsystem<UDATimerWheelSubsystem>())
+		{
+			// Random first delay spreads the sweeps of many NPCs across the interval
+			PruneTimer = TimerWheel->Schedule(this, FMath::FRandRange(0.0f, PruneInterval),
+				[this](FDATimerHandle) { PruneForgottenMemories(); }, PruneInterval);
+		}
 	}
 	
+	// Memories copied in from a template or duplicate arrive without indices
+	RebuildMemoryIndices();
+
 	// Register with event bus
 	RegisterWithEventBus();
 }
 
-void UAIMemoryComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Decay memory strength over time
-	for (FAIMemory& Memory : Memories)
-	{
-		Memory.MemoryStrength -= MemoryDecayRate * DeltaTime;
-	}
-
-	// Remove memories with strength <= 0
-	Memories.RemoveAll([](const FAIMemory& Memory)
-	{
-		return Memory.MemoryStrength <= 0.f;
-	});
-}
-
 void UAIMemoryComponent::AddMemory(const FString& MemoryId, const TMap<FName, FString>& Context, float EmotionalImpact, EMemoryType MemoryType, float InitialStrength)
 {
-	FAIMemory* ExistingMemory = Memories.FindByPredicate([&](const FAIMemory& Memory)
-	{
-		return Memory.MemoryId == MemoryId;
-	});
+	const double Now = GetMemoryTime();
 
-	if (ExistingMemory)
+	if (const int32* ExistingIndex = MemoryIndexById.Find(MemoryId))
 	{
-		ExistingMemory->Context = Context;
-		ExistingMemory->EmotionalImpact = EmotionalImpact;
-		ExistingMemory->MemoryType = MemoryType;
-		ExistingMemory->MemoryStrength = FMath::Max(ExistingMemory->MemoryStrength, InitialStrength);
-		ExistingMemory->Timestamp = FDateTime::UtcNow();
+		FAIMemory& ExistingMemory = Memories[*ExistingIndex];
+		if (ExistingMemory.MemoryType != MemoryType)
+		{
+			MemoryIndicesByType.FindOrAdd(ExistingMemory.MemoryType).RemoveSingleSwap(*ExistingIndex);
+			MemoryIndicesByType.FindOrAdd(MemoryType).Add(*ExistingIndex);
+		}
+
+		ExistingMemory.Context = Context;
+		ExistingMemory.EmotionalImpact = EmotionalImpact;
+		ExistingMemory.MemoryType = MemoryType;
+		ExistingMemory.MemoryStrength = FMath::Max(GetCurrentStrength(ExistingMemory, Now), InitialStrength);
+		ExistingMemory.StrengthTime = Now;
+		ExistingMemory.Timestamp = FDateTime::UtcNow();
 	}
 	else
 	{
@@ -99,49 +107,80 @@ void UAIMemoryComponent::AddMemory(const FString& MemoryId, const TMap<FName, FS
 		NewMemory.EmotionalImpact = EmotionalImpact;
 		NewMemory.MemoryType = MemoryType;
 		NewMemory.MemoryStrength = InitialStrength;
+		NewMemory.StrengthTime = Now;
 		NewMemory.Timestamp = FDateTime::UtcNow();
-		Memories.Add(NewMemory);
+
+		const int32 NewIndex = Memories.Add(MoveTemp(NewMemory));
+		MemoryIndexById.Add(MemoryId, NewIndex);
+		MemoryIndicesByType.FindOrAdd(MemoryType).Add(NewIndex);
 	}
 }
 
 void UAIMemoryComponent::UpdateMemoryStrength(const FString& MemoryId, float StrengthChange)
 {
-	   FAIMemory* MemoryToUpdate = Memories.FindByPredicate([&](const FAIMemory& Memory)
-	   {
-		   return Memory.MemoryId == MemoryId;
-	   });
-
-	   if (MemoryToUpdate)
-	   {
-		   MemoryToUpdate->MemoryStrength += StrengthChange;
-	   }
+	if (const int32* Index = MemoryIndexById.Find(MemoryId))
+	{
+		// Rebase the stored strength on now so decay continues from the adjusted value
+		FAIMemory& MemoryToUpdate = Memories[*Index];
+		const double Now = GetMemoryTime();
+		MemoryToUpdate.MemoryStrength = GetCurrentStrength(MemoryToUpdate, Now) + StrengthChange;
+		MemoryToUpdate.StrengthTime = Now;
+	}
 }
 
 bool UAIMemoryComponent::GetMemory(const FString& MemoryId, FAIMemory& OutMemory) const
 {
-	const FAIMemory* FoundMemory = Memories.FindByPredicate([&](const FAIMemory& Memory)
+	const FAIMemory* FoundMemory = FindMemory(MemoryId);
+	if (!FoundMemory)
 	{
-		return Memory.MemoryId == MemoryId;
-	});
+		return false;
+	}
 
-	if (FoundMemory)
+	const double Now = GetMemoryTime();
+	if (GetCurrentStrength(*FoundMemory, Now) <= 0.0f)
 	{
-		OutMemory = *FoundMemory;
-		return true;
+		// Forgotten, waiting for the next sweep
+		return false;
 	}
 
-	return false;
+	OutMemory = MakeMemorySnapshot(*FoundMemory, Now);
+	return true;
+}
+
+float UAIMemoryComponent::GetMemoryStrength(const FString& MemoryId) const
+{
+	const FAIMemory* FoundMemory = FindMemory(MemoryId);
+	return FoundMemory ? FMath::Max(0.0f, GetCurrentStrength(*FoundMemory, GetMemoryTime())) : 0.0f;
 }
 
 void UAIMemoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UWorld* World = GetWorld())
+	{
+		if (UDATimerWheelSubsystem* TimerWheel = World->GetSubsystem<UDATimerWheelSubsystem>())
+		{
+			TimerWheel->Cancel(PruneTimer);
+		}
+	}
+
 	UnregisterFromEventBus();
 	Super::EndPlay(EndPlayReason);
 }
 
-const TArray<FAIMemory>& UAIMemoryComponent::GetMemories() const
+TArray<FAIMemory> UAIMemoryComponent::GetMemories() const
 {
-	return Memories;
+	TArray<FAIMemory> Result;
+	Result.Reserve(Memories.Num());
+
+	const double Now = GetMemoryTime();
+	for (const FAIMemory& Memory : Memories)
+	{
+		if (GetCurrentStrength(Memory, Now) > 0.0f)
+		{
+			Result.Add(MakeMemorySnapshot(Memory, Now));
+		}
+	}
+	return Result;
 }
 
 TArray<EGlobalEventType> UAIMemoryComponent::GetListenedEventTypes() const
@@ -226,16 +265,21 @@ void UAIMemoryComponent::AddFactionMemory(FName FactionID, const FString& EventD
 TArray<FAIMemory> UAIMemoryComponent::GetFactionMemories(FName FactionID) const
 {
 	TArray<FAIMemory> FactionMemories;
-	
-	for (const FAIMemory& Memory : Memories)
+	const TArray<int32>* FactionIndices = MemoryIndicesByType.Find(EMemoryType::Faction);
+	if (!FactionIndices)
 	{
-		if (Memory.MemoryType == EMemoryType::Faction)
+		return FactionMemories;
+	}
+
+	const FString FactionString = FactionID.ToString();
+	const double Now = GetMemoryTime();
+	for (const int32 Index : *FactionIndices)
+	{
+		const FAIMemory& Memory = Memories[Index];
+		const FString* MemoryFaction = Memory.Context.Find(TEXT("FactionID"));
+		if (MemoryFaction && *MemoryFaction == FactionString && GetCurrentStrength(Memory, Now) > 0.0f)
 		{
-			if (Memory.Context.Contains(TEXT("FactionID")) &&
-				Memory.Context[TEXT("FactionID")] == FactionID.ToString())
-			{
-				FactionMemories.Add(Memory);
-			}
+			FactionMemories.Add(MakeMemorySnapshot(Memory, Now));
 		}
 	}
 	
@@ -251,9 +295,15 @@ TArray<FAIMemory> UAIMemoryComponent::GetFactionMemories(FName FactionID) const
 bool UAIMemoryComponent::RemembersPlayerAction(FName PlayerID, const FString& ActionType, float MaxAge) const
 {
 	FDateTime CurrentTime = FDateTime::UtcNow();
+	const double Now = GetMemoryTime();
 	
 	for (const FAIMemory& Memory : Memories)
 	{
+		if (GetCurrentStrength(Memory, Now) <= 0.0f)
+		{
+			continue; // Forgotten
+		}
+
 		// Check if this memory involves the specified player
 		if (Memory.Context.Contains(TEXT("PlayerID")) &&
 			Memory.Context[TEXT("PlayerID")] == PlayerID.ToString())
@@ -318,4 +368,58 @@ FString UAIMemoryComponent::GenerateFactionMemoryID(FName FactionID, const FStri
 		*FactionID.ToString(),
 		*EventType,
 		FMath::RandRange(1000, 9999));
-}
\ No newline at end of file
+}
+
+double UAIMemoryComponent::GetMemoryTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UAIMemoryComponent::GetCurrentStrength(const FAIMemory& Memory, double Now) const
+{
+	return Memory.MemoryStrength - MemoryDecayRate * (float)FMath::Max(0.0, Now - Memory.StrengthTime);
+}
+
+FAIMemory UAIMemoryComponent::MakeMemorySnapshot(const FAIMemory& Memory, double Now) const
+{
+	FAIMemory Snapshot = Memory;
+	Snapshot.MemoryStrength = GetCurrentStrength(Memory, Now);
+	Snapshot.StrengthTime = Now;
+	return Snapshot;
+}
+
+const FAIMemory* UAIMemoryComponent::FindMemory(const FString& MemoryId) const
+{
+	const int32* Index = MemoryIndexById.Find(MemoryId);
+	return Index ? &Memories[*Index] : nullptr;
+}
+
+void UAIMemoryComponent::PruneForgottenMemories()
+{
+	const double Now = GetMemoryTime();
+	const int32 RemovedCount = Memories.RemoveAll([this, Now](const FAIMemory& Memory)
+	{
+		return GetCurrentStrength(Memory, Now) <= 0.0f;
+	});
+
+	if (RemovedCount > 0)
+	{
+		RebuildMemoryIndices();
+	}
+}
+
+void UAIMemoryComponent::RebuildMemoryIndices()
+{
+	MemoryIndexById.Reset();
+	for (TPair<EMemoryType, TArray<int32>>& TypeIndices : MemoryIndicesByType)
+	{
+		TypeIndices.Value.Reset();
+	}
+
+	for (int32 Index = 0; Index < Memories.Num(); ++Index)
+	{
+		MemoryIndexById.Add(Memories[Index].MemoryId, Index);
+		MemoryIndicesByType.FindOrAdd(Memories[Index].MemoryType).Add(Index);
+	}
+}
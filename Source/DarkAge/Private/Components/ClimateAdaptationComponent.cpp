@@ -11,7 +11,7 @@ void UClimateAdaptationComponent::OnRep_Adaptation()
 // RepNotify for CurrentClimate
 void UClimateAdaptationComponent::OnRep_CurrentClimate()
 {
-    // Optionally broadcast an event or update UI
+    TickElision.Wake();
 }
 
 // Server RPC for updating adaptation
@@ -36,17 +36,37 @@ void UClimateAdaptationComponent::GetLifetimeReplicatedProps(TArray<FLifetimePro
 UClimateAdaptationComponent::UClimateAdaptationComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
+    TickElision.ActiveTickInterval = 0.5f;
 }
 
 void UClimateAdaptationComponent::BeginPlay()
 {
     Super::BeginPlay();
+    TickElision.Initialize(this);
+}
+
+void UClimateAdaptationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TickElision.Shutdown();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UClimateAdaptationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    const FDAScopedTickAccounting TickAccounting(this);
+
     UpdateAdaptation(DeltaTime);
+    TickElision.SetIdle(GetAdaptationLevel(CurrentClimate) >= 1.0f);
+}
+
+void UClimateAdaptationComponent::SetCurrentClimate(EClimateType NewClimate)
+{
+    if (CurrentClimate != NewClimate)
+    {
+        CurrentClimate = NewClimate;
+        TickElision.Wake();
+    }
 }
 
 
@@ -77,7 +97,7 @@ void UClimateAdaptationComponent::ApplyClimateEffects()
         UStatlineComponent* Statline = GetOwner()->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            Statline->UpdateStat(FName(TEXT("Stamina")), -5.0f);
+            Statline->ModifyStamina(-5.0f);
         }
     }
     else if (AdaptLevel > 0.7f)
@@ -85,7 +105,7 @@ void UClimateAdaptationComponent::ApplyClimateEffects()
         UStatlineComponent* Statline = GetOwner()->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            Statline->UpdateStat(FName(TEXT("Stamina")), 2.0f);
+            Statline->ModifyStamina(2.0f);
         }
     }
 }
@@ -2,6 +2,7 @@
 #include "Components/InventoryComponent.h"
 #include "Components/PlayerSkillsComponent.h"
 #include "Core/DAGameInstance.h"
+#include "Core/CraftingRecipeDatabase.h"
 #include "Data/CraftingData.h"
 #include "Data/InventoryData.h"
 #include "GameFramework/Actor.h"
@@ -13,7 +14,7 @@ UCraftingComponent::UCraftingComponent()
     PrimaryComponentTick.bCanEverTick = false;
     OwningInventoryComponent = nullptr;
     GameInstance = nullptr;
-    LoadedCraftingRecipesDataTable = nullptr;
+    RecipeDatabase = nullptr;
     OwningSkillsComponent = nullptr;
 }
 
@@ -50,49 +51,118 @@ void UCraftingComponent::BeginPlay()
         }
     }
 
+    if (OwningInventoryComponent)
+    {
+        OwningInventoryComponent->OnInventoryUpdated.AddDynamic(this, &UCraftingComponent::HandleInventoryUpdated);
+    }
+    if (OwningSkillsComponent)
+    {
+        OwningSkillsComponent->OnSkillLeveledUp_Event.AddDynamic(this, &UCraftingComponent::HandleSkillLeveledUp);
+    }
+
+    if (GameInstance)
+    {
+        RecipeDatabase = GameInstance->GetSubsystem<UCraftingRecipeDatabase>();
+    }
+
     if (CraftingRecipesDataTablePtr.IsNull())
     {
         UE_LOG(LogTemp, Warning, TEXT("CraftingComponent: CraftingRecipesDataTablePtr is not set in Blueprint Defaults for %s."), *GetNameSafe(GetOwner()));
-        LoadedCraftingRecipesDataTable = nullptr;
     }
-    else
+
+    if (RecipeDatabase)
     {
-        LoadedCraftingRecipesDataTable = CraftingRecipesDataTablePtr.LoadSynchronous();
-        if (!LoadedCraftingRecipesDataTable)
+        // The database streams the table in once for every crafter, so a crafter without its own
+        // table still uses the one another crafter requested; until then no recipe is craftable
+        if (!CraftingRecipesDataTablePtr.IsNull())
+        {
+            RecipeDatabase->RequestLoad(CraftingRecipesDataTablePtr);
+        }
+        if (RecipeDatabase->IsLoaded())
         {
-            UE_LOG(LogTemp, Error, TEXT("CraftingComponent: Failed to load CraftingRecipesDataTable from path: %s"), *CraftingRecipesDataTablePtr.ToSoftObjectPath().ToString());
+            RefreshAllRecipes();
         }
         else
         {
-            UE_LOG(LogTemp, Log, TEXT("CraftingComponent: CraftingRecipesDataTable '%s' loaded successfully."), *LoadedCraftingRecipesDataTable->GetName());
+            RecipeDatabase->OnRecipesLoaded.AddDynamic(this, &UCraftingComponent::HandleRecipesLoaded);
         }
     }
 }
 
-bool UCraftingComponent::GetRecipeData(FName RecipeID, FCraftingRecipe& OutRecipeData) const
+void UCraftingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    if (!LoadedCraftingRecipesDataTable)
+    if (OwningInventoryComponent)
     {
-        UE_LOG(LogTemp, Warning, TEXT("GetRecipeData: LoadedCraftingRecipesDataTable is NULL."));
-        return false;
+        OwningInventoryComponent->OnInventoryUpdated.RemoveDynamic(this, &UCraftingComponent::HandleInventoryUpdated);
+    }
+    if (OwningSkillsComponent)
+    {
+        OwningSkillsComponent->OnSkillLeveledUp_Event.RemoveDynamic(this, &UCraftingComponent::HandleSkillLeveledUp);
+    }
+    if (RecipeDatabase)
+    {
+        RecipeDatabase->OnRecipesLoaded.RemoveDynamic(this, &UCraftingComponent::HandleRecipesLoaded);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+const FCraftingRecipe* UCraftingComponent::GetRecipeData(FName RecipeID) const
+{
+    if (!RecipeDatabase || !RecipeDatabase->IsLoaded())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GetRecipeData: Crafting recipes are not loaded yet."));
+        return nullptr;
     }
     if (RecipeID == NAME_None)
     {
         UE_LOG(LogTemp, Warning, TEXT("GetRecipeData: RecipeID is NAME_None."));
-        return false;
+        return nullptr;
     }
 
-    FString ContextString(TEXT("Getting Crafting Recipe Data"));
-    FCraftingRecipe* Row = LoadedCraftingRecipesDataTable->FindRow<FCraftingRecipe>(RecipeID, ContextString);
+    const int32 RecipeIndex = RecipeDatabase->FindRecipe(RecipeID);
+    if (RecipeIndex != INDEX_NONE)
+    {
+        return &RecipeDatabase->GetRecipe(RecipeIndex);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("GetRecipeData: RecipeID '%s' not found in CraftingRecipesDataTable '%s'."), *RecipeID.ToString(), *CraftingRecipesDataTablePtr.ToSoftObjectPath().ToString());
+    return nullptr;
+}
 
-    if (Row)
+bool UCraftingComponent::MeetsRecipeRequirements(int32 RecipeIndex) const
+{
+    const FCraftingRecipe& RecipeData = RecipeDatabase->GetRecipe(RecipeIndex);
+
+    // Check Skill Requirements
+    if (RecipeData.RequiredSkillID != NAME_None)
     {
-        OutRecipeData = *Row;
-        return true;
+        if (!OwningSkillsComponent)
+        {
+            return false; // Skill is required but component is missing
+        }
+        if (OwningSkillsComponent->GetSkillLevel(RecipeData.RequiredSkillID) < RecipeData.RequiredSkillLevel)
+        {
+            return false; // Skill level too low
+        }
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("GetRecipeData: RecipeID '%s' not found in CraftingRecipesDataTable '%s'."), *RecipeID.ToString(), *GetNameSafe(LoadedCraftingRecipesDataTable));
-    return false;
+    // Check Ingredient Requirements
+    for (const FCraftingIngredient& Ingredient : RecipeDatabase->GetIngredients(RecipeIndex))
+    {
+        if (Ingredient.ItemID == NAME_None || Ingredient.Quantity <= 0)
+        {
+            return false; // Reported once when the database is built
+        }
+        FItemData ItemData;
+        ItemData.ItemID = Ingredient.ItemID;
+        if (!OwningInventoryComponent->HasItem(ItemData, Ingredient.Quantity))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 bool UCraftingComponent::CanCraftRecipe(FName RecipeID) const
@@ -108,45 +178,143 @@ bool UCraftingComponent::CanCraftRecipe(FName RecipeID) const
         return false;
     }
 
-    FCraftingRecipe RecipeData;
-    if (!GetRecipeData(RecipeID, RecipeData))
+    if (!GetRecipeData(RecipeID))
     {
         return false;
     }
 
-    // Check Skill Requirements
-    if (RecipeData.RequiredSkillID != NAME_None)
+    return MeetsRecipeRequirements(RecipeDatabase->FindRecipe(RecipeID));
+}
+
+TArray<FName> UCraftingComponent::GetCraftableRecipes() const
+{
+    TArray<FName> Result;
+    if (!RecipeDatabase)
     {
-        if (OwningSkillsComponent)
+        return Result;
+    }
+
+    for (TConstSetBitIterator<> It(CraftableRecipes); It; ++It)
+    {
+        Result.Add(RecipeDatabase->GetRecipeID(It.GetIndex()));
+    }
+    return Result;
+}
+
+void UCraftingComponent::HandleRecipesLoaded()
+{
+    RecipeDatabase->OnRecipesLoaded.RemoveDynamic(this, &UCraftingComponent::HandleRecipesLoaded);
+    RefreshAllRecipes();
+}
+
+void UCraftingComponent::HandleInventoryUpdated()
+{
+    if (!HasRecipeState() || !OwningInventoryComponent)
+    {
+        return;
+    }
+
+    // The inventory does not say what changed, so diff the largest ingredient stacks and
+    // recheck only the recipes that use an ingredient whose stack moved
+    GatherIngredientQuantities(ScratchQuantities);
+
+    auto MarkRecipesUsing = [this](FName ItemID)
+    {
+        for (const int32 RecipeIndex : RecipeDatabase->GetRecipesUsingIngredient(ItemID))
         {
-            if (OwningSkillsComponent->GetSkillLevel(RecipeData.RequiredSkillID) < RecipeData.RequiredSkillLevel)
-            {
-                return false; // Skill level too low
-            }
+            DirtyRecipes[RecipeIndex] = true;
         }
-        else
+    };
+
+    for (const TPair<FName, int32>& Held : ScratchQuantities)
+    {
+        if (IngredientQuantities.FindRef(Held.Key) != Held.Value)
         {
-            return false; // Skill is required but component is missing
+            MarkRecipesUsing(Held.Key);
         }
     }
-
-    // Check Ingredient Requirements
-    for (const FCraftingIngredient& Ingredient : RecipeData.Ingredients)
+    for (const TPair<FName, int32>& Previous : IngredientQuantities)
     {
-        if (Ingredient.ItemID == NAME_None || Ingredient.Quantity <= 0)
+        if (!ScratchQuantities.Contains(Previous.Key))
         {
-            UE_LOG(LogTemp, Warning, TEXT("CanCraftRecipe: Recipe '%s' has invalid ingredient (ItemID None or Quantity <= 0)."), *RecipeID.ToString());
-            return false;
+            MarkRecipesUsing(Previous.Key);
         }
-        FItemData ItemData;
-        ItemData.ItemID = Ingredient.ItemID;
-        if (!OwningInventoryComponent->HasItem(ItemData, Ingredient.Quantity))
+    }
+
+    Swap(IngredientQuantities, ScratchQuantities);
+    RefreshDirtyRecipes();
+}
+
+void UCraftingComponent::HandleSkillLeveledUp(FName SkillID, int32 NewLevel, int32 OldLevel)
+{
+    if (!HasRecipeState())
+    {
+        return;
+    }
+
+    for (const int32 RecipeIndex : RecipeDatabase->GetRecipesForSkill(SkillID))
+    {
+        DirtyRecipes[RecipeIndex] = true;
+    }
+    RefreshDirtyRecipes();
+}
+
+void UCraftingComponent::RefreshDirtyRecipes()
+{
+    bool bChanged = false;
+    if (OwningInventoryComponent)
+    {
+        for (TConstSetBitIterator<> It(DirtyRecipes); It; ++It)
         {
-            return false;
+            const int32 RecipeIndex = It.GetIndex();
+            const bool bCraftable = MeetsRecipeRequirements(RecipeIndex);
+            if (CraftableRecipes[RecipeIndex] != bCraftable)
+            {
+                CraftableRecipes[RecipeIndex] = bCraftable;
+                bChanged = true;
+            }
         }
     }
+    DirtyRecipes.Init(false, CraftableRecipes.Num());
 
-    return true;
+    if (bChanged)
+    {
+        OnCraftableRecipesChanged.Broadcast();
+    }
+}
+
+void UCraftingComponent::RefreshAllRecipes()
+{
+    const int32 NumRecipes = RecipeDatabase->GetNumRecipes();
+    CraftableRecipes.Init(false, NumRecipes);
+    DirtyRecipes.Init(true, NumRecipes);
+
+    GatherIngredientQuantities(IngredientQuantities);
+    RefreshDirtyRecipes();
+}
+
+bool UCraftingComponent::HasRecipeState() const
+{
+    return RecipeDatabase && RecipeDatabase->IsLoaded() && CraftableRecipes.Num() == RecipeDatabase->GetNumRecipes();
+}
+
+void UCraftingComponent::GatherIngredientQuantities(TMap<FName, int32>& OutQuantities) const
+{
+    OutQuantities.Reset();
+    if (!OwningInventoryComponent)
+    {
+        return;
+    }
+
+    // UInventoryComponent::HasItem needs the whole quantity in one slot, so the largest stack decides
+    for (const FInventorySlot& Slot : OwningInventoryComponent->Items)
+    {
+        if (RecipeDatabase->IsIngredient(Slot.Item.ItemID))
+        {
+            int32& Largest = OutQuantities.FindOrAdd(Slot.Item.ItemID, 0);
+            Largest = FMath::Max(Largest, Slot.Quantity);
+        }
+    }
 }
 
 bool UCraftingComponent::AttemptCraftRecipe(FName RecipeID)
@@ -169,8 +337,7 @@ bool UCraftingComponent::AttemptCraftRecipe(FName RecipeID)
         return false;
     }
 
-    FCraftingRecipe RecipeData;
-    GetRecipeData(RecipeID, RecipeData); // We know this will succeed because CanCraftRecipe passed
+    const FCraftingRecipe& RecipeData = *GetRecipeData(RecipeID); // We know this will succeed because CanCraftRecipe passed
 
     FItemData OutputItemInfo;
     if (RecipeData.OutputItemID == NAME_None || !GameInstance->GetItemData(RecipeData.OutputItemID, OutputItemInfo) || RecipeData.OutputQuantity <= 0)
@@ -184,7 +351,7 @@ bool UCraftingComponent::AttemptCraftRecipe(FName RecipeID)
     {
         FItemData ItemData;
         ItemData.ItemID = Ingredient.ItemID;
-        OwningInventoryComponent->RemoveItem(ItemData, Ingredient.Quantity);
+        if (!OwningInventoryComponent->RemoveItem(ItemData, Ingredient.Quantity))
         {
             UE_LOG(LogTemp, Error, TEXT("AttemptCraftRecipe: CRITICAL - Failed to remove ingredient '%s' after CanCraftRecipe passed."), *Ingredient.ItemID.ToString());
             // NOTE: This case should ideally trigger a rollback of previously removed items.
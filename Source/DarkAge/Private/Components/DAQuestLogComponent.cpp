@@ -5,8 +5,22 @@
 #include "CoreMinimal.h"
 #include "Net/UnrealNetwork.h"
 // RepNotify for QuestLog
-void UDAQuestLogComponent::OnRep_QuestLog()
+void UDAQuestLogComponent::OnRep_QuestLog(const TArray<FQuestLogEntry>& OldQuestLog)
 {
+    BroadcastQuestLogReplaced(OldQuestLog);
+}
+
+void UDAQuestLogComponent::BroadcastQuestLogReplaced(const TArray<FQuestLogEntry>& OldQuestLog)
+{
+    // Quests that left the log are not started again, so listeners tracking availability see them
+    for (const FQuestLogEntry& OldEntry : OldQuestLog)
+    {
+        if (!QuestLog.ContainsByPredicate([&](const FQuestLogEntry& InEntry){ return InEntry.QuestID == OldEntry.QuestID; }))
+        {
+            OnQuestStateChanged.Broadcast(OldEntry.QuestID, EQuestState::QS_NotStarted);
+        }
+    }
+
     // Broadcast quest state changed for all quests
     for (const auto& Entry : QuestLog)
     {
@@ -136,7 +150,9 @@ TArray<FQuestLogEntry> UDAQuestLogComponent::GetActiveQuests() const
 
 void UDAQuestLogComponent::SetQuestLog(const TArray<FQuestLogEntry>& InQuestLog)
 {
+    const TArray<FQuestLogEntry> OldQuestLog = QuestLog;
     QuestLog = InQuestLog;
+    BroadcastQuestLogReplaced(OldQuestLog);
 }
 
 const TArray<FQuestLogEntry>& UDAQuestLogComponent::GetQuestLog() const
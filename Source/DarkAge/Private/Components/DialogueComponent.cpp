@@ -2,14 +2,19 @@
 #include "GameFramework/Actor.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "BaseClass/DAPlayerCharacter.h"
 #include "Data/NPCPersonalityData.h"
+#include "Characters/DABaseNPC.h"
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+#include "Core/DynamicQuestSubsystem.h"
 
 UDialogueComponent::UDialogueComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
     bIsInDialogue = false;
     DialoguePartner = nullptr;
+    PartnerConditions.Reset();
     CurrentLineIndex = 0;
     DefaultTreeID = TEXT("Default");
 }
@@ -18,8 +23,8 @@ void UDialogueComponent::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Initialize default dialogue trees
-    InitializeDefaultTrees();
+    // Compile any trees authored on this NPC; the default tree is shared by the registry
+    RegisterAuthoredTrees();
 }
 
 void UDialogueComponent::StartDialogue(AActor* Initiator, const FString& TreeID)
@@ -30,25 +35,37 @@ void UDialogueComponent::StartDialogue(AActor* Initiator, const FString& TreeID)
     }
 
     DialoguePartner = Initiator;
+    PartnerConditions.Bind(Initiator);
     CurrentTreeID = TreeID.IsEmpty() ? DefaultTreeID : TreeID;
     CurrentLineIndex = 0;
     bIsInDialogue = true;
 
     // Get first line
-    FDialogueTree* Tree = GetCurrentTree();
-    if (Tree && Tree->Lines.Num() > 0)
+    if (EnterTree(CurrentTreeID))
     {
-        SetCurrentLine(Tree->Lines[0]);
+        ShowCurrentTreeLine();
     }
     else
     {
         // Generate dynamic greeting if no tree exists
-        FDialogueLine Greeting = GenerateGreeting(GetOwner());
-        SetCurrentLine(Greeting);
+        BuildGreeting(GetOwner(), CurrentLine);
+        OnLineChanged.Broadcast(CurrentLine);
     }
 
     OnDialogueStarted.Broadcast(Initiator);
 
+    // Talking to this NPC advances the player's talk-to objectives
+    const APawn* InitiatorPawn = Cast<APawn>(Initiator);
+    if (InitiatorPawn && InitiatorPawn->IsPlayerControlled())
+    {
+        if (UQuestObjectiveTrackerSubsystem* Tracker = UQuestObjectiveTrackerSubsystem::Get(this))
+        {
+            const ADABaseNPC* NPC = Cast<ADABaseNPC>(GetOwner());
+            const FName Speaker = NPC && !NPC->NPC_ID.IsNone() ? NPC->NPC_ID : GetOwner()->GetFName();
+            Tracker->ReportObjectiveEvent(EObjectiveType::TalkTo, Speaker);
+        }
+    }
+
     UE_LOG(LogTemp, Log, TEXT("Dialogue started between %s and %s"),
         *GetOwner()->GetName(), *Initiator->GetName());
 }
@@ -62,6 +79,7 @@ void UDialogueComponent::EndDialogue()
 
     bIsInDialogue = false;
     DialoguePartner = nullptr;
+    PartnerConditions.Reset();
     CurrentLineIndex = 0;
 
     OnDialogueEnded.Broadcast();
@@ -76,25 +94,21 @@ void UDialogueComponent::SelectResponse(int32 ResponseIndex)
         return;
     }
 
-    FDialogueTree* Tree = GetCurrentTree();
-    if (!Tree || CurrentLineIndex >= Tree->Lines.Num())
+    UDialogueTreeRegistry* Registry = GetRegistry();
+    if (!Registry || CurrentLineIndex >= Registry->GetNumLines(CurrentTree))
     {
         EndDialogue();
         return;
     }
 
-    const FDialogueLine& Line = Tree->Lines[CurrentLineIndex];
-    if (ResponseIndex < 0 || ResponseIndex >= Line.Responses.Num())
+    if (ResponseIndex < 0 || ResponseIndex >= Registry->GetNumResponses(CurrentTree, CurrentLineIndex))
     {
         EndDialogue();
         return;
     }
 
-    // Process response and move to next line or end dialogue
-    FString Response = Line.Responses[ResponseIndex];
-
     // Check for special responses
-    if (Response.Contains(TEXT("[END]")))
+    if (Registry->DoesResponseEndDialogue(CurrentTree, CurrentLineIndex, ResponseIndex))
     {
         EndDialogue();
         return;
@@ -102,22 +116,19 @@ void UDialogueComponent::SelectResponse(int32 ResponseIndex)
 
     // Move to next line in tree
     CurrentLineIndex++;
-    if (CurrentLineIndex < Tree->Lines.Num())
+    if (CurrentLineIndex < Registry->GetNumLines(CurrentTree))
     {
-        SetCurrentLine(Tree->Lines[CurrentLineIndex]);
+        ShowCurrentTreeLine();
     }
     else
     {
         // Check conditions for next tree
-        FString NextTreeID = GetNextTreeID(Tree->Conditions);
-        if (!NextTreeID.IsEmpty() && NextTreeID != CurrentTreeID)
+        const FName NextTreeID = GetNextTreeID(Registry->GetBranches(CurrentTree));
+        if (!NextTreeID.IsNone() && NextTreeID != Registry->GetTreeID(CurrentTree))
         {
-            CurrentTreeID = NextTreeID;
-            CurrentLineIndex = 0;
-            Tree = GetCurrentTree();
-            if (Tree && Tree->Lines.Num() > 0)
+            if (EnterTree(NextTreeID.ToString()))
             {
-                SetCurrentLine(Tree->Lines[0]);
+                ShowCurrentTreeLine();
             }
             else
             {
@@ -133,7 +144,15 @@ void UDialogueComponent::SelectResponse(int32 ResponseIndex)
 
 void UDialogueComponent::AddDialogueTree(const FDialogueTree& Tree)
 {
-    DialogueTrees.Add(Tree.TreeID, Tree);
+    if (UDialogueTreeRegistry* Registry = GetRegistry())
+    {
+        LocalTrees.Add(FName(*Tree.TreeID), Registry->RegisterTree(Tree));
+    }
+    else
+    {
+        // Not in a running game yet; compiled at BeginPlay
+        DialogueTrees.Add(Tree.TreeID, Tree);
+    }
 }
 
 void UDialogueComponent::SetDefaultTree(const FString& TreeID)
@@ -144,114 +163,144 @@ void UDialogueComponent::SetDefaultTree(const FString& TreeID)
 FDialogueLine UDialogueComponent::GenerateGreeting(AActor* Speaker)
 {
     FDialogueLine Greeting;
-    Greeting.SpeakerName = Speaker ? Speaker->GetName() : TEXT("Unknown");
-    Greeting.Text = GetPersonalityGreeting();
-    Greeting.Mood = GetPersonalityMood();
-
-    // Add default responses
-    Greeting.Responses.Add(TEXT("Hello!"));
-    Greeting.Responses.Add(TEXT("What can you tell me?"));
-    Greeting.Responses.Add(TEXT("Goodbye. [END]"));
-
+    BuildGreeting(Speaker, Greeting);
     return Greeting;
 }
 
 FDialogueLine UDialogueComponent::GenerateFarewell(AActor* Speaker)
 {
+    static const TArray<FString> FarewellResponses = { TEXT("Goodbye. [END]") };
+
     FDialogueLine Farewell;
     Farewell.SpeakerName = Speaker ? Speaker->GetName() : TEXT("Unknown");
     Farewell.Text = TEXT("Safe travels, friend.");
     Farewell.Mood = EDialogueMood::Friendly;
-
-    Farewell.Responses.Add(TEXT("Goodbye. [END]"));
+    Farewell.Responses = FarewellResponses;
 
     return Farewell;
 }
 
 FDialogueLine UDialogueComponent::GenerateQuestDialogue(const FString& QuestID)
 {
+    static const TArray<FString> QuestResponses = {
+        TEXT("Yes, I'll help."),
+        TEXT("Tell me more."),
+        TEXT("Not right now. [END]")
+    };
+
     FDialogueLine QuestLine;
     QuestLine.SpeakerName = GetOwner()->GetName();
     QuestLine.Text = FString::Printf(TEXT("I have a task for you: %s. Will you help?"), *QuestID);
     QuestLine.Mood = EDialogueMood::Neutral;
-
-    QuestLine.Responses.Add(TEXT("Yes, I'll help."));
-    QuestLine.Responses.Add(TEXT("Tell me more."));
-    QuestLine.Responses.Add(TEXT("Not right now. [END]"));
+    QuestLine.Responses = QuestResponses;
 
     return QuestLine;
 }
 
+void UDialogueComponent::BuildGreeting(AActor* Speaker, FDialogueLine& Line) const
+{
+    static const TArray<FString> GreetingResponses = {
+        TEXT("Hello!"),
+        TEXT("What can you tell me?"),
+        TEXT("Goodbye. [END]")
+    };
+
+    Line.SpeakerName = Speaker ? Speaker->GetName() : TEXT("Unknown");
+    Line.Text = GetPersonalityGreeting();
+    Line.Mood = GetPersonalityMood();
+    Line.Responses = GreetingResponses;
+}
+
 void UDialogueComponent::SetCurrentLine(const FDialogueLine& Line)
 {
     CurrentLine = Line;
     OnLineChanged.Broadcast(Line);
 }
 
-FDialogueTree* UDialogueComponent::GetCurrentTree()
+bool UDialogueComponent::EnterTree(const FString& TreeID)
 {
-    return DialogueTrees.Find(CurrentTreeID);
+    CurrentTreeID = TreeID;
+    CurrentLineIndex = 0;
+    CurrentTree = FindTree(FName(*TreeID));
+
+    const UDialogueTreeRegistry* Registry = GetRegistry();
+    return Registry && Registry->GetNumLines(CurrentTree) > 0;
 }
 
-bool UDialogueComponent::CheckConditions(const TMap<FString, FString>& Conditions) const
+void UDialogueComponent::ShowCurrentTreeLine()
 {
-    // Simple condition checking - can be expanded
-    for (const auto& Condition : Conditions)
+    const UDialogueTreeRegistry* Registry = GetRegistry();
+    if (!Registry)
     {
-        if (Condition.Key == TEXT("HasQuest"))
-        {
-            // Check if player has specific quest
-            // This would integrate with quest system
-            return true; // Placeholder
-        }
-        else if (Condition.Key == TEXT("FactionReputation"))
-        {
-            // Check faction reputation
-            // This would integrate with faction system
-            return true; // Placeholder
-        }
+        return;
     }
 
-    return true;
+    Registry->GetLine(CurrentTree, CurrentLineIndex, CurrentLine);
+    if (CurrentLine.SpeakerName.IsEmpty())
+    {
+        CurrentLine.SpeakerName = GetOwner()->GetName();
+    }
+    OnLineChanged.Broadcast(CurrentLine);
 }
 
-FString UDialogueComponent::GetNextTreeID(const TMap<FString, FString>& Conditions) const
+FDialogueTreeHandle UDialogueComponent::FindTree(FName TreeID) const
 {
-    for (const auto& Condition : Conditions)
+    if (const FDialogueTreeHandle* LocalTree = LocalTrees.Find(TreeID))
     {
-        if (CheckConditions(TMap<FString, FString>{{Condition.Key, TEXT("")}}))
+        return *LocalTree;
+    }
+
+    const UDialogueTreeRegistry* Registry = GetRegistry();
+    return Registry ? Registry->FindSharedTree(TreeID) : FDialogueTreeHandle();
+}
+
+UDialogueTreeRegistry* UDialogueComponent::GetRegistry() const
+{
+    const UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UDialogueTreeRegistry>() : nullptr;
+}
+
+FName UDialogueComponent::GetNextTreeID(TConstArrayView<FDialogueBranch> Branches) const
+{
+    const UDialogueTreeRegistry* Registry = GetRegistry();
+    if (!Registry)
+    {
+        return NAME_None;
+    }
+
+    for (const FDialogueBranch& Branch : Branches)
+    {
+        if (Registry->EvaluateCondition(Branch.Condition, PartnerConditions))
         {
-            return Condition.Value;
+            return Branch.NextTreeID;
         }
     }
 
-    return TEXT("");
+    return NAME_None;
 }
 
-void UDialogueComponent::InitializeDefaultTrees()
+void UDialogueComponent::RegisterAuthoredTrees()
 {
-    // Create default greeting tree
-    FDialogueTree DefaultTree;
-    DefaultTree.TreeID = TEXT("Default");
-
-    FDialogueLine GreetingLine;
-    GreetingLine.SpeakerName = GetOwner()->GetName();
-    GreetingLine.Text = TEXT("Hello there, traveler. What brings you to our humble settlement?");
-    GreetingLine.Mood = EDialogueMood::Neutral;
-    GreetingLine.Responses.Add(TEXT("I'm just exploring."));
-    GreetingLine.Responses.Add(TEXT("I'm looking for work."));
-    GreetingLine.Responses.Add(TEXT("I need directions."));
-    GreetingLine.Responses.Add(TEXT("Goodbye. [END]"));
-
-    DefaultTree.Lines.Add(GreetingLine);
-
-    DialogueTrees.Add(DefaultTree.TreeID, DefaultTree);
+    UDialogueTreeRegistry* Registry = GetRegistry();
+    if (!Registry)
+    {
+        return;
+    }
+
+    for (const TPair<FString, FDialogueTree>& Tree : DialogueTrees)
+    {
+        LocalTrees.Add(FName(*Tree.Key), Registry->RegisterTree(Tree.Value));
+    }
+
+    // The registry holds the content now; NPCs sharing these trees keep only handles
+    DialogueTrees.Empty();
 }
 
-FString UDialogueComponent::GetPersonalityGreeting() const
+const FString& UDialogueComponent::GetPersonalityGreeting() const
 {
     // This would use personality data if available
-    TArray<FString> Greetings = {
+    static const TArray<FString> Greetings = {
         TEXT("Greetings, stranger."),
         TEXT("Well met, traveler."),
         TEXT("Hello there!"),
@@ -280,7 +329,7 @@ FString UDialogueComponent::GetPersonalityResponse(EDialogueMood Mood) const
 EDialogueMood UDialogueComponent::GetPersonalityMood() const
 {
     // This would be based on personality data
-    TArray<EDialogueMood> Moods = {
+    static const TArray<EDialogueMood> Moods = {
         EDialogueMood::Neutral,
         EDialogueMood::Friendly,
         EDialogueMood::Neutral,
@@ -1,13 +1,15 @@
 #include "Components/DiseaseManagementComponent.h"
 #include "Components/StatusEffectComponent.h"
 #include "Components/InventoryComponent.h"
+#include "Survival/DiseaseSystem.h"
 #include "Engine/World.h"
-#include "Engine/OverlapResult.h"
+#include "Engine/GameInstance.h"
 #include "Net/UnrealNetwork.h"
 
 UDiseaseManagementComponent::UDiseaseManagementComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Incubation, stage transitions and detection are scheduled on UDATimerWheelSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UDiseaseManagementComponent::BeginPlay()
@@ -23,24 +25,40 @@ void UDiseaseManagementComponent::BeginPlay()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Disease Data Table not loaded."));
 	}
+
+	// Transmission to and from this actor is evaluated by the disease system's contagion pass
+	if (UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDiseaseSystem* DiseaseSystem = GameInstance->GetSubsystem<UDiseaseSystem>())
+		{
+			DiseaseSystem->RegisterContagionHost(this);
+		}
+	}
 }
 
-void UDiseaseManagementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UDiseaseManagementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	for (int32 i = ActiveDiseases.Num() - 1; i >= 0; --i)
+	if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
 	{
-		FActiveDiseaseInstance& Disease = ActiveDiseases[i];
-		if (Disease.bIsActive)
+		for (FActiveDiseaseInstance& Disease : ActiveDiseases)
 		{
-			UpdateDiseaseProgression(Disease, DeltaTime);
+			TimerWheel->Cancel(Disease.StageTimer);
+			TimerWheel->Cancel(Disease.DetectionTimer);
 		}
-		else
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGameInstance* GameInstance = World->GetGameInstance())
 		{
-			ActiveDiseases.RemoveAt(i);
+			if (UDiseaseSystem* DiseaseSystem = GameInstance->GetSubsystem<UDiseaseSystem>())
+			{
+				DiseaseSystem->UnregisterContagionHost(this);
+			}
 		}
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UDiseaseManagementComponent::Infect(FName DiseaseID)
@@ -67,7 +85,15 @@ void UDiseaseManagementComponent::Infect(FName DiseaseID)
 				NewDisease.ContractionTime = World->GetTimeSeconds();
 			}
 			NewDisease.bIsContagious = DiseaseData->BaseTransmissionRate > 0;
-			ActiveDiseases.Add(NewDisease);
+			NewDisease.DiseaseData = DiseaseData;
+
+			FActiveDiseaseInstance& Disease = ActiveDiseases.Add_GetRef(NewDisease);
+			if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
+			{
+				Disease.StageTimer = TimerWheel->Schedule(this, DiseaseData->IncubationPeriod,
+					[this](FDATimerHandle Timer) { HandleStageTimer(Timer); });
+			}
+			UpdateDetection(Disease);
 			OnDiseasesChanged.Broadcast();
 		}
 	}
@@ -122,9 +148,8 @@ void UDiseaseManagementComponent::TreatDisease(FName DiseaseID, FName TreatmentI
 						{
 							if (Treatment->bCanCureCompletely)
 							{
-								ActiveDiseases[i].bIsActive = false;
 								RemoveDiseaseEffects(DiseaseData, ActiveDiseases[i]);
-								OnDiseasesChanged.Broadcast();
+								RemoveDiseaseAt(i);
 							}
 							else
 							{
@@ -169,69 +194,131 @@ bool UDiseaseManagementComponent::HasImmunity(FName DiseaseID) const
 	return false;
 }
 
-void UDiseaseManagementComponent::UpdateDiseaseProgression(FActiveDiseaseInstance& Disease, float DeltaTime)
+void UDiseaseManagementComponent::HandleStageTimer(FDATimerHandle Timer)
 {
-    static const FString ContextString(TEXT("Disease Data Context"));
-    FDiseaseData* DiseaseData = Disease.DiseaseDataRowHandle.GetRow<FDiseaseData>(ContextString);
+	const int32 Index = ActiveDiseases.IndexOfByPredicate([Timer](const FActiveDiseaseInstance& Disease)
+	{
+		return Disease.StageTimer == Timer;
+	});
 
-    if (!DiseaseData)
-    {
-        return;
-    }
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
 
-    Disease.TotalDiseaseTime += DeltaTime;
+	FActiveDiseaseInstance& Disease = ActiveDiseases[Index];
+	const FDiseaseData* DiseaseData = Disease.DiseaseData;
+	Disease.StageTimer.Invalidate();
 
-    if (Disease.bIsIncubating)
-    {
-        if (Disease.TotalDiseaseTime >= DiseaseData->IncubationPeriod)
-        {
-            Disease.bIsIncubating = false;
-            Disease.TimeInCurrentStage = 0.0f;
-            ApplyDiseaseEffects(DiseaseData, Disease);
-        }
-    }
-    else
-    {
-        Disease.TimeInCurrentStage += DeltaTime;
-        if (DiseaseData->Stages.IsValidIndex(Disease.CurrentStage))
-        {
-            const FDiseaseStage& CurrentStage = DiseaseData->Stages[Disease.CurrentStage];
+	if (!DiseaseData)
+	{
+		return;
+	}
 
-            if (Disease.TimeInCurrentStage >= CurrentStage.Duration && CurrentStage.bCanProgress)
-            {
-                if (Disease.CurrentStage < DiseaseData->Stages.Num() - 1)
-                {
-                    Disease.CurrentStage++;
-                    Disease.TimeInCurrentStage = 0.0f;
-                    ApplyDiseaseEffects(DiseaseData, Disease);
-                }
-                else if (DiseaseData->bIsChronicCondition)
-                {
-                    // Chronic condition remains in the final stage
-                }
-                else
-                {
-                    // Disease has run its course
-                    Disease.bIsActive = false;
-                    RemoveDiseaseEffects(DiseaseData, Disease);
-                    if (DiseaseData->bCanDevelopImmunity)
-                    {
-                        AddImmunity(Disease.DiseaseID, DiseaseData->ImmunityDuration, false);
-                    }
-                }
-            }
-        }
-    }
+	if (UWorld* World = GetWorld())
+	{
+		Disease.TotalDiseaseTime = World->GetTimeSeconds() - Disease.ContractionTime;
+	}
+	Disease.TimeInCurrentStage = 0.0f;
 
-    if (!Disease.bIsDetected)
-    {
-        AttemptToDetectDisease(Disease);
-    }
+	if (Disease.bIsIncubating)
+	{
+		Disease.bIsIncubating = false;
+		ApplyDiseaseEffects(DiseaseData, Disease);
+		EnterStage(Disease);
+	}
+	else if (Disease.CurrentStage < DiseaseData->Stages.Num() - 1)
+	{
+		Disease.CurrentStage++;
+		ApplyDiseaseEffects(DiseaseData, Disease);
+		EnterStage(Disease);
+	}
+	else if (!DiseaseData->bIsChronicCondition)
+	{
+		// Disease has run its course; chronic conditions remain in the final stage
+		RemoveDiseaseEffects(DiseaseData, Disease);
+		if (DiseaseData->bCanDevelopImmunity)
+		{
+			AddImmunity(Disease.DiseaseID, DiseaseData->ImmunityDuration, false);
+		}
+		RemoveDiseaseAt(Index);
+	}
+}
 
-    if (Disease.bIsContagious)
-    {
-        TransmitDisease(Disease);
-    }
+void UDiseaseManagementComponent::HandleDetectionTimer(FDATimerHandle Timer)
+{
+	FActiveDiseaseInstance* Disease = ActiveDiseases.FindByPredicate([Timer](const FActiveDiseaseInstance& InDisease)
+	{
+		return InDisease.DetectionTimer == Timer;
+	});
+
+	if (Disease)
+	{
+		UpdateDetection(*Disease);
+	}
+}
+
+void UDiseaseManagementComponent::EnterStage(FActiveDiseaseInstance& Disease)
+{
+	const FDiseaseData* DiseaseData = Disease.DiseaseData;
+	if (DiseaseData && DiseaseData->Stages.IsValidIndex(Disease.CurrentStage))
+	{
+		const FDiseaseStage& CurrentStage = DiseaseData->Stages[Disease.CurrentStage];
+		UDATimerWheelSubsystem* TimerWheel = GetTimerWheel();
+		if (CurrentStage.bCanProgress && TimerWheel)
+		{
+			Disease.StageTimer = TimerWheel->Schedule(this, CurrentStage.Duration,
+				[this](FDATimerHandle Timer) { HandleStageTimer(Timer); });
+		}
+	}
+
+	UpdateDetection(Disease);
+}
+
+void UDiseaseManagementComponent::UpdateDetection(FActiveDiseaseInstance& Disease)
+{
+	if (!Disease.bIsDetected)
+	{
+		AttemptToDetectDisease(Disease);
+	}
+
+	const FDiseaseData* DiseaseData = Disease.DiseaseData;
+	const bool bKeepRolling = !Disease.bIsDetected && DiseaseData && DiseaseData->Stages.IsValidIndex(Disease.CurrentStage)
+		&& DiseaseData->Stages[Disease.CurrentStage].bCanBeDetected;
+
+	UDATimerWheelSubsystem* TimerWheel = GetTimerWheel();
+	if (!TimerWheel)
+	{
+		return;
+	}
+
+	if (!bKeepRolling)
+	{
+		TimerWheel->Cancel(Disease.DetectionTimer);
+	}
+	else if (!Disease.DetectionTimer.IsValid())
+	{
+		Disease.DetectionTimer = TimerWheel->Schedule(this, DETECTION_INTERVAL,
+			[this](FDATimerHandle Timer) { HandleDetectionTimer(Timer); }, DETECTION_INTERVAL);
+	}
+}
+
+void UDiseaseManagementComponent::RemoveDiseaseAt(int32 Index)
+{
+	if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
+	{
+		TimerWheel->Cancel(ActiveDiseases[Index].StageTimer);
+		TimerWheel->Cancel(ActiveDiseases[Index].DetectionTimer);
+	}
+
+	ActiveDiseases.RemoveAt(Index);
+	OnDiseasesChanged.Broadcast();
+}
+
+UDATimerWheelSubsystem* UDiseaseManagementComponent::GetTimerWheel() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UDATimerWheelSubsystem>() : nullptr;
 }
 
 void UDiseaseManagementComponent::ApplyDiseaseEffects(const FDiseaseData* DiseaseData, FActiveDiseaseInstance& ActiveDisease)
@@ -266,8 +353,7 @@ void UDiseaseManagementComponent::RemoveDiseaseEffects(const FDiseaseData* Disea
 
 void UDiseaseManagementComponent::AttemptToDetectDisease(FActiveDiseaseInstance& Disease)
 {
-    static const FString ContextString(TEXT("Disease Data Context"));
-    FDiseaseData* DiseaseData = Disease.DiseaseDataRowHandle.GetRow<FDiseaseData>(ContextString);
+    const FDiseaseData* DiseaseData = Disease.DiseaseData;
     if (DiseaseData && DiseaseData->Stages.IsValidIndex(Disease.CurrentStage))
     {
         const FDiseaseStage& CurrentStage = DiseaseData->Stages[Disease.CurrentStage];
@@ -282,55 +368,6 @@ void UDiseaseManagementComponent::AttemptToDetectDisease(FActiveDiseaseInstance&
     }
 }
 
-void UDiseaseManagementComponent::TransmitDisease(const FActiveDiseaseInstance& Disease)
-{
-    static const FString ContextString(TEXT("Disease Data Context"));
-    FDiseaseData* DiseaseData = Disease.DiseaseDataRowHandle.GetRow<FDiseaseData>(ContextString);
-    if (!DiseaseData || !Disease.bIsContagious || !GetOwner())
-    {
-        return;
-    }
-
-    // A more complex implementation would use different transmission vectors (airborne, contact, etc.)
-    // For now, we'll do a simple proximity check for airborne transmission.
-    TArray<FOverlapResult> Overlaps;
-    FCollisionShape Sphere = FCollisionShape::MakeSphere(DiseaseData->TransmissionRadius);
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(GetOwner());
-
-    if(UWorld* World = GetWorld())
-    {
-        bool bHit = World->OverlapMultiByChannel(
-            Overlaps,
-            GetOwner()->GetActorLocation(),
-            FQuat::Identity,
-            ECC_Pawn,
-            Sphere,
-            QueryParams
-        );
-
-        if (bHit)
-        {
-            for (const FOverlapResult& Hit : Overlaps)
-            {
-                AActor* OtherActor = Hit.GetActor();
-                if (OtherActor && OtherActor != GetOwner())
-                {
-                    UDiseaseManagementComponent* OtherDiseaseComp = OtherActor->FindComponentByClass<UDiseaseManagementComponent>();
-                    if (OtherDiseaseComp)
-                    {
-                        // Add randomness to transmission
-                        if (FMath::FRand() < DiseaseData->BaseTransmissionRate)
-                        {
-                            OtherDiseaseComp->Infect(Disease.DiseaseID);
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
 void UDiseaseManagementComponent::AddImmunity(FName DiseaseID, float Duration, bool bIsPermanent)
 {
 	FDiseaseImmunityRecord NewRecord;
@@ -4,6 +4,9 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Components/StatusEffectComponent.h"
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+#include "Core/DynamicQuestSubsystem.h"
+#include "GameFramework/Pawn.h"
 
 UInventoryComponent::UInventoryComponent()
 {
@@ -42,6 +45,7 @@ bool UInventoryComponent::AddItem(const FItemData& Item, int32 Quantity)
 			{
 				Slot.Quantity += Quantity;
 				OnInventoryUpdated.Broadcast();
+				ReportItemCollected(Item.ItemID, Quantity);
 				return true;
 			}
 		}
@@ -55,12 +59,28 @@ bool UInventoryComponent::AddItem(const FItemData& Item, int32 Quantity)
 		NewSlot.Quantity = Quantity;
 		Items.Add(NewSlot);
 		OnInventoryUpdated.Broadcast();
+		ReportItemCollected(Item.ItemID, Quantity);
 		return true;
 	}
 
 	return false;
 }
 
+void UInventoryComponent::ReportItemCollected(FName ItemID, int32 Quantity) const
+{
+	// Only the player's own pickups count towards collect objectives
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	if (!OwnerPawn || !OwnerPawn->IsPlayerControlled())
+	{
+		return;
+	}
+
+	if (UQuestObjectiveTrackerSubsystem* Tracker = UQuestObjectiveTrackerSubsystem::Get(this))
+	{
+		Tracker->ReportObjectiveEvent(EObjectiveType::Collect, ItemID, Quantity);
+	}
+}
+
 bool UInventoryComponent::RemoveItem(const FItemData& Item, int32 Quantity)
 {
 	if (Quantity <= 0 || Item.ItemID == NAME_None)
@@ -5,9 +5,8 @@
 // Sets default values for this component's properties
 UShelterManagementComponent::UShelterManagementComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-    // off to improve performance if you don't need them.
-    PrimaryComponentTick.bCanEverTick = true;
+    // Nothing to do per frame
+    PrimaryComponentTick.bCanEverTick = false;
 
     // ...
 }
@@ -19,11 +18,3 @@ void UShelterManagementComponent::BeginPlay()
 
     // ...
 }
-
-// Called every frame
-void UShelterManagementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // ...
-}
\ No newline at end of file
@@ -4,10 +4,14 @@
 #include "Components/StatlineComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Core/GlobalEventBus.h"
 
 UStatlineComponent::UStatlineComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	// Status effect expiry and ticks run on UDATimerWheelSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
 }
 
@@ -25,38 +29,25 @@ void UStatlineComponent::BeginPlay()
 		Stats.Add(FStatEntry{FName("Hunger"), FStat(100.0f, 100.0f, EStatCategory::Survival)});
 		Stats.Add(FStatEntry{FName("Thirst"), FStat(100.0f, 100.0f, EStatCategory::Survival)});
 	}
+
+	RebuildStatTable();
 }
 
-void UStatlineComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UStatlineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	ProcessStatusEffects(DeltaTime);
+	for (FActiveStatusEffect& Effect : ActiveStatusEffects)
+	{
+		CancelStatusEffectTimers(Effect);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UStatlineComponent::UpdateStat(FName StatName, float Delta)
 {
 	if (GetOwner()->HasAuthority())
 	{
-		for (FStatEntry& StatEntry : Stats)
-		{
-			if (StatEntry.StatName == StatName)
-			{
-				float OldValue = StatEntry.Stat.CurrentValue;
-				StatEntry.Stat.CurrentValue = FMath::Clamp(StatEntry.Stat.CurrentValue + Delta, 0.0f, StatEntry.Stat.BaseValue);
-
-				if (OldValue != StatEntry.Stat.CurrentValue)
-				{
-					OnStatChanged.Broadcast(StatName, StatEntry.Stat.CurrentValue);
-
-					// Check for death
-					if (StatName == FName("Health") && StatEntry.Stat.CurrentValue <= 0.0f)
-					{
-						OnDeath.Broadcast();
-					}
-				}
-				break;
-			}
-		}
+		UpdateStatByIndex(ResolveStatIndex(StatName), Delta);
 	}
 	else
 	{
@@ -64,96 +55,325 @@ void UStatlineComponent::UpdateStat(FName StatName, float Delta)
 	}
 }
 
-float UStatlineComponent::GetCurrentStatValue(FName StatName) const
+void UStatlineComponent::UpdateStatByIndex(int32 StatIndex, float Delta)
 {
-	for (const FStatEntry& StatEntry : Stats)
+	if (!GetOwner()->HasAuthority())
+	{
+		// Layout indices are per process, so the server is sent the name
+		ServerUpdateStat(FDAStatLayout::Get().GetStatName(StatIndex), Delta);
+		return;
+	}
+
+	FStatEntry* StatEntry = FindStatEntry(StatIndex);
+	if (!StatEntry)
+	{
+		return;
+	}
+
+	const float OldValue = StatEntry->Stat.CurrentValue;
+	StatEntry->Stat.CurrentValue = FMath::Clamp(OldValue + Delta, 0.0f, StatEntry->Stat.BaseValue);
+
+	if (OldValue != StatEntry->Stat.CurrentValue)
 	{
-		if (StatEntry.StatName == StatName)
+		MarkStatChanged(StatIndex, StatEntry->Stat.CurrentValue);
+
+		// Check for death
+		if (StatIndex == FDAStatLayout::Health && StatEntry->Stat.CurrentValue <= 0.0f)
 		{
-			return StatEntry.Stat.CurrentValue;
+			OnDeath.Broadcast();
+			BroadcastNPCDeath();
 		}
 	}
-	return 0.0f;
+}
+
+float UStatlineComponent::GetCurrentStatValue(FName StatName) const
+{
+	return GetCurrentStatValueByIndex(ResolveStatIndex(StatName));
+}
+
+float UStatlineComponent::GetCurrentStatValueByIndex(int32 StatIndex) const
+{
+	const FStatEntry* StatEntry = FindStatEntry(StatIndex);
+	return StatEntry ? StatEntry->Stat.CurrentValue : 0.0f;
 }
 
 float UStatlineComponent::GetBaseStatValue(FName StatName) const
 {
-	for (const FStatEntry& StatEntry : Stats)
+	return GetBaseStatValueByIndex(ResolveStatIndex(StatName));
+}
+
+float UStatlineComponent::GetBaseStatValueByIndex(int32 StatIndex) const
+{
+	const FStatEntry* StatEntry = FindStatEntry(StatIndex);
+	return StatEntry ? StatEntry->Stat.BaseValue : 0.0f;
+}
+
+float UStatlineComponent::GetMaxStatValue(FName StatName) const
+{
+	return GetBaseStatValue(StatName);
+}
+
+float UStatlineComponent::GetStatPercentage(FName StatName) const
+{
+	const FStatEntry* StatEntry = FindStatEntry(ResolveStatIndex(StatName));
+	if (!StatEntry)
+	{
+		return 0.0f;
+	}
+	return StatEntry->Stat.BaseValue > 0.0f ? (StatEntry->Stat.CurrentValue / StatEntry->Stat.BaseValue) : 0.0f;
+}
+
+uint32 UStatlineComponent::GetStatChangeVersion(int32 StatIndex) const
+{
+	return StatSlots.IsValidIndex(StatIndex) ? StatSlots[StatIndex].ChangeVersion : 0;
+}
+
+void UStatlineComponent::GetStatsChangedSince(uint32 SinceVersion, TArray<int32>& OutStatIndices) const
+{
+	OutStatIndices.Reset();
+	for (int32 StatIndex = 0; StatIndex < StatSlots.Num(); ++StatIndex)
 	{
-		if (StatEntry.StatName == StatName)
+		if (StatSlots[StatIndex].Slot != INDEX_NONE && StatSlots[StatIndex].ChangeVersion > SinceVersion)
 		{
-			return StatEntry.Stat.BaseValue;
+			OutStatIndices.Add(StatIndex);
 		}
 	}
-	return 0.0f;
 }
 
-float UStatlineComponent::GetMaxStatValue(FName StatName) const
+void UStatlineComponent::ConsumeDirtyStats(TArray<int32>& OutStatIndices)
 {
-	return GetBaseStatValue(StatName);
+	OutStatIndices.Reset();
+	for (TConstSetBitIterator<> It(DirtyStats); It; ++It)
+	{
+		OutStatIndices.Add(It.GetIndex());
+	}
+	DirtyStats.Init(false, DirtyStats.Num());
 }
 
-float UStatlineComponent::GetStatPercentage(FName StatName) const
+void UStatlineComponent::RebuildStatTable() const
+{
+	// Versions and last notified values survive a rebuild; only slot positions are refreshed
+	FDAStatLayout& Layout = FDAStatLayout::Get();
+	for (FStatSlot& StatSlot : StatSlots)
+	{
+		StatSlot.Slot = INDEX_NONE;
+	}
+
+	for (int32 Slot = 0; Slot < Stats.Num(); ++Slot)
+	{
+		const int32 StatIndex = Layout.RegisterStat(Stats[Slot].StatName);
+		if (StatIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		if (StatIndex >= StatSlots.Num())
+		{
+			StatSlots.SetNum(StatIndex + 1);
+		}
+		StatSlots[StatIndex].Slot = Slot;
+	}
+
+	MappedStatCount = Stats.Num();
+}
+
+int32 UStatlineComponent::ResolveStatIndex(FName StatName) const
+{
+	// Make sure names configured on this component are registered before looking them up
+	EnsureStatTable();
+	return FDAStatLayout::Get().FindStatIndex(StatName);
+}
+
+FStatEntry* UStatlineComponent::FindStatEntry(int32 StatIndex)
 {
-	float Current = GetCurrentStatValue(StatName);
-	float Max = GetMaxStatValue(StatName);
-	return Max > 0.0f ? (Current / Max) : 0.0f;
+	return const_cast<FStatEntry*>(static_cast<const UStatlineComponent*>(this)->FindStatEntry(StatIndex));
+}
+
+const FStatEntry* UStatlineComponent::FindStatEntry(int32 StatIndex) const
+{
+	EnsureStatTable();
+	if (!StatSlots.IsValidIndex(StatIndex) || StatSlots[StatIndex].Slot == INDEX_NONE)
+	{
+		return nullptr;
+	}
+	return &Stats[StatSlots[StatIndex].Slot];
+}
+
+void UStatlineComponent::BroadcastNPCDeath() const
+{
+	const AActor* Owner = GetOwner();
+	const APawn* OwnerPawn = Cast<APawn>(Owner);
+	if (!Owner || (OwnerPawn && OwnerPawn->IsPlayerControlled()))
+	{
+		return;
+	}
+
+	UGlobalEventBus* EventBus = UGlobalEventBus::Get(this);
+	if (!EventBus)
+	{
+		return;
+	}
+
+	// An NPC's first actor tag is its enemy type, which kill objectives are tracked against
+	TMap<FString, FString> EventData;
+	if (Owner->Tags.Num() > 0)
+	{
+		EventData.Add(TEXT("EnemyType"), Owner->Tags[0].ToString());
+	}
+
+	// Immediate, since nothing drains the bus's queue every frame
+	EventBus->BroadcastSimpleEvent(EGlobalEventType::NPCDied, Owner->GetName(), Owner->GetName(), EventData, EEventPriority::Normal, true);
+}
+
+void UStatlineComponent::MarkStatChanged(int32 StatIndex, float NewValue)
+{
+	FStatSlot& StatSlot = StatSlots[StatIndex];
+	StatSlot.ChangeVersion = ++StatVersion;
+	StatSlot.LastNotifiedValue = NewValue;
+
+	if (StatIndex >= DirtyStats.Num())
+	{
+		DirtyStats.Add(false, StatIndex + 1 - DirtyStats.Num());
+	}
+	DirtyStats[StatIndex] = true;
+
+	OnStatChanged.Broadcast(FDAStatLayout::Get().GetStatName(StatIndex), NewValue);
 }
 
 void UStatlineComponent::ApplyStatusEffect(const FDataTableRowHandle& EffectDataRowHandle, UObject* Instigator)
 {
-	// Implementation would depend on your status effect system
-	// For now, just log that it was called
-	UE_LOG(LogTemp, Log, TEXT("ApplyStatusEffect called on %s"), *GetOwner()->GetName());
+	const FStatusEffectData* EffectData = EffectDataRowHandle.GetRow<FStatusEffectData>(TEXT("ApplyStatusEffect"));
+	if (!EffectData)
+	{
+		return;
+	}
+
+	FActiveStatusEffect NewEffect;
+	NewEffect.EffectDataRowHandle = EffectDataRowHandle;
+	NewEffect.EffectData = EffectData;
+	NewEffect.EffectID = EffectData->EffectID;
+	NewEffect.RemainingDuration = EffectData->BaseDuration;
+	if (Instigator)
+	{
+		NewEffect.SourceActorID = Instigator->GetName();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		NewEffect.ApplicationTime = World->GetTimeSeconds();
+		NewEffect.LastTickTime = NewEffect.ApplicationTime;
+
+		if (UDATimerWheelSubsystem* TimerWheel = World->GetSubsystem<UDATimerWheelSubsystem>())
+		{
+			// Same rule as UStatusEffectComponent: instant effects expire on the next step, other effects without a duration persist until removed
+			const bool bExpires = EffectData->BaseDuration > 0.0f || EffectData->ApplicationMethod == EStatusEffectApplication::Instant;
+			if (bExpires)
+			{
+				NewEffect.ExpiryTimer = TimerWheel->Schedule(this, EffectData->BaseDuration,
+					[this](FDATimerHandle Timer) { HandleStatusEffectExpired(Timer); });
+			}
+
+			if (EffectData->TickInterval > 0.0f)
+			{
+				NewEffect.PeriodicTimer = TimerWheel->Schedule(this, EffectData->TickInterval,
+					[this](FDATimerHandle Timer) { HandleStatusEffectTick(Timer); }, EffectData->TickInterval);
+			}
+		}
+	}
+
+	ActiveStatusEffects.Add(NewEffect);
+	OnStatusEffectChanged.Broadcast(NewEffect.EffectID, true);
 }
 
 void UStatlineComponent::RemoveStatusEffect(FName EffectID)
 {
-	// Implementation would depend on your status effect system
-	UE_LOG(LogTemp, Log, TEXT("RemoveStatusEffect called for %s on %s"), *EffectID.ToString(), *GetOwner()->GetName());
+	for (int32 i = 0; i < ActiveStatusEffects.Num(); ++i)
+	{
+		if (ActiveStatusEffects[i].EffectID == EffectID)
+		{
+			CancelStatusEffectTimers(ActiveStatusEffects[i]);
+			ActiveStatusEffects.RemoveAt(i);
+			OnStatusEffectChanged.Broadcast(EffectID, false);
+			return;
+		}
+	}
 }
 
 void UStatlineComponent::RecalculateStat(FName StatName)
 {
 	// Recalculate stat based on base value and modifiers
-	for (FStatEntry& StatEntry : Stats)
+	const int32 StatIndex = ResolveStatIndex(StatName);
+	if (FStatEntry* StatEntry = FindStatEntry(StatIndex))
 	{
-		if (StatEntry.StatName == StatName)
-		{
-			// For now, just ensure current value doesn't exceed base value
-			StatEntry.Stat.CurrentValue = FMath::Min(StatEntry.Stat.CurrentValue, StatEntry.Stat.BaseValue);
-			OnStatChanged.Broadcast(StatName, StatEntry.Stat.CurrentValue);
-			break;
-		}
+		// For now, just ensure current value doesn't exceed base value
+		StatEntry->Stat.CurrentValue = FMath::Min(StatEntry->Stat.CurrentValue, StatEntry->Stat.BaseValue);
+		MarkStatChanged(StatIndex, StatEntry->Stat.CurrentValue);
 	}
 }
 
-void UStatlineComponent::ProcessStatusEffects(float DeltaTime)
+void UStatlineComponent::HandleStatusEffectExpired(FDATimerHandle Timer)
 {
-	// Process active status effects
-	for (int32 i = ActiveStatusEffects.Num() - 1; i >= 0; --i)
+	for (int32 i = 0; i < ActiveStatusEffects.Num(); ++i)
 	{
-		FActiveStatusEffect& Effect = ActiveStatusEffects[i];
-		Effect.RemainingDuration -= DeltaTime;
-
-		if (Effect.RemainingDuration <= 0.0f)
+		if (ActiveStatusEffects[i].ExpiryTimer == Timer)
 		{
-			OnStatusEffectExpired.Broadcast(Effect.EffectID);
+			const FName EffectID = ActiveStatusEffects[i].EffectID;
+			ActiveStatusEffects[i].ExpiryTimer.Invalidate();
+			CancelStatusEffectTimers(ActiveStatusEffects[i]);
 			ActiveStatusEffects.RemoveAt(i);
+			OnStatusEffectExpired.Broadcast(EffectID);
+			return;
 		}
-		else
+	}
+}
+
+void UStatlineComponent::HandleStatusEffectTick(FDATimerHandle Timer)
+{
+	for (FActiveStatusEffect& Effect : ActiveStatusEffects)
+	{
+		if (Effect.PeriodicTimer == Timer)
 		{
+			if (UWorld* World = GetWorld())
+			{
+				Effect.LastTickTime = World->GetTimeSeconds();
+				if (UDATimerWheelSubsystem* TimerWheel = World->GetSubsystem<UDATimerWheelSubsystem>())
+				{
+					Effect.RemainingDuration = FMath::Max(0.0f, TimerWheel->GetTimeRemaining(Effect.ExpiryTimer));
+				}
+			}
 			OnStatusEffectTick.Broadcast(Effect.EffectID, Effect.CurrentStacks, Effect.RemainingDuration);
+			return;
 		}
 	}
 }
 
+void UStatlineComponent::CancelStatusEffectTimers(FActiveStatusEffect& Effect)
+{
+	UWorld* World = GetWorld();
+	if (UDATimerWheelSubsystem* TimerWheel = World ? World->GetSubsystem<UDATimerWheelSubsystem>() : nullptr)
+	{
+		TimerWheel->Cancel(Effect.ExpiryTimer);
+		TimerWheel->Cancel(Effect.PeriodicTimer);
+	}
+}
+
 void UStatlineComponent::OnRep_Stats()
 {
-	// Handle replication of stats
-	for (const FStatEntry& StatEntry : Stats)
+	// Only notify for stats whose value changed since the last replication
+	RebuildStatTable();
+	for (int32 StatIndex = 0; StatIndex < StatSlots.Num(); ++StatIndex)
 	{
-		OnStatChanged.Broadcast(StatEntry.StatName, StatEntry.Stat.CurrentValue);
+		const FStatSlot& StatSlot = StatSlots[StatIndex];
+		if (StatSlot.Slot == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const float NewValue = Stats[StatSlot.Slot].Stat.CurrentValue;
+		if (StatSlot.ChangeVersion == 0 || NewValue != StatSlot.LastNotifiedValue)
+		{
+			MarkStatChanged(StatIndex, NewValue);
+		}
 	}
 }
 
@@ -171,11 +391,15 @@ void UStatlineComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 void UStatlineComponent::SetStats(const TArray<FStatEntry>& InStats)
 {
 	Stats = InStats;
+	RebuildStatTable();
 	if (GetOwner()->HasAuthority())
 	{
-		for (const FStatEntry& StatEntry : Stats)
+		for (int32 StatIndex = 0; StatIndex < StatSlots.Num(); ++StatIndex)
 		{
-			OnStatChanged.Broadcast(StatEntry.StatName, StatEntry.Stat.CurrentValue);
+			if (StatSlots[StatIndex].Slot != INDEX_NONE)
+			{
+				MarkStatChanged(StatIndex, Stats[StatSlots[StatIndex].Slot].Stat.CurrentValue);
+			}
 		}
 	}
 }
@@ -195,50 +419,50 @@ void UStatlineComponent::PrintStats()
 // Convenience methods implementation
 float UStatlineComponent::GetCurrentStamina() const
 {
-	return GetCurrentStatValue(FName("Stamina"));
+	return GetCurrentStatValueByIndex(FDAStatLayout::Stamina);
 }
 
 void UStatlineComponent::ModifyStamina(float Delta)
 {
-	UpdateStat(FName("Stamina"), Delta);
+	UpdateStatByIndex(FDAStatLayout::Stamina, Delta);
 }
 
 float UStatlineComponent::GetCurrentHealth() const
 {
-	return GetCurrentStatValue(FName("Health"));
+	return GetCurrentStatValueByIndex(FDAStatLayout::Health);
 }
 
 void UStatlineComponent::ModifyHealth(float Delta)
 {
-	UpdateStat(FName("Health"), Delta);
+	UpdateStatByIndex(FDAStatLayout::Health, Delta);
 }
 
 float UStatlineComponent::GetCurrentMana() const
 {
-	return GetCurrentStatValue(FName("Mana"));
+	return GetCurrentStatValueByIndex(FDAStatLayout::Mana);
 }
 
 void UStatlineComponent::ModifyMana(float Delta)
 {
-	UpdateStat(FName("Mana"), Delta);
+	UpdateStatByIndex(FDAStatLayout::Mana, Delta);
 }
 
 float UStatlineComponent::GetCurrentHunger() const
 {
-	return GetCurrentStatValue(FName("Hunger"));
+	return GetCurrentStatValueByIndex(FDAStatLayout::Hunger);
 }
 
 void UStatlineComponent::ModifyHunger(float Delta)
 {
-	UpdateStat(FName("Hunger"), Delta);
+	UpdateStatByIndex(FDAStatLayout::Hunger, Delta);
 }
 
 float UStatlineComponent::GetCurrentThirst() const
 {
-	return GetCurrentStatValue(FName("Thirst"));
+	return GetCurrentStatValueByIndex(FDAStatLayout::Thirst);
 }
 
 void UStatlineComponent::ModifyThirst(float Delta)
 {
-	UpdateStat(FName("Thirst"), Delta);
+	UpdateStatByIndex(FDAStatLayout::Thirst, Delta);
 }
@@ -4,7 +4,8 @@
 
 UStatusEffectComponent::UStatusEffectComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // Expiry and periodic ticks are scheduled on UDATimerWheelSubsystem
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UStatusEffectComponent::BeginPlay()
@@ -13,22 +14,18 @@ void UStatusEffectComponent::BeginPlay()
     StatlineComponent = GetOwner()->FindComponentByClass<UStatlineComponent>();
 }
 
-void UStatusEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UStatusEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    for (int32 i = ActiveEffects.Num() - 1; i >= 0; --i)
+    if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
     {
-        FActiveStatusEffect& Effect = ActiveEffects[i];
-        if (Effect.bIsActive)
-        {
-            HandleEffectTick(Effect, DeltaTime);
-        }
-        else
+        for (FActiveStatusEffect& Effect : ActiveEffects)
         {
-            ActiveEffects.RemoveAt(i);
+            TimerWheel->Cancel(Effect.ExpiryTimer);
+            TimerWheel->Cancel(Effect.PeriodicTimer);
         }
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UStatusEffectComponent::ApplyEffect(const FDataTableRowHandle& EffectDataRowHandle)
@@ -46,6 +43,7 @@ void UStatusEffectComponent::ApplyEffect(const FDataTableRowHandle& EffectDataRo
 
     FActiveStatusEffect NewEffect;
     NewEffect.EffectDataRowHandle = EffectDataRowHandle;
+    NewEffect.EffectData = EffectData;
     NewEffect.EffectID = EffectData->EffectID;
     NewEffect.RemainingDuration = EffectData->BaseDuration;
     if (UWorld* World = GetWorld())
@@ -54,6 +52,23 @@ void UStatusEffectComponent::ApplyEffect(const FDataTableRowHandle& EffectDataRo
         NewEffect.LastTickTime = World->GetTimeSeconds();
     }
 
+    // Instant effects are one-shot and expire on the next step; other effects without a duration persist until removed
+    const bool bExpires = EffectData->BaseDuration > 0.0f || EffectData->ApplicationMethod == EStatusEffectApplication::Instant;
+    if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
+    {
+        if (bExpires)
+        {
+            NewEffect.ExpiryTimer = TimerWheel->Schedule(this, EffectData->BaseDuration,
+                [this](FDATimerHandle Timer) { HandleEffectExpired(Timer); });
+        }
+
+        if (EffectData->ApplicationMethod == EStatusEffectApplication::OverTime && EffectData->TickInterval > 0.0f)
+        {
+            NewEffect.PeriodicTimer = TimerWheel->Schedule(this, EffectData->TickInterval,
+                [this](FDATimerHandle Timer) { HandleEffectTick(Timer); }, EffectData->TickInterval);
+        }
+    }
+
     ActiveEffects.Add(NewEffect);
     ApplyStatModifiers(EffectData, true);
     OnStatusEffectAdded.Broadcast(NewEffect.EffectID, true);
@@ -61,16 +76,14 @@ void UStatusEffectComponent::ApplyEffect(const FDataTableRowHandle& EffectDataRo
 
 void UStatusEffectComponent::RemoveEffect(FName EffectID)
 {
-    for (int32 i = 0; i < ActiveEffects.Num(); ++i)
+    const int32 Index = ActiveEffects.IndexOfByPredicate([EffectID](const FActiveStatusEffect& Effect)
     {
-        if (ActiveEffects[i].EffectID == EffectID)
-        {
-            const FStatusEffectData* EffectData = ActiveEffects[i].EffectDataRowHandle.GetRow<FStatusEffectData>("");
-            ApplyStatModifiers(EffectData, false);
-            OnStatusEffectRemoved.Broadcast(EffectID, false);
-            ActiveEffects.RemoveAt(i);
-            return;
-        }
+        return Effect.EffectID == EffectID;
+    });
+
+    if (Index != INDEX_NONE)
+    {
+        RemoveEffectAt(Index);
     }
 }
 
@@ -82,28 +95,79 @@ bool UStatusEffectComponent::HasEffect(FName EffectID) const
     });
 }
 
-void UStatusEffectComponent::HandleEffectTick(FActiveStatusEffect& Effect, float DeltaTime)
+float UStatusEffectComponent::GetEffectTimeRemaining(FName EffectID) const
+{
+    const FActiveStatusEffect* Effect = ActiveEffects.FindByPredicate([EffectID](const FActiveStatusEffect& InEffect)
+    {
+        return InEffect.EffectID == EffectID;
+    });
+
+    const UDATimerWheelSubsystem* TimerWheel = GetTimerWheel();
+    return Effect && TimerWheel ? TimerWheel->GetTimeRemaining(Effect->ExpiryTimer) : -1.0f;
+}
+
+void UStatusEffectComponent::HandleEffectExpired(FDATimerHandle Timer)
+{
+    const int32 Index = ActiveEffects.IndexOfByPredicate([Timer](const FActiveStatusEffect& Effect)
+    {
+        return Effect.ExpiryTimer == Timer;
+    });
+
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Instant effects already made their one-off change to the stats
+    const FStatusEffectData* EffectData = ActiveEffects[Index].EffectData;
+    RemoveEffectAt(Index, !EffectData || EffectData->ApplicationMethod != EStatusEffectApplication::Instant);
+}
+
+void UStatusEffectComponent::HandleEffectTick(FDATimerHandle Timer)
 {
-    Effect.RemainingDuration -= DeltaTime;
+    FActiveStatusEffect* Effect = ActiveEffects.FindByPredicate([Timer](const FActiveStatusEffect& InEffect)
+    {
+        return InEffect.PeriodicTimer == Timer;
+    });
 
-    if (Effect.RemainingDuration <= 0.0f)
+    if (!Effect)
     {
-        Effect.bIsActive = false;
         return;
     }
 
-    const FStatusEffectData* EffectData = Effect.EffectDataRowHandle.GetRow<FStatusEffectData>("");
-    if (EffectData && EffectData->ApplicationMethod == EStatusEffectApplication::OverTime)
+    if (UWorld* World = GetWorld())
     {
-        if (UWorld* World = GetWorld())
-        {
-            if (World->GetTimeSeconds() - Effect.LastTickTime >= EffectData->TickInterval)
-            {
-                Effect.LastTickTime = World->GetTimeSeconds();
-                OnStatusEffectTicked.Broadcast(Effect.EffectID, Effect.CurrentStacks, Effect.RemainingDuration);
-            }
-        }
+        Effect->LastTickTime = World->GetTimeSeconds();
     }
+    if (const UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
+    {
+        Effect->RemainingDuration = FMath::Max(0.0f, TimerWheel->GetTimeRemaining(Effect->ExpiryTimer));
+    }
+    OnStatusEffectTicked.Broadcast(Effect->EffectID, Effect->CurrentStacks, Effect->RemainingDuration);
+}
+
+void UStatusEffectComponent::RemoveEffectAt(int32 Index, bool bRevertModifiers)
+{
+    FActiveStatusEffect& Effect = ActiveEffects[Index];
+    if (UDATimerWheelSubsystem* TimerWheel = GetTimerWheel())
+    {
+        TimerWheel->Cancel(Effect.ExpiryTimer);
+        TimerWheel->Cancel(Effect.PeriodicTimer);
+    }
+
+    const FName EffectID = Effect.EffectID;
+    if (bRevertModifiers)
+    {
+        ApplyStatModifiers(Effect.EffectData, false);
+    }
+    ActiveEffects.RemoveAt(Index);
+    OnStatusEffectRemoved.Broadcast(EffectID, false);
+}
+
+UDATimerWheelSubsystem* UStatusEffectComponent::GetTimerWheel() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UDATimerWheelSubsystem>() : nullptr;
 }
 
 void UStatusEffectComponent::ApplyStatModifiers(const FStatusEffectData* EffectData, bool bIsApplying)
@@ -3,13 +3,15 @@
 #include "Components/WorldInteractionComponent.h"
 #include "Core/WorldPersistenceSystem.h"
 #include "Core/DAGameInstance.h"
+#include "Core/GlobalEventBus.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
 
 // Sets default values for this component's properties
 UWorldInteractionComponent::UWorldInteractionComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame
-    PrimaryComponentTick.bCanEverTick = true;
+    // Actions are recorded as they happen and the region is set explicitly, so this never ticks
+    PrimaryComponentTick.bCanEverTick = false;
     
     // Default region
     CurrentRegion = FName("Heartlands");
@@ -29,15 +31,6 @@ void UWorldInteractionComponent::BeginPlay()
     }
 }
 
-// Called every frame
-void UWorldInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // In a full implementation, this could check if the actor has moved to a new region
-    // For now, we'll rely on manual region setting or level-specific regions
-}
-
 void UWorldInteractionComponent::RecordCombatAction(FName TargetID, float Intensity, const FString& Details)
 {
     RecordAction(EWorldActionType::Combat, TargetID, Intensity, Details);
@@ -97,6 +90,16 @@ void UWorldInteractionComponent::SetCurrentRegion(FName RegionID)
         
         // Broadcast the region change
         OnRegionChanged.Broadcast(OldRegion, CurrentRegion);
+
+        // Arrival objectives listen for this on the bus; NPCs carry this component too, so only players announce it
+        const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+        UGlobalEventBus* EventBus = UGlobalEventBus::Get(this);
+        if (EventBus && OwnerPawn && OwnerPawn->IsPlayerControlled())
+        {
+            const FString Source = OwnerPawn->GetName();
+            EventBus->BroadcastSimpleEventNoData(EGlobalEventType::PlayerLeftRegion, Source, OldRegion.ToString(), EEventPriority::Normal, true);
+            EventBus->BroadcastSimpleEventNoData(EGlobalEventType::PlayerEnteredRegion, Source, CurrentRegion.ToString(), EEventPriority::Normal, true);
+        }
         
         UE_LOG(LogTemp, Log, TEXT("UWorldInteractionComponent::SetCurrentRegion: Region changed from %s to %s"), 
             *OldRegion.ToString(), *CurrentRegion.ToString());
@@ -8,8 +8,8 @@
 // Sets default values for this component's properties
 UWorldPersistenceTestComponent::UWorldPersistenceTestComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame
-    PrimaryComponentTick.bCanEverTick = true;
+    // Test actions are driven from Blueprint; nothing to do per frame
+    PrimaryComponentTick.bCanEverTick = false;
     
     // Initialize available regions
     AvailableRegions.Add(FName("Heartlands"));
@@ -43,14 +43,6 @@ void UWorldPersistenceTestComponent::BeginPlay()
     }
 }
 
-// Called every frame
-void UWorldPersistenceTestComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // No need for tick functionality in this test component
-}
-
 void UWorldPersistenceTestComponent::GenerateRandomAction()
 {
     if (!WorldPersistenceSystem)
@@ -4,11 +4,17 @@
 #include "Core/EconomySubsystem.h"
 #include "Core/WorldPopulationSubsystem.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
 
 void UAdvancedQuestGenerationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+    QuestRuntime = Collection.InitializeDependency<UQuestRuntimeSubsystem>();
+    if (QuestRuntime)
+    {
+        QuestRuntime->SetListener(EQuestRuntimeSource::Generated, FOnQuestRuntimeEvent::CreateUObject(this, &UAdvancedQuestGenerationSubsystem::HandleRuntimeEvent));
+    }
     
     InitializeQuestTemplates();
     InitializeQuestParameters();
@@ -19,6 +25,17 @@ void UAdvancedQuestGenerationSubsystem::Initialize(FSubsystemCollectionBase& Col
     UE_LOG(LogTemp, Log, TEXT("AdvancedQuestGenerationSubsystem initialized with %d quest templates"), QuestTemplates.Num());
 }
 
+void UAdvancedQuestGenerationSubsystem::Deinitialize()
+{
+    if (QuestRuntime)
+    {
+        QuestRuntime->ClearListener(EQuestRuntimeSource::Generated);
+    }
+    AvailableQuests.Empty();
+
+    Super::Deinitialize();
+}
+
 void UAdvancedQuestGenerationSubsystem::Tick(float DeltaTime)
 {
     
@@ -30,12 +47,6 @@ void UAdvancedQuestGenerationSubsystem::Tick(float DeltaTime)
         GenerateContextualQuests();
         QuestGenerationTimer = 0.0f;
     }
-    
-    // Update active quests
-    UpdateActiveQuests(DeltaTime);
-    
-    // Clean up expired quests
-    CleanupExpiredQuests();
 }
 
 void UAdvancedQuestGenerationSubsystem::InitializeQuestTemplates()
@@ -497,154 +508,151 @@ FDynamicQuest UAdvancedQuestGenerationSubsystem::CreateQuestFromTemplate(const F
 
 void UAdvancedQuestGenerationSubsystem::AddQuestToPool(const FDynamicQuest& Quest)
 {
-    AvailableQuests.Add(Quest);
+    if (!QuestRuntime)
+    {
+        return;
+    }
+
+    const FQuestRuntimeHandle Handle = QuestRuntime->AddQuest(EQuestRuntimeSource::Generated, Quest, FinishedQuestRetention);
+    if (!Handle.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AddQuestToPool: Quest ID %s is already in use"), *Quest.QuestID);
+        return;
+    }
+    AvailableQuests.Add(Handle);
     
     // Limit the number of available quests
     if (AvailableQuests.Num() > MaxAvailableQuests)
-
     {
-        // Remove oldest quest
-        AvailableQuests.RemoveAt(0);
+        // Remove oldest quest; the runtime's removal event drops it from the pool
+        QuestRuntime->RemoveQuest(AvailableQuests[0]);
     }
     
     OnQuestGenerated.Broadcast(Quest);
 }
 
-void UAdvancedQuestGenerationSubsystem::UpdateActiveQuests(float DeltaTime)
+void UAdvancedQuestGenerationSubsystem::CompleteQuest(FQuestRuntimeHandle Handle)
 {
-    UWorld* World = GetWorld();
-    if (!World)
+    const FDynamicQuest* Quest = QuestRuntime->FindQuest(Handle);
+    if (!Quest)
     {
         return;
     }
-    float CurrentTime = World->GetTimeSeconds();
+
+    QuestRuntime->FinishQuest(Handle, EDynamicQuestStatus::Completed);
     
-    for (FDynamicQuest& Quest : ActiveQuests)
+    UE_LOG(LogTemp, Log, TEXT("Quest completed: %s (Reward: %f gold, %f XP)"), 
+        *Quest->Title, Quest->GoldReward, Quest->ExperienceReward);
+    
+    // Award rewards (would integrate with player progression system)
+    OnQuestCompleted.Broadcast(FName(*Quest->QuestID));
+}
+
+void UAdvancedQuestGenerationSubsystem::HandleRuntimeEvent(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex)
+{
+    const FDynamicQuest* Quest = QuestRuntime->FindQuest(Handle);
+    if (!Quest)
     {
-        if (Quest.bIsCompleted || Quest.bIsExpired)
-            continue;
-        
-        // Check for time expiration
-        if (Quest.TimeLimit > 0.0f && (CurrentTime - Quest.CreationTime) > Quest.TimeLimit)
-        {
-            Quest.bIsExpired = true;
-            UE_LOG(LogTemp, Warning, TEXT("Quest expired: %s"), *Quest.Title);
-            OnQuestExpired.Broadcast(Quest);
-            continue;
-        }
-        
-        // Update quest objectives (simplified - would integrate with game systems)
-        UpdateQuestObjectives(Quest);
-        
-        // Check if quest is completed
-        bool bAllObjectivesComplete = true;
-        for (const FQuestObjective& Objective : Quest.Objectives)
-        {
-            if (!Objective.bIsCompleted)
-            {
-                bAllObjectivesComplete = false;
-                break;
-            }
-        }
-        
-        if (bAllObjectivesComplete && !Quest.bIsCompleted)
+        return;
+    }
+
+    switch (Event)
+    {
+    case EQuestRuntimeEvent::ObjectiveCompleted:
+    {
+        // Listeners may add or remove quests, so they get copies rather than runtime storage
+        const FDynamicQuest QuestSnapshot = *Quest;
+        UE_LOG(LogTemp, Log, TEXT("Quest objective completed: %s"), *QuestSnapshot.Title);
+        OnQuestObjectiveCompleted.Broadcast(QuestSnapshot, QuestSnapshot.Objectives[ObjectiveIndex]);
+
+        // False if a listener abandoned the quest
+        if (QuestRuntime->AreObjectivesCompleted(Handle))
         {
-            CompleteQuest(Quest);
+            CompleteQuest(Handle);
         }
+        break;
     }
-}
-
-void UAdvancedQuestGenerationSubsystem::UpdateQuestObjectives(FDynamicQuest& Quest)
-{
-    // This would integrate with various game systems to track objective progress
-    // For now, we'll simulate some progress
-    
-    for (FQuestObjective& Objective : Quest.Objectives)
+    case EQuestRuntimeEvent::Expired:
     {
-        if (Objective.bIsCompleted)
-            continue;
-        
-        // Simulate random progress (in real implementation, this would be driven by player actions)
-        if (FMath::FRand() < 0.01f) // 1% chance per update
+        const FDynamicQuest QuestSnapshot = *Quest;
+        UE_LOG(LogTemp, Warning, TEXT("Quest expired: %s"), *QuestSnapshot.Title);
+        OnQuestExpired.Broadcast(QuestSnapshot);
+        break;
+    }
+    case EQuestRuntimeEvent::Removed:
+        AvailableQuests.Remove(Handle);
+        break;
+    case EQuestRuntimeEvent::Restored:
+        // Keep new IDs clear of the restored ones
+        NextQuestID = FMath::Max(NextQuestID, FCString::Atoi(*Quest->QuestID) + 1);
+        if (!IsAcceptedQuest(*Quest))
         {
-            Objective.CurrentCount = FMath::Min(Objective.CurrentCount + 1, Objective.RequiredCount);
-            
-            if (Objective.CurrentCount >= Objective.RequiredCount)
-            {
-                Objective.bIsCompleted = true;
-                UE_LOG(LogTemp, Log, TEXT("Quest objective completed: %s"), *Quest.Title);
-                OnQuestObjectiveCompleted.Broadcast(Quest, Objective);
-            }
+            AvailableQuests.Add(Handle);
         }
+        break;
     }
 }
 
-void UAdvancedQuestGenerationSubsystem::CompleteQuest(FDynamicQuest& Quest)
+FQuestRuntimeHandle UAdvancedQuestGenerationSubsystem::FindQuestHandle(int32 QuestID) const
 {
-    Quest.bIsCompleted = true;
-    
-    UE_LOG(LogTemp, Log, TEXT("Quest completed: %s (Reward: %f gold, %f XP)"), 
-        *Quest.Title, Quest.GoldReward, Quest.ExperienceReward);
-    
-    // Award rewards (would integrate with player progression system)
-    OnQuestCompleted.Broadcast(FName(*Quest.QuestID));
+    return QuestRuntime ? QuestRuntime->FindHandle(EQuestRuntimeSource::Generated, FString::FromInt(QuestID)) : FQuestRuntimeHandle();
 }
 
-void UAdvancedQuestGenerationSubsystem::CleanupExpiredQuests()
+bool UAdvancedQuestGenerationSubsystem::IsAcceptedQuest(const FDynamicQuest& Quest)
 {
-    // Remove expired quests from available quests
-    AvailableQuests.RemoveAll([](const FDynamicQuest& Quest)
-    {
-        return Quest.bIsExpired;
-    });
-    
-    // Remove completed/expired quests from active quests after some time
-    UWorld* World = GetWorld();
-    if (!World)
-    {
-        return;
-    }
-    float CurrentTime = World->GetTimeSeconds();
-    ActiveQuests.RemoveAll([CurrentTime](const FDynamicQuest& Quest)
-    {
-        return (Quest.bIsCompleted || Quest.bIsExpired) && 
-               (CurrentTime - Quest.CreationTime) > 300.0f; // Keep for 5 minutes after completion
-    });
+    return Quest.Status != EDynamicQuestStatus::Generated && Quest.Status != EDynamicQuestStatus::Available;
 }
 
 // Public Interface Functions
 TArray<FDynamicQuest> UAdvancedQuestGenerationSubsystem::GetAvailableQuests() const
 {
-    return AvailableQuests;
+    TArray<FDynamicQuest> Quests;
+    Quests.Reserve(AvailableQuests.Num());
+    for (const FQuestRuntimeHandle Handle : AvailableQuests)
+    {
+        if (const FDynamicQuest* Quest = QuestRuntime->FindQuest(Handle))
+        {
+            Quests.Add(*Quest);
+        }
+    }
+    return Quests;
 }
 
 TArray<FDynamicQuest> UAdvancedQuestGenerationSubsystem::GetActiveQuests() const
 {
-    return ActiveQuests;
+    TArray<FDynamicQuest> Quests;
+    if (QuestRuntime)
+    {
+        QuestRuntime->ForEachQuest(EQuestRuntimeSource::Generated, [&Quests](FQuestRuntimeHandle, const FDynamicQuest& Quest)
+        {
+            if (IsAcceptedQuest(Quest))
+            {
+                Quests.Add(Quest);
+            }
+        });
+    }
+    return Quests;
 }
 
 bool UAdvancedQuestGenerationSubsystem::AcceptQuest(int32 QuestID)
 {
     // Find quest in available quests
-    int32 QuestIndex = AvailableQuests.IndexOfByPredicate([QuestID](const FDynamicQuest& Quest)
-    {
-        return Quest.QuestID == FString::FromInt(QuestID);
-    });
-    
-    if (QuestIndex == INDEX_NONE)
+    const FQuestRuntimeHandle Handle = FindQuestHandle(QuestID);
+    if (!AvailableQuests.Contains(Handle))
     {
         UE_LOG(LogTemp, Warning, TEXT("AcceptQuest: Quest ID %d not found in available quests"), QuestID);
         return false;
     }
     
     // Move quest to active quests
-    FDynamicQuest Quest = AvailableQuests[QuestIndex];
-    Quest.Status = EDynamicQuestStatus::Active;
-    ActiveQuests.Add(Quest);
-    AvailableQuests.RemoveAt(QuestIndex);
+    AvailableQuests.Remove(Handle);
+    FDynamicQuest* Quest = QuestRuntime->FindQuest(Handle);
+    Quest->Status = EDynamicQuestStatus::Active;
+    QuestRuntime->StartTracking(Handle);
     
-    UE_LOG(LogTemp, Log, TEXT("Quest accepted: %s"), *Quest.QuestName);
-    OnQuestAccepted.Broadcast(Quest);
+    const FDynamicQuest QuestSnapshot = *Quest;
+    UE_LOG(LogTemp, Log, TEXT("Quest accepted: %s"), *QuestSnapshot.QuestName);
+    OnQuestAccepted.Broadcast(QuestSnapshot);
     
     return true;
 }
@@ -652,22 +660,19 @@ bool UAdvancedQuestGenerationSubsystem::AcceptQuest(int32 QuestID)
 bool UAdvancedQuestGenerationSubsystem::AbandonQuest(int32 QuestID)
 {
     // Find quest in active quests
-    int32 QuestIndex = ActiveQuests.IndexOfByPredicate([QuestID](const FDynamicQuest& Quest)
-    {
-        return Quest.QuestID == FString::FromInt(QuestID);
-    });
-    
-    if (QuestIndex == INDEX_NONE)
+    const FQuestRuntimeHandle Handle = FindQuestHandle(QuestID);
+    const FDynamicQuest* Quest = QuestRuntime ? QuestRuntime->FindQuest(Handle) : nullptr;
+    if (!Quest || !IsAcceptedQuest(*Quest))
     {
         UE_LOG(LogTemp, Warning, TEXT("AbandonQuest: Quest ID %d not found in active quests"), QuestID);
         return false;
     }
     
-    FDynamicQuest Quest = ActiveQuests[QuestIndex];
-    ActiveQuests.RemoveAt(QuestIndex);
+    const FDynamicQuest AbandonedQuest = *Quest;
+    QuestRuntime->RemoveQuest(Handle);
     
-    UE_LOG(LogTemp, Log, TEXT("Quest abandoned: %s"), *Quest.QuestName);
-    OnQuestAbandoned.Broadcast(FName(*Quest.QuestID));
+    UE_LOG(LogTemp, Log, TEXT("Quest abandoned: %s"), *AbandonedQuest.QuestName);
+    OnQuestAbandoned.Broadcast(FName(*AbandonedQuest.QuestID));
     
     return true;
 }
@@ -729,5 +734,5 @@ int32 UAdvancedQuestGenerationSubsystem::GetAvailableQuestCount() const
 
 int32 UAdvancedQuestGenerationSubsystem::GetActiveQuestCount() const
 {
-    return ActiveQuests.Num();
+    return QuestRuntime ? QuestRuntime->GetNumQuests(EQuestRuntimeSource::Generated) - AvailableQuests.Num() : 0;
 }
\ No newline at end of file
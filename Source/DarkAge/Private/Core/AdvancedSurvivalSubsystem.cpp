@@ -91,15 +91,15 @@ void UAdvancedSurvivalSubsystem::UpdateCharacterSurvival(ACharacter* Character,
 		float HungerDecrement = 0.1f * DeltaTime;
 		float ThirstDecrement = 0.2f * DeltaTime;
 
-		StatlineComp->UpdateStat(FName("Hunger"), -HungerDecrement);
-		StatlineComp->UpdateStat(FName("Thirst"), -ThirstDecrement);
+		StatlineComp->ModifyHunger(-HungerDecrement);
+		StatlineComp->ModifyThirst(-ThirstDecrement);
 
 		// Apply damage if hunger or thirst are at zero
-		if (StatlineComp->GetCurrentStatValue(FName("Hunger")) <= 0.0f)
+		if (StatlineComp->GetCurrentHunger() <= 0.0f)
 		{
 			StatlineComp->ModifyHealth(-0.5f * DeltaTime); // Small damage over time
 		}
-		if (StatlineComp->GetCurrentStatValue(FName("Thirst")) <= 0.0f)
+		if (StatlineComp->GetCurrentThirst() <= 0.0f)
 		{
 			StatlineComp->ModifyHealth(-1.0f * DeltaTime); // More damage for thirst
 		}
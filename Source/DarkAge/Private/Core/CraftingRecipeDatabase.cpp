@@ -0,0 +1,150 @@
+#include "Core/CraftingRecipeDatabase.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/AssetManager.h"
+
+void UCraftingRecipeDatabase::Deinitialize()
+{
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->CancelHandle();
+        LoadHandle.Reset();
+    }
+
+    RecipeIDs.Empty();
+    Recipes.Empty();
+    Requirements.Empty();
+    Ingredients.Empty();
+    RecipeIndices.Empty();
+    RecipesByIngredient.Empty();
+    RecipesBySkill.Empty();
+    bLoaded = false;
+
+    Super::Deinitialize();
+}
+
+void UCraftingRecipeDatabase::RequestLoad(const TSoftObjectPtr<UDataTable>& RecipeTable)
+{
+    if (RecipeTable.IsNull())
+    {
+        return;
+    }
+
+    if (!RequestedTable.IsNull())
+    {
+        if (RequestedTable != RecipeTable)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("CraftingRecipeDatabase: Ignoring recipe table '%s'; '%s' is already in use."),
+                *RecipeTable.ToSoftObjectPath().ToString(), *RequestedTable.ToSoftObjectPath().ToString());
+        }
+        return;
+    }
+
+    RequestedTable = RecipeTable;
+
+    // Already resident, e.g. referenced by another asset: no need to go through the streamer
+    if (const UDataTable* Table = RecipeTable.Get())
+    {
+        BuildFromTable(Table);
+        return;
+    }
+
+    FStreamableManager& StreamableManager = UAssetManager::Get().GetStreamableManager();
+    LoadHandle = StreamableManager.RequestAsyncLoad(RecipeTable.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &UCraftingRecipeDatabase::OnRecipeTableLoaded));
+}
+
+void UCraftingRecipeDatabase::OnRecipeTableLoaded()
+{
+    const UDataTable* Table = RequestedTable.Get();
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Error, TEXT("CraftingRecipeDatabase: Failed to load recipe table from path: %s"), *RequestedTable.ToSoftObjectPath().ToString());
+        LoadHandle.Reset();
+        return;
+    }
+
+    BuildFromTable(Table);
+    LoadHandle.Reset();
+}
+
+void UCraftingRecipeDatabase::BuildFromTable(const UDataTable* Table)
+{
+    RecipeIDs.Reset();
+    Recipes.Reset();
+    Requirements.Reset();
+    Ingredients.Reset();
+    RecipeIndices.Reset();
+    RecipesByIngredient.Reset();
+    RecipesBySkill.Reset();
+
+    if (!Table)
+    {
+        return;
+    }
+
+    const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+    RecipeIDs.Reserve(RowMap.Num());
+    Recipes.Reserve(RowMap.Num());
+    Requirements.Reserve(RowMap.Num());
+
+    FString ContextString(TEXT("Building crafting recipe database"));
+    for (const TPair<FName, uint8*>& Row : RowMap)
+    {
+        const FCraftingRecipe* Recipe = Table->FindRow<FCraftingRecipe>(Row.Key, ContextString);
+        if (!Recipe)
+        {
+            continue;
+        }
+
+        const int32 RecipeIndex = Recipes.Add(*Recipe);
+        RecipeIDs.Add(Row.Key);
+        RecipeIndices.Add(Row.Key, RecipeIndex);
+
+        FRecipeRequirements& Compiled = Requirements.AddDefaulted_GetRef();
+        Compiled.FirstIngredient = Ingredients.Num();
+        Compiled.NumIngredients = Recipe->Ingredients.Num();
+        Ingredients.Append(Recipe->Ingredients);
+
+        for (const FCraftingIngredient& Ingredient : Recipe->Ingredients)
+        {
+            if (Ingredient.ItemID == NAME_None || Ingredient.Quantity <= 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("CraftingRecipeDatabase: Recipe '%s' has invalid ingredient (ItemID None or Quantity <= 0) and can never be crafted."), *Row.Key.ToString());
+                continue;
+            }
+            RecipesByIngredient.FindOrAdd(Ingredient.ItemID).AddUnique(RecipeIndex);
+        }
+        if (Recipe->RequiredSkillID != NAME_None)
+        {
+            RecipesBySkill.FindOrAdd(Recipe->RequiredSkillID).Add(RecipeIndex);
+        }
+    }
+
+    bLoaded = true;
+    UE_LOG(LogTemp, Log, TEXT("CraftingRecipeDatabase: Indexed %d recipes using %d distinct ingredients from '%s'."), Recipes.Num(), RecipesByIngredient.Num(), *Table->GetName());
+
+    OnRecipesLoaded.Broadcast();
+}
+
+int32 UCraftingRecipeDatabase::FindRecipe(FName RecipeID) const
+{
+    const int32* RecipeIndex = RecipeIndices.Find(RecipeID);
+    return RecipeIndex ? *RecipeIndex : INDEX_NONE;
+}
+
+TConstArrayView<FCraftingIngredient> UCraftingRecipeDatabase::GetIngredients(int32 RecipeIndex) const
+{
+    const FRecipeRequirements& Compiled = Requirements[RecipeIndex];
+    return TConstArrayView<FCraftingIngredient>(Ingredients.GetData() + Compiled.FirstIngredient, Compiled.NumIngredients);
+}
+
+TConstArrayView<int32> UCraftingRecipeDatabase::GetRecipesForSkill(FName SkillID) const
+{
+    const TArray<int32>* RecipeIndicesForSkill = RecipesBySkill.Find(SkillID);
+    return RecipeIndicesForSkill ? TConstArrayView<int32>(*RecipeIndicesForSkill) : TConstArrayView<int32>();
+}
+
+TConstArrayView<int32> UCraftingRecipeDatabase::GetRecipesUsingIngredient(FName ItemID) const
+{
+    const TArray<int32>* RecipeIndicesForItem = RecipesByIngredient.Find(ItemID);
+    return RecipeIndicesForItem ? TConstArrayView<int32>(*RecipeIndicesForItem) : TConstArrayView<int32>();
+}
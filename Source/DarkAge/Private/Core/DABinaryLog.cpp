@@ -0,0 +1,449 @@
+// Copyright (c) 2025 RaioCore
+// Binary log format registry and decoder for DarkAge
+
+#include "Core/DABinaryLog.h"
+#include "Core/DALoggingSubsystem.h"
+#include "Misc/FileHelper.h"
+#include <cstdio>
+
+namespace
+{
+    struct FDABinaryLogReader
+    {
+        const uint8* Data = nullptr;
+        int32 Size = 0;
+        int32 Offset = 0;
+
+        template <typename ValueType>
+        bool Read(ValueType& OutValue)
+        {
+            if (Offset + (int32)sizeof(ValueType) > Size)
+            {
+                return false;
+            }
+            FMemory::Memcpy(&OutValue, Data + Offset, sizeof(ValueType));
+            Offset += sizeof(ValueType);
+            return true;
+        }
+
+        bool ReadUTF8(int32 Length, FString& OutValue)
+        {
+            if (Length < 0 || Offset + Length > Size)
+            {
+                return false;
+            }
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Offset), Length);
+            OutValue = FString(Converted.Length(), Converted.Get());
+            Offset += Length;
+            return true;
+        }
+
+        bool ReadString(FString& OutValue)
+        {
+            uint32 Length = 0;
+            return Read(Length) && ReadUTF8((int32)Length, OutValue);
+        }
+    };
+
+    struct FDABinaryLogArg
+    {
+        DABinaryLog::EArgType Type = DABinaryLog::EArgType::Int32;
+        int64 Signed = 0;
+        uint64 Unsigned = 0;
+        double Double = 0.0;
+        FString String;
+    };
+
+    bool ReadArg(FDABinaryLogReader& Reader, FDABinaryLogArg& OutArg)
+    {
+        using DABinaryLog::EArgType;
+
+        uint8 Tag = 0;
+        if (!Reader.Read(Tag))
+        {
+            return false;
+        }
+        OutArg.Type = (EArgType)Tag;
+
+        switch (OutArg.Type)
+        {
+            case EArgType::Int32:
+            {
+                int32 Value = 0;
+                if (!Reader.Read(Value)) return false;
+                OutArg.Signed = Value;
+                OutArg.Unsigned = (uint64)Value;
+                OutArg.Double = Value;
+                return true;
+            }
+            case EArgType::UInt32:
+            {
+                uint32 Value = 0;
+                if (!Reader.Read(Value)) return false;
+                OutArg.Signed = Value;
+                OutArg.Unsigned = Value;
+                OutArg.Double = Value;
+                return true;
+            }
+            case EArgType::Int64:
+            {
+                if (!Reader.Read(OutArg.Signed)) return false;
+                OutArg.Unsigned = (uint64)OutArg.Signed;
+                OutArg.Double = (double)OutArg.Signed;
+                return true;
+            }
+            case EArgType::UInt64:
+            case EArgType::Pointer:
+            {
+                if (!Reader.Read(OutArg.Unsigned)) return false;
+                OutArg.Signed = (int64)OutArg.Unsigned;
+                OutArg.Double = (double)OutArg.Unsigned;
+                return true;
+            }
+            case EArgType::Double:
+            {
+                if (!Reader.Read(OutArg.Double)) return false;
+                OutArg.Signed = (int64)OutArg.Double;
+                OutArg.Unsigned = (uint64)OutArg.Signed;
+                return true;
+            }
+            case EArgType::String:
+            {
+                uint16 Length = 0;
+                return Reader.Read(Length) && Reader.ReadUTF8(Length, OutArg.String);
+            }
+            default:
+                return false;
+        }
+    }
+
+    FString FormatArg(const FDABinaryLogArg& Arg, TCHAR Conversion, int32 Precision, bool bForceSign)
+    {
+        ANSICHAR Buffer[128];
+        const int32 FloatPrecision = Precision >= 0 ? Precision : 6;
+
+        switch (Conversion)
+        {
+            case TEXT('d'):
+            case TEXT('i'):
+                std::snprintf(Buffer, sizeof(Buffer), bForceSign ? "%+lld" : "%lld", (long long)Arg.Signed);
+                break;
+            case TEXT('u'):
+                std::snprintf(Buffer, sizeof(Buffer), "%llu", (unsigned long long)Arg.Unsigned);
+                break;
+            case TEXT('x'):
+                std::snprintf(Buffer, sizeof(Buffer), "%llx", (unsigned long long)Arg.Unsigned);
+                break;
+            case TEXT('X'):
+                std::snprintf(Buffer, sizeof(Buffer), "%llX", (unsigned long long)Arg.Unsigned);
+                break;
+            case TEXT('o'):
+                std::snprintf(Buffer, sizeof(Buffer), "%llo", (unsigned long long)Arg.Unsigned);
+                break;
+            case TEXT('f'):
+            case TEXT('F'):
+                std::snprintf(Buffer, sizeof(Buffer), bForceSign ? "%+.*f" : "%.*f", FloatPrecision, Arg.Double);
+                break;
+            case TEXT('e'):
+                std::snprintf(Buffer, sizeof(Buffer), "%.*e", FloatPrecision, Arg.Double);
+                break;
+            case TEXT('E'):
+                std::snprintf(Buffer, sizeof(Buffer), "%.*E", FloatPrecision, Arg.Double);
+                break;
+            case TEXT('g'):
+                std::snprintf(Buffer, sizeof(Buffer), "%.*g", FloatPrecision, Arg.Double);
+                break;
+            case TEXT('G'):
+                std::snprintf(Buffer, sizeof(Buffer), "%.*G", FloatPrecision, Arg.Double);
+                break;
+            case TEXT('p'):
+                std::snprintf(Buffer, sizeof(Buffer), "0x%016llx", (unsigned long long)Arg.Unsigned);
+                break;
+            case TEXT('c'):
+                return FString::Chr((TCHAR)Arg.Signed);
+            case TEXT('s'):
+            default:
+                if (Arg.Type == DABinaryLog::EArgType::String)
+                {
+                    return Precision >= 0 ? Arg.String.Left(Precision) : Arg.String;
+                }
+                std::snprintf(Buffer, sizeof(Buffer), "%lld", (long long)Arg.Signed);
+                break;
+        }
+
+        return FString(Buffer);
+    }
+
+    FString GetLevelString(uint8 Level)
+    {
+        switch ((EDALogLevel)Level)
+        {
+            case EDALogLevel::Trace: return TEXT("TRACE");
+            case EDALogLevel::Debug: return TEXT("DEBUG");
+            case EDALogLevel::Info: return TEXT("INFO");
+            case EDALogLevel::Warning: return TEXT("WARN");
+            case EDALogLevel::Error: return TEXT("ERROR");
+            case EDALogLevel::Critical: return TEXT("CRIT");
+            default: return TEXT("?");
+        }
+    }
+
+    struct FDABinaryLogRecordView
+    {
+        uint64 Cycles = 0;
+        uint32 FormatId = 0;
+        uint8 Level = 0;
+        uint8 Category = 0;
+        int32 ArgsOffset = 0;
+        int32 ArgsSize = 0;
+    };
+}
+
+FDABinaryLogFormatRegistry& FDABinaryLogFormatRegistry::Get()
+{
+    static FDABinaryLogFormatRegistry Registry;
+    return Registry;
+}
+
+uint32 FDABinaryLogFormatRegistry::Register(const TCHAR* Format, const TCHAR* Function, int32 Line)
+{
+    FScopeLock Lock(&RegistryCriticalSection);
+
+    FDABinaryLogFormat& NewFormat = Formats.AddDefaulted_GetRef();
+    NewFormat.Format = Format;
+    NewFormat.Function = Function;
+    NewFormat.Line = Line;
+    return (uint32)(Formats.Num() - 1);
+}
+
+bool FDABinaryLogFormatRegistry::Find(uint32 FormatId, FDABinaryLogFormat& OutFormat) const
+{
+    FScopeLock Lock(&RegistryCriticalSection);
+
+    if (!Formats.IsValidIndex((int32)FormatId))
+    {
+        return false;
+    }
+    OutFormat = Formats[FormatId];
+    return true;
+}
+
+int32 FDABinaryLogFormatRegistry::Num() const
+{
+    FScopeLock Lock(&RegistryCriticalSection);
+    return Formats.Num();
+}
+
+void FDABinaryLogFormatRegistry::CopyFormats(int32 FirstId, TArray<FDABinaryLogFormat>& OutFormats) const
+{
+    FScopeLock Lock(&RegistryCriticalSection);
+
+    for (int32 Index = FMath::Max(0, FirstId); Index < Formats.Num(); Index++)
+    {
+        OutFormats.Add(Formats[Index]);
+    }
+}
+
+FString FDABinaryLogDecoder::FormatMessage(const FString& Format, const uint8* Args, int32 ArgsSize)
+{
+    FDABinaryLogReader Reader{Args, ArgsSize, 0};
+    FString Result;
+    Result.Reserve(Format.Len() + ArgsSize);
+
+    const TCHAR* Cursor = *Format;
+    while (*Cursor)
+    {
+        if (*Cursor != TEXT('%'))
+        {
+            Result.AppendChar(*Cursor++);
+            continue;
+        }
+
+        ++Cursor;
+        if (*Cursor == TEXT('%'))
+        {
+            Result.AppendChar(TEXT('%'));
+            ++Cursor;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conversion
+        bool bLeftAlign = false;
+        bool bZeroPad = false;
+        bool bForceSign = false;
+        for (; *Cursor == TEXT('-') || *Cursor == TEXT('0') || *Cursor == TEXT('+') || *Cursor == TEXT(' ') || *Cursor == TEXT('#'); ++Cursor)
+        {
+            bLeftAlign |= *Cursor == TEXT('-');
+            bZeroPad |= *Cursor == TEXT('0');
+            bForceSign |= *Cursor == TEXT('+');
+        }
+
+        int32 Width = 0;
+        for (; FChar::IsDigit(*Cursor); ++Cursor)
+        {
+            Width = Width * 10 + (*Cursor - TEXT('0'));
+        }
+
+        int32 Precision = -1;
+        if (*Cursor == TEXT('.'))
+        {
+            Precision = 0;
+            for (++Cursor; FChar::IsDigit(*Cursor); ++Cursor)
+            {
+                Precision = Precision * 10 + (*Cursor - TEXT('0'));
+            }
+        }
+
+        while (*Cursor == TEXT('l') || *Cursor == TEXT('h') || *Cursor == TEXT('z') || *Cursor == TEXT('j') || *Cursor == TEXT('t') || *Cursor == TEXT('L') || *Cursor == TEXT('I') || *Cursor == TEXT('6') || *Cursor == TEXT('4'))
+        {
+            ++Cursor;
+        }
+
+        if (!*Cursor)
+        {
+            break;
+        }
+        const TCHAR Conversion = *Cursor++;
+
+        FDABinaryLogArg Arg;
+        FString Formatted = ReadArg(Reader, Arg) ? FormatArg(Arg, Conversion, Precision, bForceSign) : FString(TEXT("<missing>"));
+
+        // Apply field width
+        const int32 Padding = Width - Formatted.Len();
+        if (Padding > 0)
+        {
+            if (bLeftAlign)
+            {
+                Formatted += FString::ChrN(Padding, TEXT(' '));
+            }
+            else if (bZeroPad && Conversion != TEXT('s') && Conversion != TEXT('c'))
+            {
+                const int32 SignLength = (Formatted.StartsWith(TEXT("-")) || Formatted.StartsWith(TEXT("+"))) ? 1 : 0;
+                Formatted.InsertAt(SignLength, FString::ChrN(Padding, TEXT('0')));
+            }
+            else
+            {
+                Formatted = FString::ChrN(Padding, TEXT(' ')) + Formatted;
+            }
+        }
+
+        Result += Formatted;
+    }
+
+    return Result;
+}
+
+bool FDABinaryLogDecoder::DecodeFile(const FString& InputPath, const FString& OutputPath, int32& OutRecordCount)
+{
+    OutRecordCount = 0;
+
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *InputPath))
+    {
+        UE_LOG(LogDarkAge, Error, TEXT("Could not read binary log %s"), *InputPath);
+        return false;
+    }
+
+    FDABinaryLogReader Reader{FileData.GetData(), FileData.Num(), 0};
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    double SecondsPerCycle = 0.0;
+    int64 StartTicks = 0;
+    uint64 StartCycles = 0;
+    if (!Reader.Read(Magic) || Magic != DABinaryLog::FileMagic || !Reader.Read(Version) || Version != DABinaryLog::FileVersion
+        || !Reader.Read(SecondsPerCycle) || !Reader.Read(StartTicks) || !Reader.Read(StartCycles))
+    {
+        UE_LOG(LogDarkAge, Error, TEXT("%s is not a DarkAge binary log (or has an unsupported version)"), *InputPath);
+        return false;
+    }
+
+    TArray<FDABinaryLogFormat> Formats;
+    TArray<FDABinaryLogRecordView> Records;
+
+    // A crash can leave a partial block at the end; everything before it is still decoded
+    uint8 BlockType = 0;
+    uint32 BlockSize = 0;
+    while (Reader.Read(BlockType) && Reader.Read(BlockSize) && Reader.Offset + (int64)BlockSize <= Reader.Size)
+    {
+        const int32 BlockEnd = Reader.Offset + (int32)BlockSize;
+
+        if (BlockType == DABinaryLog::FormatBlock)
+        {
+            FDABinaryLogReader BlockReader{FileData.GetData(), BlockEnd, Reader.Offset};
+            uint32 FormatId = 0;
+            FDABinaryLogFormat Format;
+            while (BlockReader.Read(FormatId) && BlockReader.Read(Format.Line) && BlockReader.ReadString(Format.Format) && BlockReader.ReadString(Format.Function))
+            {
+                if (Formats.Num() <= (int32)FormatId)
+                {
+                    Formats.SetNum(FormatId + 1);
+                }
+                Formats[FormatId] = Format;
+            }
+        }
+        else if (BlockType == DABinaryLog::RecordBlock)
+        {
+            int32 RecordOffset = Reader.Offset;
+            while (RecordOffset + DABinaryLog::RecordHeaderSize <= BlockEnd)
+            {
+                FDABinaryLogReader RecordReader{FileData.GetData(), BlockEnd, RecordOffset};
+                uint16 RecordSize = 0;
+                FDABinaryLogRecordView Record;
+                RecordReader.Read(RecordSize);
+                if (RecordSize < DABinaryLog::RecordHeaderSize || RecordOffset + RecordSize > BlockEnd)
+                {
+                    break;
+                }
+                RecordReader.Read(Record.FormatId);
+                RecordReader.Read(Record.Cycles);
+                RecordReader.Read(Record.Level);
+                RecordReader.Read(Record.Category);
+                Record.ArgsOffset = RecordReader.Offset;
+                Record.ArgsSize = RecordOffset + RecordSize - RecordReader.Offset;
+                Records.Add(Record);
+
+                RecordOffset += RecordSize;
+            }
+        }
+
+        Reader.Offset = BlockEnd;
+    }
+
+    // Blocks hold per-thread batches; restore global order
+    Records.StableSort([](const FDABinaryLogRecordView& A, const FDABinaryLogRecordView& B) { return A.Cycles < B.Cycles; });
+
+    const FDateTime StartTime(StartTicks);
+    FString Output;
+    Output.Reserve(Records.Num() * 96);
+
+    for (const FDABinaryLogRecordView& Record : Records)
+    {
+        const FDateTime Timestamp = StartTime + FTimespan::FromSeconds((double)(int64)(Record.Cycles - StartCycles) * SecondsPerCycle);
+
+        FString CategoryString = UEnum::GetValueAsString((EDALogCategory)Record.Category);
+        CategoryString = CategoryString.Replace(TEXT("EDALogCategory::"), TEXT(""));
+
+        const bool bKnownFormat = Formats.IsValidIndex((int32)Record.FormatId);
+        const FString Message = bKnownFormat
+            ? FormatMessage(Formats[Record.FormatId].Format, FileData.GetData() + Record.ArgsOffset, Record.ArgsSize)
+            : FString::Printf(TEXT("<unknown format %u>"), Record.FormatId);
+
+        Output += FString::Printf(TEXT("[%s] [%s] [%s] %s"),
+            *Timestamp.ToString(TEXT("%Y-%m-%d %H:%M:%S")),
+            *GetLevelString(Record.Level),
+            *CategoryString,
+            *Message
+        );
+
+        if (bKnownFormat && !Formats[Record.FormatId].Function.IsEmpty())
+        {
+            Output += FString::Printf(TEXT(" [%s:%d]"), *Formats[Record.FormatId].Function, Formats[Record.FormatId].Line);
+        }
+
+        Output += TEXT("\n");
+    }
+
+    OutRecordCount = Records.Num();
+    return FFileHelper::SaveStringToFile(Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
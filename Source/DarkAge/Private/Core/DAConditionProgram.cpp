@@ -0,0 +1,171 @@
+#include "Core/DAConditionProgram.h"
+#include "Core/DAStatLayout.h"
+#include "Components/DAQuestLogComponent.h"
+#include "Components/InventoryComponent.h"
+#include "Components/StatlineComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+
+void FDAConditionContext::Bind(const AActor* InSubject)
+{
+    Reset();
+
+    const AController* Controller = Cast<AController>(InSubject);
+    const AActor* Character = Controller ? Controller->GetPawn() : InSubject;
+    if (!Character)
+    {
+        return;
+    }
+
+    if (!Controller)
+    {
+        if (const APawn* Pawn = Cast<APawn>(Character))
+        {
+            Controller = Pawn->GetController();
+        }
+    }
+
+    Subject = Character;
+    Inventory = Character->FindComponentByClass<UInventoryComponent>();
+    Statline = Character->FindComponentByClass<UStatlineComponent>();
+
+    const UDAQuestLogComponent* FoundQuestLog = Character->FindComponentByClass<UDAQuestLogComponent>();
+    if (!FoundQuestLog && Controller)
+    {
+        FoundQuestLog = Controller->FindComponentByClass<UDAQuestLogComponent>();
+    }
+    QuestLog = FoundQuestLog;
+}
+
+int32 FDAConditionProgram::CompileClause(TConstArrayView<FQuestCondition> Conditions)
+{
+    FClause& Clause = Clauses.AddDefaulted_GetRef();
+    Clause.FirstInstruction = Instructions.Num();
+    Clause.NumInstructions = Conditions.Num();
+
+    for (const FQuestCondition& Condition : Conditions)
+    {
+        FInstruction& Instruction = Instructions.AddDefaulted_GetRef();
+        Instruction.Compare = Condition.Operator;
+        Instruction.Value = Condition.Value;
+        Instruction.Target = Condition.TargetID;
+
+        switch (Condition.ConditionType)
+        {
+        case EQuestConditionType::QCT_HasItem:
+            Instruction.Op = EOp::ItemCount;
+            break;
+        case EQuestConditionType::QCT_SkillLevel:
+            Instruction.Op = EOp::StatValue;
+            Instruction.Operand = FDAStatLayout::Get().RegisterStat(Condition.TargetID);
+            break;
+        case EQuestConditionType::QCT_FactionReputation:
+            Instruction.Op = EOp::FactionReputation;
+            break;
+        case EQuestConditionType::QCT_QuestCompleted:
+            Instruction.Op = EOp::QuestCompleted;
+            break;
+        default:
+            Instruction.Op = EOp::Never;
+            break;
+        }
+    }
+
+    return Clauses.Num() - 1;
+}
+
+int32 FDAConditionProgram::CompileDialogueCondition(const FString& ConditionKey)
+{
+    FClause& Clause = Clauses.AddDefaulted_GetRef();
+    Clause.FirstInstruction = Instructions.Num();
+    Clause.NumInstructions = 1;
+
+    // "HasQuest" and "FactionReputation" carry no target yet, so like any other key they pass.
+    // Keys that gain real checks map to their opcode here, once, instead of per evaluation.
+    FInstruction& Instruction = Instructions.AddDefaulted_GetRef();
+    Instruction.Op = EOp::Always;
+
+    return Clauses.Num() - 1;
+}
+
+bool FDAConditionProgram::Evaluate(int32 ClauseIndex, const FDAConditionContext& Context) const
+{
+    if (!Clauses.IsValidIndex(ClauseIndex))
+    {
+        return false;
+    }
+
+    const FClause& Clause = Clauses[ClauseIndex];
+    for (int32 i = 0; i < Clause.NumInstructions; ++i)
+    {
+        const FInstruction& Instruction = Instructions[Clause.FirstInstruction + i];
+        if (Instruction.Op == EOp::Always)
+        {
+            continue;
+        }
+        if (Instruction.Op == EOp::Never || !Context.HasSubject())
+        {
+            return false;
+        }
+
+        if (!Compare(ReadValue(Instruction, Context), Instruction.Compare, Instruction.Value))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FDAConditionProgram::Reset()
+{
+    Instructions.Reset();
+    Clauses.Reset();
+}
+
+int32 FDAConditionProgram::ReadValue(const FInstruction& Instruction, const FDAConditionContext& Context) const
+{
+    switch (Instruction.Op)
+    {
+    case EOp::ItemCount:
+    {
+        const UInventoryComponent* Inventory = Context.Inventory.Get();
+        return Inventory ? Inventory->GetItemQuantity(Instruction.Target) : 0;
+    }
+    case EOp::StatValue:
+    {
+        const UStatlineComponent* Statline = Context.Statline.Get();
+        return Statline ? static_cast<int32>(Statline->GetCurrentStatValueByIndex(Instruction.Operand)) : 0;
+    }
+    case EOp::FactionReputation:
+        // No per-character faction reputation source yet
+        return 0;
+    case EOp::QuestCompleted:
+    {
+        const UDAQuestLogComponent* QuestLog = Context.QuestLog.Get();
+        return (QuestLog && QuestLog->GetQuestState(Instruction.Target) == EQuestState::QS_Completed) ? 1 : 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+bool FDAConditionProgram::Compare(int32 Lhs, EComparisonOperator Operator, int32 Rhs)
+{
+    switch (Operator)
+    {
+    case EComparisonOperator::CO_EqualTo:
+        return Lhs == Rhs;
+    case EComparisonOperator::CO_NotEqualTo:
+        return Lhs != Rhs;
+    case EComparisonOperator::CO_GreaterThan:
+        return Lhs > Rhs;
+    case EComparisonOperator::CO_LessThan:
+        return Lhs < Rhs;
+    case EComparisonOperator::CO_GreaterThanOrEqualTo:
+        return Lhs >= Rhs;
+    case EComparisonOperator::CO_LessThanOrEqualTo:
+        return Lhs <= Rhs;
+    default:
+        return false;
+    }
+}
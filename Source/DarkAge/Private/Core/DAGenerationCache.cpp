@@ -0,0 +1,169 @@
+#include "Core/DAGenerationCache.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+
+uint64 FDAGenerationCache::MakeKey(TConstArrayView<uint8> KeyBytes)
+{
+    return CityHash64(reinterpret_cast<const char*>(KeyBytes.GetData()), KeyBytes.Num());
+}
+
+void FDAGenerationCache::Open(const FString& InPath, int64 InMaxBytes)
+{
+    Reset();
+    Path = InPath;
+    MaxBytes = InMaxBytes;
+
+    const int64 FileSize = IFileManager::Get().FileSize(*Path);
+    if (FileSize < 0)
+    {
+        // No store yet
+        WriteHeader();
+        bRewrite = true;
+        return;
+    }
+    if (FileSize > MaxBytes || FileSize > MAX_int32 || !FFileHelper::LoadFileToArray(Image, *Path))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GenerationCache: Discarding store '%s' (%lld bytes)."), *Path, FileSize);
+        WriteHeader();
+        bRewrite = true;
+        return;
+    }
+
+    uint32 StoredMagic = 0;
+    uint32 StoredVersion = 0;
+    if (Image.Num() >= HeaderSize)
+    {
+        FMemory::Memcpy(&StoredMagic, Image.GetData(), sizeof(uint32));
+        FMemory::Memcpy(&StoredVersion, Image.GetData() + sizeof(uint32), sizeof(uint32));
+    }
+    if (StoredMagic != Magic || StoredVersion != FormatVersion)
+    {
+        UE_LOG(LogTemp, Log, TEXT("GenerationCache: Store '%s' has an unknown format and will be rebuilt."), *Path);
+        WriteHeader();
+        bRewrite = true;
+        return;
+    }
+
+    int32 Cursor = HeaderSize;
+    while (Cursor + RecordHeaderSize <= Image.Num())
+    {
+        uint64 Key = 0;
+        int32 Size = 0;
+        FMemory::Memcpy(&Key, Image.GetData() + Cursor, sizeof(uint64));
+        FMemory::Memcpy(&Size, Image.GetData() + Cursor + sizeof(uint64), sizeof(int32));
+
+        const int32 PayloadOffset = Cursor + RecordHeaderSize;
+        if (Size < 0 || Size > Image.Num() - PayloadOffset)
+        {
+            break;
+        }
+
+        Entries.Add(Key, FEntry{ PayloadOffset, Size });
+        Cursor = PayloadOffset + Size;
+    }
+
+    if (Cursor != Image.Num())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GenerationCache: Dropping %d trailing bytes of a partial record in '%s'."), Image.Num() - Cursor, *Path);
+        Image.SetNum(Cursor);
+        bRewrite = true;
+    }
+
+    FlushedBytes = bRewrite ? 0 : Image.Num();
+    UE_LOG(LogTemp, Log, TEXT("GenerationCache: Loaded %d entries (%d bytes) from '%s'."), Entries.Num(), Image.Num(), *Path);
+}
+
+TConstArrayView<uint8> FDAGenerationCache::Find(uint64 Key) const
+{
+    const FEntry* Entry = Entries.Find(Key);
+    return Entry ? TConstArrayView<uint8>(Image.GetData() + Entry->Offset, Entry->Size) : TConstArrayView<uint8>();
+}
+
+bool FDAGenerationCache::Add(uint64 Key, TConstArrayView<uint8> Payload)
+{
+    if (Entries.Contains(Key))
+    {
+        return true;
+    }
+
+    const int32 Size = Payload.Num();
+    const int64 RecordBytes = RecordHeaderSize + static_cast<int64>(Size);
+    if (HeaderSize + RecordBytes > MaxBytes)
+    {
+        return false;
+    }
+
+    if (Image.Num() == 0)
+    {
+        WriteHeader();
+        bRewrite = true;
+    }
+    else if (Image.Num() + RecordBytes > MaxBytes)
+    {
+        // Records can't be removed from an append-only store, so a full one starts over
+        UE_LOG(LogTemp, Log, TEXT("GenerationCache: '%s' reached its %lld byte limit; dropping %d entries."), *Path, MaxBytes, Entries.Num());
+        WriteHeader();
+        bRewrite = true;
+    }
+
+    const int32 RecordOffset = Image.AddUninitialized(RecordHeaderSize + Size);
+    FMemory::Memcpy(Image.GetData() + RecordOffset, &Key, sizeof(uint64));
+    FMemory::Memcpy(Image.GetData() + RecordOffset + sizeof(uint64), &Size, sizeof(int32));
+    if (Size > 0)
+    {
+        FMemory::Memcpy(Image.GetData() + RecordOffset + RecordHeaderSize, Payload.GetData(), Size);
+    }
+
+    Entries.Add(Key, FEntry{ RecordOffset + RecordHeaderSize, Size });
+    return true;
+}
+
+bool FDAGenerationCache::Flush()
+{
+    if (Path.IsEmpty() || GetNumPendingBytes() == 0)
+    {
+        return true;
+    }
+
+    bool bWritten = false;
+    if (bRewrite)
+    {
+        bWritten = FFileHelper::SaveArrayToFile(Image, *Path);
+    }
+    else
+    {
+        const TArrayView<const uint8> Pending(Image.GetData() + FlushedBytes, Image.Num() - FlushedBytes);
+        bWritten = FFileHelper::SaveArrayToFile(Pending, *Path, &IFileManager::Get(), FILEWRITE_Append);
+    }
+
+    if (!bWritten)
+    {
+        UE_LOG(LogTemp, Error, TEXT("GenerationCache: Failed to write '%s'."), *Path);
+        return false;
+    }
+
+    FlushedBytes = Image.Num();
+    bRewrite = false;
+    return true;
+}
+
+void FDAGenerationCache::Reset()
+{
+    Path.Reset();
+    MaxBytes = MAX_int64;
+    Image.Empty();
+    Entries.Empty();
+    FlushedBytes = 0;
+    bRewrite = false;
+}
+
+void FDAGenerationCache::WriteHeader()
+{
+    Image.Reset();
+    Entries.Reset();
+    Image.AddUninitialized(HeaderSize);
+    FMemory::Memcpy(Image.GetData(), &Magic, sizeof(uint32));
+    FMemory::Memcpy(Image.GetData() + sizeof(uint32), &FormatVersion, sizeof(uint32));
+    FlushedBytes = 0;
+}
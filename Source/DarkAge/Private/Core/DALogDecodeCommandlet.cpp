@@ -0,0 +1,40 @@
+// Copyright (c) 2025 RaioCore
+// Offline decoder for DarkAge binary logs
+
+#include "Core/DALogDecodeCommandlet.h"
+#include "Core/DABinaryLog.h"
+#include "Core/DALoggingSubsystem.h"
+#include "Misc/Paths.h"
+
+UDALogDecodeCommandlet::UDALogDecodeCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDALogDecodeCommandlet::Main(const FString& Params)
+{
+    FString InputPath;
+    if (!FParse::Value(*Params, TEXT("Input="), InputPath))
+    {
+        UE_LOG(LogDarkAge, Error, TEXT("Usage: -run=DALogDecode -Input=<file.dalog> [-Output=<file.log>]"));
+        return 1;
+    }
+
+    FString OutputPath;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        OutputPath = FPaths::ChangeExtension(InputPath, TEXT("log"));
+    }
+
+    int32 RecordCount = 0;
+    if (!FDABinaryLogDecoder::DecodeFile(InputPath, OutputPath, RecordCount))
+    {
+        return 1;
+    }
+
+    UE_LOG(LogDarkAge, Display, TEXT("Decoded %d records from %s to %s"), RecordCount, *InputPath, *OutputPath);
+    return 0;
+}
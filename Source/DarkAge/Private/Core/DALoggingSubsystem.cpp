@@ -5,6 +5,9 @@
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Algo/Reverse.h"
 
 // Define log categories
 DEFINE_LOG_CATEGORY(LogDarkAge);
@@ -22,34 +25,129 @@ DEFINE_LOG_CATEGORY(LogDarkAgeNetwork);
 DEFINE_LOG_CATEGORY(LogDarkAgeSecurity);
 DEFINE_LOG_CATEGORY(LogDarkAgePerformance);
 
+namespace
+{
+    // How often the writer drains thread buffers when nobody wakes it
+    constexpr uint32 WriterIntervalMilliseconds = 20;
+
+    // File flush cadence; errors flush immediately
+    constexpr double FileFlushIntervalSeconds = 1.0;
+
+    std::atomic<uint32> NextLoggingInstanceId{1};
+
+    // The calling thread's buffer for each logging instance it has written to. Holding a
+    // reference keeps a buffer alive after its subsystem shuts down, so a producer that raced
+    // Deinitialize still writes into valid memory.
+    struct FCachedThreadBuffer
+    {
+        uint32 InstanceId = 0;
+        TSharedPtr<FDALogThreadBuffer, ESPMode::ThreadSafe> Buffer;
+    };
+    thread_local TArray<FCachedThreadBuffer, TInlineAllocator<2>> CachedThreadBuffers;
+
+    void AppendUTF8(TArray<ANSICHAR>& Out, const FString& Text)
+    {
+        FTCHARToUTF8 Converted(*Text);
+        Out.Append(Converted.Get(), Converted.Length());
+    }
+
+    void AppendBinaryString(TArray<uint8>& Out, const FString& Text)
+    {
+        FTCHARToUTF8 Converted(*Text);
+        DABinaryLog::AppendRaw(Out, (uint32)Converted.Length());
+        Out.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+    }
+
+    void WriteBinaryBlock(FArchive& Archive, uint8 BlockType, TArray<uint8>& Bytes)
+    {
+        uint32 ByteCount = (uint32)Bytes.Num();
+        Archive.Serialize(&BlockType, sizeof(BlockType));
+        Archive.Serialize(&ByteCount, sizeof(ByteCount));
+        Archive.Serialize(Bytes.GetData(), Bytes.Num());
+    }
+}
+
+FDALogThreadBuffer::FDALogThreadBuffer()
+{
+    Slots.SetNum(Capacity);
+    BinarySlots.SetNumUninitialized(BinaryCapacity);
+}
+
+bool FDALogThreadBuffer::TryPush(FDALogEntry&& Entry)
+{
+    const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+    if (CurrentHead - Tail.load(std::memory_order_acquire) >= Capacity)
+    {
+        return false;
+    }
+
+    Slots[CurrentHead % Capacity] = MoveTemp(Entry);
+    Head.store(CurrentHead + 1, std::memory_order_release);
+    return true;
+}
+
+void FDALogThreadBuffer::Drain(TArray<FDALogEntry>& OutEntries)
+{
+    const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+    const uint32 CurrentHead = Head.load(std::memory_order_acquire);
+    for (uint32 Index = CurrentTail; Index != CurrentHead; ++Index)
+    {
+        OutEntries.Add(MoveTemp(Slots[Index % Capacity]));
+    }
+    Tail.store(CurrentHead, std::memory_order_release);
+}
+
+uint32 FDALogThreadBuffer::Num() const
+{
+    return Head.load(std::memory_order_acquire) - Tail.load(std::memory_order_acquire);
+}
+
+bool FDALogThreadBuffer::TryPushBytes(const uint8* Data, uint32 Size)
+{
+    const uint32 CurrentHead = BinaryHead.load(std::memory_order_relaxed);
+    if (BinaryCapacity - (CurrentHead - BinaryTail.load(std::memory_order_acquire)) < Size)
+    {
+        return false;
+    }
+
+    // Copy in up to two pieces around the end of the ring
+    const uint32 Offset = CurrentHead % BinaryCapacity;
+    const uint32 FirstPart = FMath::Min(Size, BinaryCapacity - Offset);
+    FMemory::Memcpy(BinarySlots.GetData() + Offset, Data, FirstPart);
+    FMemory::Memcpy(BinarySlots.GetData(), Data + FirstPart, Size - FirstPart);
+    BinaryHead.store(CurrentHead + Size, std::memory_order_release);
+    return true;
+}
+
+void FDALogThreadBuffer::DrainBytes(TArray<uint8>& OutBytes)
+{
+    const uint32 CurrentTail = BinaryTail.load(std::memory_order_relaxed);
+    const uint32 Count = BinaryHead.load(std::memory_order_acquire) - CurrentTail;
+    const uint32 Offset = CurrentTail % BinaryCapacity;
+    const uint32 FirstPart = FMath::Min(Count, BinaryCapacity - Offset);
+    OutBytes.Append(BinarySlots.GetData() + Offset, FirstPart);
+    OutBytes.Append(BinarySlots.GetData(), Count - FirstPart);
+    BinaryTail.store(CurrentTail + Count, std::memory_order_release);
+}
+
 void UDALoggingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
 
+    InstanceId.store(NextLoggingInstanceId.fetch_add(1), std::memory_order_release);
+    LogHistory.Reserve(MaxLogHistorySize);
+
     // Initialize log file
     if (bFileLoggingEnabled)
     {
-        FString LogDirectory = FPaths::ProjectLogDir() / TEXT("DarkAge");
-        FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
-        LogFilePath = LogDirectory / FString::Printf(TEXT("DarkAge_%s.log"), *Timestamp);
-
-        // Ensure directory exists
-        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-        if (!PlatformFile.DirectoryExists(*LogDirectory))
-        {
-            PlatformFile.CreateDirectoryTree(*LogDirectory);
-        }
-
-        // Open log file
-        LogFileArchive = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*LogFilePath, FILEWRITE_AllowRead));
-        if (LogFileArchive.IsValid())
-        {
-            FString Header = FString::Printf(TEXT("=== DarkAge Log Started at %s ===\n"), *FDateTime::Now().ToString());
-            LogFileArchive->Serialize(TCHAR_TO_UTF8(*Header), Header.Len());
-            LogFileArchive->Flush();
-        }
+        OpenLogFile();
     }
 
+    // Start the background writer
+    bWriterStopRequested = false;
+    WriterWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    WriterThread = FRunnableThread::Create(this, TEXT("DALogWriter"), 0, TPri_BelowNormal);
+
     // Log initialization
     LogMessage(EDALogLevel::Info, EDALogCategory::General, TEXT("DarkAge Logging Subsystem initialized"));
     
@@ -61,54 +159,375 @@ void UDALoggingSubsystem::Deinitialize()
 {
     // Log shutdown
     LogMessage(EDALogLevel::Info, EDALogCategory::General, TEXT("DarkAge Logging Subsystem shutting down"));
+
+    // Stop handing out buffers; entries pushed after the final drain below are dropped
+    {
+        FScopeLock BuffersLock(&ThreadBuffersCriticalSection);
+        InstanceId.store(0, std::memory_order_release);
+    }
     
+    // Stop the writer, then drain whatever it did not get to
+    if (WriterThread)
+    {
+        WriterThread->Kill(true);
+        delete WriterThread;
+        WriterThread = nullptr;
+    }
+    if (WriterWakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WriterWakeEvent);
+        WriterWakeEvent = nullptr;
+    }
+    DrainPendingLogs();
+
+    bBinaryLoggingEnabled = false;
+    if (BinaryLogArchive.IsValid())
+    {
+        BinaryLogArchive->Flush();
+        BinaryLogArchive->Close();
+        BinaryLogArchive.Reset();
+    }
+
     // Flush and close log file
     if (LogFileArchive.IsValid())
     {
-        FString Footer = FString::Printf(TEXT("=== DarkAge Log Ended at %s ===\n"), *FDateTime::Now().ToString());
-        LogFileArchive->Serialize(TCHAR_TO_UTF8(*Footer), Footer.Len());
+        TArray<ANSICHAR> Footer;
+        AppendUTF8(Footer, FString::Printf(TEXT("=== DarkAge Log Ended at %s ===\n"), *FDateTime::Now().ToString()));
+        LogFileArchive->Serialize(Footer.GetData(), Footer.Num());
         LogFileArchive->Flush();
         LogFileArchive->Close();
         LogFileArchive.Reset();
     }
 
+    // Threads still caching a buffer keep it alive and free it the next time they register one
+    {
+        FScopeLock BuffersLock(&ThreadBuffersCriticalSection);
+        for (const TSharedPtr<FDALogThreadBuffer, ESPMode::ThreadSafe>& Buffer : ThreadBuffers)
+        {
+            Buffer->bRetired.store(true, std::memory_order_release);
+        }
+        ThreadBuffers.Empty();
+    }
+
     UE_LOG(LogDarkAge, Log, TEXT("DarkAge Logging Subsystem deinitialized"));
     
     Super::Deinitialize();
 }
 
-void UDALoggingSubsystem::LogMessage(EDALogLevel Level, EDALogCategory Category, const FString& Message, const FString& Context)
+uint32 UDALoggingSubsystem::Run()
 {
-    LogMessageWithSource(Level, Category, Message, Context, TEXT(""), 0);
+    while (!bWriterStopRequested)
+    {
+        WriterWakeEvent->Wait(WriterIntervalMilliseconds);
+        DrainPendingLogs();
+    }
+    return 0;
 }
 
-void UDALoggingSubsystem::LogMessageWithSource(EDALogLevel Level, EDALogCategory Category, const FString& Message, const FString& Context, const FString& Function, int32 Line)
+void UDALoggingSubsystem::Stop()
+{
+    bWriterStopRequested = true;
+    if (WriterWakeEvent)
+    {
+        WriterWakeEvent->Trigger();
+    }
+}
+
+FDALogThreadBuffer* UDALoggingSubsystem::GetThreadBuffer()
+{
+    const uint32 CurrentInstanceId = InstanceId.load(std::memory_order_acquire);
+    if (CurrentInstanceId == 0)
+    {
+        return nullptr;
+    }
+
+    for (const FCachedThreadBuffer& Cached : CachedThreadBuffers)
+    {
+        if (Cached.InstanceId == CurrentInstanceId)
+        {
+            return Cached.Buffer.Get();
+        }
+    }
+
+    // First log from this thread to this instance: release buffers of instances that have shut
+    // down, then register a new one. Buffers live until Deinitialize, so a thread that exits
+    // simply leaves an empty ring behind.
+    CachedThreadBuffers.RemoveAllSwap([](const FCachedThreadBuffer& Cached)
+    {
+        return Cached.Buffer->bRetired.load(std::memory_order_acquire);
+    });
+
+    FScopeLock BuffersLock(&ThreadBuffersCriticalSection);
+    if (InstanceId.load(std::memory_order_relaxed) != CurrentInstanceId)
+    {
+        return nullptr;
+    }
+
+    FCachedThreadBuffer& Cached = CachedThreadBuffers.AddDefaulted_GetRef();
+    Cached.InstanceId = CurrentInstanceId;
+    Cached.Buffer = MakeShared<FDALogThreadBuffer, ESPMode::ThreadSafe>();
+    ThreadBuffers.Add(Cached.Buffer);
+    return Cached.Buffer.Get();
+}
+
+void UDALoggingSubsystem::DrainPendingLogs()
 {
     FScopeLock Lock(&LogCriticalSection);
 
-    // Create log entry
-    FDALogEntry LogEntry(Level, Category, Message, Context, Function, Line);
+    TArray<FDALogEntry> Batch;
+    {
+        FScopeLock BuffersLock(&ThreadBuffersCriticalSection);
+        for (const TSharedPtr<FDALogThreadBuffer, ESPMode::ThreadSafe>& Buffer : ThreadBuffers)
+        {
+            Buffer->Drain(Batch);
+            Buffer->DrainBytes(PendingBinaryWrite);
+        }
+    }
+
+    // Errors are the only binary records formatted as they are logged, and they flush the file straight away
+    if (PendingBinaryWrite.Num() > 0 && EmitBinaryErrors(PendingBinaryWrite))
+    {
+        bPendingFileFlush = true;
+    }
+
+    // Binary records go out as-is, preceded by any formats registered since the last block
+    if (BinaryLogArchive.IsValid() && PendingBinaryWrite.Num() > 0)
+    {
+        TArray<FDABinaryLogFormat> NewFormats;
+        FDABinaryLogFormatRegistry::Get().CopyFormats(BinaryFormatsWritten, NewFormats);
+        if (NewFormats.Num() > 0)
+        {
+            TArray<uint8> FormatBytes;
+            for (const FDABinaryLogFormat& Format : NewFormats)
+            {
+                DABinaryLog::AppendRaw(FormatBytes, (uint32)BinaryFormatsWritten++);
+                DABinaryLog::AppendRaw(FormatBytes, Format.Line);
+                AppendBinaryString(FormatBytes, Format.Format);
+                AppendBinaryString(FormatBytes, Format.Function);
+            }
+            WriteBinaryBlock(*BinaryLogArchive, DABinaryLog::FormatBlock, FormatBytes);
+        }
+
+        WriteBinaryBlock(*BinaryLogArchive, DABinaryLog::RecordBlock, PendingBinaryWrite);
+    }
+    PendingBinaryWrite.Reset();
+
+    // Merge per-thread batches back into global order
+    Batch.StableSort([](const FDALogEntry& A, const FDALogEntry& B) { return A.Timestamp < B.Timestamp; });
+
+    const int32 Dropped = DroppedLogCount.exchange(0);
+    if (Dropped > 0 && bFileLoggingEnabled)
+    {
+        AppendUTF8(PendingFileWrite, FString::Printf(TEXT("[%s] [WARN] [General] %d log entries dropped (thread buffer full)\n"),
+            *FDateTime::Now().ToString(TEXT("%Y-%m-%d %H:%M:%S")), Dropped));
+    }
+
+    for (FDALogEntry& LogEntry : Batch)
+    {
+        TotalLogCount++;
+
+        // Update statistics
+        if (LogEntry.Level == EDALogLevel::Error || LogEntry.Level == EDALogLevel::Critical)
+        {
+            ErrorLogCount++;
+            bPendingFileFlush = true;
+        }
+        else if (LogEntry.Level == EDALogLevel::Warning)
+        {
+            WarningLogCount++;
+        }
+
+        // Write to file if enabled and level is high enough
+        if (bFileLoggingEnabled && LogEntry.Level >= FileLogLevel)
+        {
+            WriteToFile(LogEntry);
+        }
+
+        // Maintain history size
+        if (LogHistory.Num() >= MaxLogHistorySize)
+        {
+            LogHistory.PopFront();
+        }
+        LogHistory.Add(MoveTemp(LogEntry));
+    }
+
+    // One write per drain rather than one per entry
+    if (LogFileArchive.IsValid() && PendingFileWrite.Num() > 0)
+    {
+        LogFileArchive->Serialize(PendingFileWrite.GetData(), PendingFileWrite.Num());
+    }
+    PendingFileWrite.Reset();
+
+    const double Now = FPlatformTime::Seconds();
+    if (bPendingFileFlush || Now - LastFileFlushTime >= FileFlushIntervalSeconds)
+    {
+        if (LogFileArchive.IsValid())
+        {
+            LogFileArchive->Flush();
+        }
+        if (BinaryLogArchive.IsValid())
+        {
+            BinaryLogArchive->Flush();
+        }
+        LastFileFlushTime = Now;
+        bPendingFileFlush = false;
+    }
+}
+
+void UDALoggingSubsystem::OpenLogFile()
+{
+    FString LogDirectory = FPaths::ProjectLogDir() / TEXT("DarkAge");
+    FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+    LogFilePath = LogDirectory / FString::Printf(TEXT("DarkAge_%s.log"), *Timestamp);
+
+    // Ensure directory exists
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.DirectoryExists(*LogDirectory))
+    {
+        PlatformFile.CreateDirectoryTree(*LogDirectory);
+    }
+
+    // Open log file
+    LogFileArchive = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*LogFilePath, FILEWRITE_AllowRead));
+    if (LogFileArchive.IsValid())
+    {
+        TArray<ANSICHAR> Header;
+        AppendUTF8(Header, FString::Printf(TEXT("=== DarkAge Log Started at %s ===\n"), *FDateTime::Now().ToString()));
+        LogFileArchive->Serialize(Header.GetData(), Header.Num());
+        LogFileArchive->Flush();
+        LastFileFlushTime = FPlatformTime::Seconds();
+    }
+}
+
+void UDALoggingSubsystem::OpenBinaryLogFile()
+{
+    FString LogDirectory = FPaths::ProjectLogDir() / TEXT("DarkAge");
+    FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+    BinaryLogFilePath = LogDirectory / FString::Printf(TEXT("DarkAge_%s.dalog"), *Timestamp);
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.DirectoryExists(*LogDirectory))
+    {
+        PlatformFile.CreateDirectoryTree(*LogDirectory);
+    }
+
+    BinaryLogArchive = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*BinaryLogFilePath, FILEWRITE_AllowRead));
+    BinaryFormatsWritten = 0;
+    if (BinaryLogArchive.IsValid())
+    {
+        // Header anchors record cycle counts to wall-clock time for the decoder
+        uint32 Magic = DABinaryLog::FileMagic;
+        uint32 Version = DABinaryLog::FileVersion;
+        double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+        int64 StartTicks = FDateTime::Now().GetTicks();
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        *BinaryLogArchive << Magic << Version << SecondsPerCycle << StartTicks << StartCycles;
+        BinaryLogArchive->Flush();
+    }
+}
+
+void UDALoggingSubsystem::SetBinaryLoggingEnabled(bool bEnabled)
+{
+    if (bEnabled == IsBinaryLoggingEnabled())
+    {
+        return;
+    }
 
-    // Add to history
-    LogHistory.Add(LogEntry);
-    TotalLogCount++;
+    if (bEnabled)
+    {
+        {
+            FScopeLock Lock(&LogCriticalSection);
+            if (!BinaryLogArchive.IsValid())
+            {
+                OpenBinaryLogFile();
+            }
+        }
+        bBinaryLoggingEnabled = true;
+    }
+    else
+    {
+        bBinaryLoggingEnabled = false;
 
-    // Update statistics
-    if (Level == EDALogLevel::Error || Level == EDALogLevel::Critical)
+        // Write out what is already queued, then close the file
+        DrainPendingLogs();
+        FScopeLock Lock(&LogCriticalSection);
+        if (BinaryLogArchive.IsValid())
+        {
+            BinaryLogArchive->Close();
+            BinaryLogArchive.Reset();
+        }
+    }
+
+    UE_LOG(LogDarkAge, Log, TEXT("Binary logging %s%s"), bEnabled ? TEXT("enabled: ") : TEXT("disabled"), bEnabled ? *BinaryLogFilePath : TEXT(""));
+}
+
+void UDALoggingSubsystem::SubmitBinaryRecord(const uint8* Data, int32 Size, EDALogLevel Level, EDALogCategory Category)
+{
+    // No buffer once the subsystem has shut down, in which case the record is dropped
+    FDALogThreadBuffer* Buffer = GetThreadBuffer();
+    if (!Buffer)
     {
-        ErrorLogCount++;
+        return;
     }
-    else if (Level == EDALogLevel::Warning)
+    if (!Buffer->TryPushBytes(Data, (uint32)Size))
     {
-        WarningLogCount++;
+        DroppedLogCount.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
 
-    // Maintain history size
-    if (LogHistory.Num() > MaxLogHistorySize)
+    // Only bytes are pushed here; the writer formats errors for the console, so just wake it now
+    if (WriterWakeEvent && (Level >= EDALogLevel::Error
+        || Buffer->BinaryHead.load(std::memory_order_relaxed) - Buffer->BinaryTail.load(std::memory_order_relaxed) >= FDALogThreadBuffer::BinaryCapacity / 2))
     {
-        LogHistory.RemoveAt(0, LogHistory.Num() - MaxLogHistorySize);
+        WriterWakeEvent->Trigger();
     }
+}
 
+bool UDALoggingSubsystem::EmitBinaryErrors(TConstArrayView<uint8> Records)
+{
+    constexpr int32 LevelOffset = sizeof(uint16) + sizeof(uint32) + sizeof(uint64);
+
+    // Records are length-prefixed, so everything but the errors is skipped without decoding
+    bool bFoundError = false;
+    int32 Offset = 0;
+    while (Offset + DABinaryLog::RecordHeaderSize <= Records.Num())
+    {
+        const uint8* Record = Records.GetData() + Offset;
+        uint16 RecordSize = 0;
+        FMemory::Memcpy(&RecordSize, Record, sizeof(RecordSize));
+        if (RecordSize < DABinaryLog::RecordHeaderSize || Offset + RecordSize > Records.Num())
+        {
+            break;
+        }
+
+        const EDALogLevel Level = (EDALogLevel)Record[LevelOffset];
+        if (Level >= EDALogLevel::Error)
+        {
+            bFoundError = true;
+
+            uint32 FormatId = 0;
+            FMemory::Memcpy(&FormatId, Record + sizeof(uint16), sizeof(FormatId));
+
+            FDABinaryLogFormat Format;
+            if (FDABinaryLogFormatRegistry::Get().Find(FormatId, Format))
+            {
+                const EDALogCategory Category = (EDALogCategory)Record[LevelOffset + 1];
+                const FString Message = FDABinaryLogDecoder::FormatMessage(Format.Format, Record + DABinaryLog::RecordHeaderSize, RecordSize - DABinaryLog::RecordHeaderSize);
+                LogMessageWithSource(Level, Category, Message, TEXT(""), Format.Function, Format.Line);
+            }
+        }
+        Offset += RecordSize;
+    }
+    return bFoundError;
+}
+
+void UDALoggingSubsystem::LogMessage(EDALogLevel Level, EDALogCategory Category, const FString& Message, const FString& Context)
+{
+    LogMessageWithSource(Level, Category, Message, Context, TEXT(""), 0);
+}
+
+void UDALoggingSubsystem::LogMessageWithSource(EDALogLevel Level, EDALogCategory Category, const FString& Message, const FString& Context, const FString& Function, int32 Line)
+{
     // Output to console if level is high enough
     if (Level >= ConsoleLogLevel)
     {
@@ -193,15 +612,26 @@ void UDALoggingSubsystem::LogMessageWithSource(EDALogLevel Level, EDALogCategory
         }
     }
 
-    // Write to file if enabled and level is high enough
-    if (bFileLoggingEnabled && Level >= FileLogLevel)
+    // Hand off to the writer; history, statistics and file output are all updated there
+    FDALogThreadBuffer* Buffer = GetThreadBuffer();
+    if (!Buffer)
+    {
+        return; // Shut down
+    }
+    if (!Buffer->TryPush(FDALogEntry(Level, Category, Message, Context, Function, Line)))
+    {
+        DroppedLogCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (WriterWakeEvent && (Level >= EDALogLevel::Error || Buffer->Num() >= FDALogThreadBuffer::Capacity / 2))
     {
-        WriteToFile(LogEntry);
+        WriterWakeEvent->Trigger();
     }
 }
 
 TArray<FDALogEntry> UDALoggingSubsystem::GetRecentLogs(int32 Count, EDALogLevel MinLevel)
 {
+    DrainPendingLogs();
     FScopeLock Lock(&LogCriticalSection);
     
     TArray<FDALogEntry> FilteredLogs;
@@ -220,6 +650,7 @@ TArray<FDALogEntry> UDALoggingSubsystem::GetRecentLogs(int32 Count, EDALogLevel
 
 TArray<FDALogEntry> UDALoggingSubsystem::GetLogsByCategory(EDALogCategory Category, int32 Count)
 {
+    DrainPendingLogs();
     FScopeLock Lock(&LogCriticalSection);
     
     TArray<FDALogEntry> CategoryLogs;
@@ -229,10 +660,12 @@ TArray<FDALogEntry> UDALoggingSubsystem::GetLogsByCategory(EDALogCategory Catego
     {
         if (LogHistory[i].Category == Category)
         {
-            CategoryLogs.Insert(LogHistory[i], 0); // Insert at beginning to maintain chronological order
+            CategoryLogs.Add(LogHistory[i]);
         }
     }
     
+    // Restore chronological order
+    Algo::Reverse(CategoryLogs);
     return CategoryLogs;
 }
 
@@ -247,17 +680,7 @@ void UDALoggingSubsystem::SetFileLoggingEnabled(bool bEnabled)
         if (bEnabled && !LogFileArchive.IsValid())
         {
             // Re-initialize file logging
-            FString LogDirectory = FPaths::ProjectLogDir() / TEXT("DarkAge");
-            FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
-            LogFilePath = LogDirectory / FString::Printf(TEXT("DarkAge_%s.log"), *Timestamp);
-            
-            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-            if (!PlatformFile.DirectoryExists(*LogDirectory))
-            {
-                PlatformFile.CreateDirectoryTree(*LogDirectory);
-            }
-            
-            LogFileArchive = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*LogFilePath, FILEWRITE_AllowRead));
+            OpenLogFile();
         }
         else if (!bEnabled && LogFileArchive.IsValid())
         {
@@ -284,16 +707,16 @@ void UDALoggingSubsystem::SetFileLogLevel(EDALogLevel MinLevel)
 
 void UDALoggingSubsystem::FlushLogs()
 {
-    FScopeLock Lock(&LogCriticalSection);
-    
-    if (LogFileArchive.IsValid())
     {
-        LogFileArchive->Flush();
+        FScopeLock Lock(&LogCriticalSection);
+        bPendingFileFlush = true;
     }
+    DrainPendingLogs();
 }
 
 void UDALoggingSubsystem::GetLoggingStats(int32& TotalLogs, int32& ErrorCount, int32& WarningCount)
 {
+    DrainPendingLogs();
     FScopeLock Lock(&LogCriticalSection);
     
     TotalLogs = TotalLogCount;
@@ -307,7 +730,7 @@ void UDALoggingSubsystem::ClearOldLogs(int32 KeepCount)
     
     if (LogHistory.Num() > KeepCount)
     {
-        LogHistory.RemoveAt(0, LogHistory.Num() - KeepCount);
+        LogHistory.PopFront(LogHistory.Num() - KeepCount);
     }
 }
 
@@ -315,8 +738,7 @@ void UDALoggingSubsystem::WriteToFile(const FDALogEntry& LogEntry)
 {
     if (LogFileArchive.IsValid())
     {
-        FString FormattedEntry = FormatLogEntry(LogEntry);
-        LogFileArchive->Serialize(TCHAR_TO_UTF8(*FormattedEntry), FormattedEntry.Len());
+        AppendUTF8(PendingFileWrite, FormatLogEntry(LogEntry));
     }
 }
 
@@ -0,0 +1,227 @@
+#include "Core/DAProductionBatch.h"
+
+namespace
+{
+    // Copy NumColumns columns of OldStride entries into columns of NewStride entries, zero-filling the tail
+    template <typename T>
+    void Restride(TArray<T>& Columns, int32 NumColumns, int32 OldStride, int32 NewStride)
+    {
+        TArray<T> Widened;
+        Widened.SetNumZeroed(NumColumns * NewStride);
+        if (OldStride > 0)
+        {
+            for (int32 Column = 0; Column < NumColumns; ++Column)
+            {
+                FMemory::Memcpy(Widened.GetData() + Column * NewStride, Columns.GetData() + Column * OldStride, OldStride * sizeof(T));
+            }
+        }
+        Columns = MoveTemp(Widened);
+    }
+}
+
+int32 FDAProductionBatch::FindOrAddItem(FName ItemID)
+{
+    if (const int32* Item = ItemIndices.Find(ItemID))
+    {
+        return *Item;
+    }
+
+    const int32 Item = ItemIDs.Add(ItemID);
+    ItemIndices.Add(ItemID, Item);
+    Stock.AddZeroed(Stride);
+    StepDeltas.AddZeroed(Stride);
+    return Item;
+}
+
+int32 FDAProductionBatch::FindItem(FName ItemID) const
+{
+    const int32* Item = ItemIndices.Find(ItemID);
+    return Item ? *Item : INDEX_NONE;
+}
+
+int32 FDAProductionBatch::AddRecipe(FName RecipeID, TConstArrayView<TPair<FName, int32>> RecipeInputs, FName OutputItemID, int32 OutputQuantity, float CycleSeconds, float YieldRate)
+{
+    if (RecipeID == NAME_None || OutputItemID == NAME_None || OutputQuantity <= 0 || CycleSeconds <= 0.0f || RecipeIndices.Contains(RecipeID))
+    {
+        return INDEX_NONE;
+    }
+
+    FRecipe& Recipe = Recipes.AddDefaulted_GetRef();
+    Recipe.RecipeID = RecipeID;
+    Recipe.FirstInput = Inputs.Num();
+    Recipe.OutputItem = FindOrAddItem(OutputItemID);
+    Recipe.OutputQuantity = OutputQuantity;
+    Recipe.RunsPerWorkerSecond = 1.0f / CycleSeconds;
+    Recipe.Yield = FMath::Clamp(FMath::RoundToInt(YieldRate * YieldScale), 0, YieldScale);
+
+    for (const TPair<FName, int32>& RecipeInput : RecipeInputs)
+    {
+        if (RecipeInput.Key == NAME_None || RecipeInput.Value <= 0)
+        {
+            continue;
+        }
+
+        FInput& Input = Inputs.AddDefaulted_GetRef();
+        Input.Item = FindOrAddItem(RecipeInput.Key);
+        Input.Quantity = RecipeInput.Value;
+        ++Recipe.NumInputs;
+    }
+
+    Workers.AddZeroed(Stride);
+    Progress.AddZeroed(Stride);
+    YieldCarry.AddZeroed(Stride);
+
+    const int32 RecipeIndex = Recipes.Num() - 1;
+    RecipeIndices.Add(RecipeID, RecipeIndex);
+    return RecipeIndex;
+}
+
+int32 FDAProductionBatch::FindRecipe(FName RecipeID) const
+{
+    const int32* Recipe = RecipeIndices.Find(RecipeID);
+    return Recipe ? *Recipe : INDEX_NONE;
+}
+
+int32 FDAProductionBatch::AddSettlement(FName SettlementID, FName RegionID)
+{
+    if (const int32* Existing = SettlementIndices.Find(SettlementID))
+    {
+        SettlementRegions[*Existing] = RegionID;
+        return *Existing;
+    }
+
+    Reserve(SettlementIDs.Num() + 1);
+
+    const int32 Settlement = SettlementIDs.Add(SettlementID);
+    SettlementRegions.Add(RegionID);
+    SettlementIndices.Add(SettlementID, Settlement);
+    return Settlement;
+}
+
+int32 FDAProductionBatch::FindSettlement(FName SettlementID) const
+{
+    const int32* Settlement = SettlementIndices.Find(SettlementID);
+    return Settlement ? *Settlement : INDEX_NONE;
+}
+
+void FDAProductionBatch::SetWorkers(int32 Settlement, int32 Recipe, int32 NumWorkers)
+{
+    check(SettlementIDs.IsValidIndex(Settlement) && Recipes.IsValidIndex(Recipe));
+    Workers[Recipe * Stride + Settlement] = FMath::Max(0, NumWorkers);
+}
+
+void FDAProductionBatch::AddStock(int32 Settlement, int32 Item, int32 Quantity)
+{
+    check(SettlementIDs.IsValidIndex(Settlement) && ItemIDs.IsValidIndex(Item));
+    int32& Held = Stock[Item * Stride + Settlement];
+    Held = FMath::Max(0, Held + Quantity);
+}
+
+void FDAProductionBatch::Step(float DeltaSeconds)
+{
+    FMemory::Memzero(StepDeltas.GetData(), StepDeltas.Num() * sizeof(int32));
+
+    const int32 NumActive = SettlementIDs.Num();
+    if (DeltaSeconds <= 0.0f || NumActive == 0)
+    {
+        return;
+    }
+
+    for (int32 RecipeIndex = 0; RecipeIndex < Recipes.Num(); ++RecipeIndex)
+    {
+        const FRecipe& Recipe = Recipes[RecipeIndex];
+        const float RunsPerWorker = Recipe.RunsPerWorkerSecond * DeltaSeconds;
+        const FInput* RecipeInputs = Inputs.GetData() + Recipe.FirstInput;
+
+        const int32* RecipeWorkers = Workers.GetData() + RecipeIndex * Stride;
+        float* RecipeProgress = Progress.GetData() + RecipeIndex * Stride;
+        int32* RecipeYieldCarry = YieldCarry.GetData() + RecipeIndex * Stride;
+        int32* OutputStock = Stock.GetData() + Recipe.OutputItem * Stride;
+        int32* OutputDeltas = StepDeltas.GetData() + Recipe.OutputItem * Stride;
+
+        for (int32 Settlement = 0; Settlement < NumActive; ++Settlement)
+        {
+            if (RecipeWorkers[Settlement] <= 0)
+            {
+                continue;
+            }
+
+            float& RunProgress = RecipeProgress[Settlement];
+            RunProgress += RecipeWorkers[Settlement] * RunsPerWorker;
+            const int32 RunsDue = FMath::FloorToInt(RunProgress);
+            if (RunsDue <= 0)
+            {
+                continue;
+            }
+
+            int32 Runs = RunsDue;
+            for (int32 InputIndex = 0; InputIndex < Recipe.NumInputs; ++InputIndex)
+            {
+                const FInput& Input = RecipeInputs[InputIndex];
+                Runs = FMath::Min(Runs, Stock[Input.Item * Stride + Settlement] / Input.Quantity);
+            }
+
+            RunProgress -= Runs;
+            if (Runs < RunsDue)
+            {
+                // Starved workers don't bank the time they spent idle
+                RunProgress = FMath::Min(RunProgress, 1.0f);
+            }
+            if (Runs <= 0)
+            {
+                continue;
+            }
+
+            for (int32 InputIndex = 0; InputIndex < Recipe.NumInputs; ++InputIndex)
+            {
+                const FInput& Input = RecipeInputs[InputIndex];
+                const int32 Consumed = Runs * Input.Quantity;
+                Stock[Input.Item * Stride + Settlement] -= Consumed;
+                StepDeltas[Input.Item * Stride + Settlement] -= Consumed;
+            }
+
+            const int64 YieldParts = static_cast<int64>(Runs) * Recipe.OutputQuantity * Recipe.Yield + RecipeYieldCarry[Settlement];
+            const int32 Produced = static_cast<int32>(YieldParts / YieldScale);
+            RecipeYieldCarry[Settlement] = static_cast<int32>(YieldParts % YieldScale);
+            OutputStock[Settlement] += Produced;
+            OutputDeltas[Settlement] += Produced;
+        }
+    }
+}
+
+void FDAProductionBatch::GetStockChanges(TArray<FStockChange>& OutChanges) const
+{
+    OutChanges.Reset();
+    for (int32 Item = 0; Item < ItemIDs.Num(); ++Item)
+    {
+        const int32* ItemDeltas = StepDeltas.GetData() + Item * Stride;
+        for (int32 Settlement = 0; Settlement < SettlementIDs.Num(); ++Settlement)
+        {
+            if (ItemDeltas[Settlement] != 0)
+            {
+                OutChanges.Add({ Settlement, Item, ItemDeltas[Settlement] });
+            }
+        }
+    }
+}
+
+void FDAProductionBatch::Reset()
+{
+    *this = FDAProductionBatch();
+}
+
+void FDAProductionBatch::Reserve(int32 MinSettlements)
+{
+    if (MinSettlements <= Stride)
+    {
+        return;
+    }
+
+    const int32 NewStride = FMath::Max(8, static_cast<int32>(FMath::RoundUpToPowerOfTwo(MinSettlements)));
+    Restride(Stock, ItemIDs.Num(), Stride, NewStride);
+    Restride(StepDeltas, ItemIDs.Num(), Stride, NewStride);
+    Restride(Workers, Recipes.Num(), Stride, NewStride);
+    Restride(Progress, Recipes.Num(), Stride, NewStride);
+    Restride(YieldCarry, Recipes.Num(), Stride, NewStride);
+    Stride = NewStride;
+}
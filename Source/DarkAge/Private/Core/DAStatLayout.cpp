@@ -0,0 +1,45 @@
+#include "Core/DAStatLayout.h"
+
+FDAStatLayout::FDAStatLayout()
+{
+    // Order must match the index constants in the header
+    RegisterStat(FName("Health"));
+    RegisterStat(FName("Stamina"));
+    RegisterStat(FName("Mana"));
+    RegisterStat(FName("Hunger"));
+    RegisterStat(FName("Thirst"));
+}
+
+FDAStatLayout& FDAStatLayout::Get()
+{
+    static FDAStatLayout Instance;
+    return Instance;
+}
+
+int32 FDAStatLayout::RegisterStat(FName StatName)
+{
+    if (StatName.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = IndexByName.Find(StatName))
+    {
+        return *Existing;
+    }
+
+    const int32 StatIndex = StatNames.Add(StatName);
+    IndexByName.Add(StatName, StatIndex);
+    return StatIndex;
+}
+
+int32 FDAStatLayout::FindStatIndex(FName StatName) const
+{
+    const int32* StatIndex = IndexByName.Find(StatName);
+    return StatIndex ? *StatIndex : INDEX_NONE;
+}
+
+FName FDAStatLayout::GetStatName(int32 StatIndex) const
+{
+    return StatNames.IsValidIndex(StatIndex) ? StatNames[StatIndex] : NAME_None;
+}
@@ -0,0 +1,220 @@
+#include "Core/DATickElision.h"
+#include "Components/ActorComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+namespace
+{
+    FAutoConsoleCommand TickReportCommand(
+        TEXT("DA.TickReport"),
+        TEXT("Log tick cost and ticks elided per component class. Pass 'reset' to clear the totals."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+            {
+                FDATickAccounting::Get().Reset();
+                return;
+            }
+            FDATickAccounting::Get().LogReport();
+        }));
+}
+
+void FDATickElision::Initialize(UActorComponent* InComponent, bool bStartIdle)
+{
+    if (!InComponent || bInitialized)
+    {
+        return;
+    }
+
+    Component = InComponent;
+    ClassName = InComponent->GetClass()->GetFName();
+    bInitialized = true;
+    bIdle = false;
+    FDATickAccounting::Get().RecordRegistered(ClassName);
+
+    if (bStartIdle)
+    {
+        Sleep();
+    }
+    else
+    {
+        ApplyTickState();
+    }
+}
+
+void FDATickElision::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    if (bIdle)
+    {
+        FDATickAccounting::Get().RecordIdleEnd(ClassName, IdleElisionRate, IdleStartTime, FPlatformTime::Seconds());
+        bIdle = false;
+    }
+    FDATickAccounting::Get().RecordUnregistered(ClassName);
+    bInitialized = false;
+}
+
+void FDATickElision::Sleep()
+{
+    if (!bInitialized || bIdle)
+    {
+        return;
+    }
+
+    bIdle = true;
+    IdleStartTime = FPlatformTime::Seconds();
+    IdleElisionRate = GetElidedTicksPerSecond();
+    FDATickAccounting::Get().RecordIdleStart(ClassName, IdleElisionRate, IdleStartTime);
+    ApplyTickState();
+}
+
+void FDATickElision::Wake()
+{
+    if (!bInitialized || !bIdle)
+    {
+        return;
+    }
+
+    FDATickAccounting::Get().RecordIdleEnd(ClassName, IdleElisionRate, IdleStartTime, FPlatformTime::Seconds());
+    bIdle = false;
+    ApplyTickState();
+}
+
+void FDATickElision::ApplyTickState() const
+{
+    UActorComponent* TickingComponent = Component.Get();
+    if (!TickingComponent)
+    {
+        return;
+    }
+
+    if (bIdle && IdleTickInterval < 0.0f)
+    {
+        TickingComponent->SetComponentTickEnabled(false);
+        return;
+    }
+
+    TickingComponent->SetComponentTickInterval(bIdle ? IdleTickInterval : ActiveTickInterval);
+    TickingComponent->SetComponentTickEnabled(true);
+}
+
+double FDATickElision::GetElidedTicksPerSecond() const
+{
+    // While awake the component ticks every ActiveTickInterval, but never more often than once a frame
+    const double FrameTime = FApp::GetDeltaTime() > 0.0 ? FApp::GetDeltaTime() : 1.0 / 60.0;
+    const double AwakeInterval = FMath::Max<double>(ActiveTickInterval, FrameTime);
+    const double IdleRate = IdleTickInterval < 0.0f ? 0.0 : 1.0 / FMath::Max<double>(IdleTickInterval, AwakeInterval);
+    return FMath::Max(0.0, 1.0 / AwakeInterval - IdleRate);
+}
+
+FDATickAccounting& FDATickAccounting::Get()
+{
+    static FDATickAccounting Instance;
+    return Instance;
+}
+
+void FDATickAccounting::RecordTick(FName ClassName, uint64 Cycles)
+{
+    FClassStats& ClassStats = Stats.FindOrAdd(ClassName);
+    ++ClassStats.TicksRun;
+    ClassStats.TickCycles += Cycles;
+}
+
+void FDATickAccounting::RecordRegistered(FName ClassName)
+{
+    ++Stats.FindOrAdd(ClassName).NumComponents;
+}
+
+void FDATickAccounting::RecordUnregistered(FName ClassName)
+{
+    --Stats.FindOrAdd(ClassName).NumComponents;
+}
+
+void FDATickAccounting::RecordIdleStart(FName ClassName, double Rate, double StartTime)
+{
+    FClassStats& ClassStats = Stats.FindOrAdd(ClassName);
+    ++ClassStats.NumIdle;
+    ClassStats.OpenElisionRate += Rate;
+    ClassStats.OpenElisionRateTime += Rate * StartTime;
+}
+
+void FDATickAccounting::RecordIdleEnd(FName ClassName, double Rate, double StartTime, double EndTime)
+{
+    FClassStats& ClassStats = Stats.FindOrAdd(ClassName);
+    --ClassStats.NumIdle;
+    ClassStats.OpenElisionRate -= Rate;
+    ClassStats.OpenElisionRateTime -= Rate * StartTime;
+    ClassStats.ElidedTicks += Rate * (EndTime - StartTime);
+}
+
+void FDATickAccounting::LogReport() const
+{
+    struct FReportRow
+    {
+        FName ClassName;
+        const FClassStats* ClassStats;
+        double AvgTickMs;
+        double ElidedTicks;
+    };
+
+    const double Now = FPlatformTime::Seconds();
+    TArray<FReportRow> Rows;
+    for (const TPair<FName, FClassStats>& Pair : Stats)
+    {
+        const FClassStats& ClassStats = Pair.Value;
+        const double AvgTickMs = ClassStats.TicksRun > 0 ? FPlatformTime::ToMilliseconds64(ClassStats.TickCycles) / ClassStats.TicksRun : 0.0;
+        const double ElidedTicks = ClassStats.ElidedTicks + Now * ClassStats.OpenElisionRate - ClassStats.OpenElisionRateTime;
+        Rows.Add({ Pair.Key, &ClassStats, AvgTickMs, ElidedTicks });
+    }
+
+    Rows.Sort([](const FReportRow& A, const FReportRow& B)
+    {
+        return A.ElidedTicks * A.AvgTickMs > B.ElidedTicks * B.AvgTickMs;
+    });
+
+    double TotalReclaimedMs = 0.0;
+    UE_LOG(LogTemp, Log, TEXT("=== Component tick report ==="));
+    UE_LOG(LogTemp, Log, TEXT("%-40s %8s %6s %10s %10s %12s %12s"), TEXT("Class"), TEXT("Comps"), TEXT("Idle"), TEXT("Ticks"), TEXT("Avg us"), TEXT("Elided"), TEXT("Saved ms"));
+    for (const FReportRow& Row : Rows)
+    {
+        const double ReclaimedMs = Row.ElidedTicks * Row.AvgTickMs;
+        TotalReclaimedMs += ReclaimedMs;
+        UE_LOG(LogTemp, Log, TEXT("%-40s %8d %6d %10lld %10.2f %12.0f %12.2f"),
+            *Row.ClassName.ToString(),
+            Row.ClassStats->NumComponents,
+            Row.ClassStats->NumIdle,
+            Row.ClassStats->TicksRun,
+            Row.AvgTickMs * 1000.0,
+            Row.ElidedTicks,
+            ReclaimedMs);
+    }
+    UE_LOG(LogTemp, Log, TEXT("Total CPU reclaimed: %.2f ms"), TotalReclaimedMs);
+}
+
+void FDATickAccounting::Reset()
+{
+    const double Now = FPlatformTime::Seconds();
+    for (TPair<FName, FClassStats>& Pair : Stats)
+    {
+        // Keep live component and idle counts; the part of open idle periods before now is cancelled out
+        FClassStats& ClassStats = Pair.Value;
+        ClassStats.TicksRun = 0;
+        ClassStats.TickCycles = 0;
+        ClassStats.ElidedTicks = ClassStats.OpenElisionRateTime - ClassStats.OpenElisionRate * Now;
+    }
+}
+
+FDAScopedTickAccounting::FDAScopedTickAccounting(const UActorComponent* Component)
+    : ClassName(Component ? Component->GetClass()->GetFName() : NAME_None)
+    , StartCycles(FPlatformTime::Cycles64())
+{
+}
+
+FDAScopedTickAccounting::~FDAScopedTickAccounting()
+{
+    FDATickAccounting::Get().RecordTick(ClassName, FPlatformTime::Cycles64() - StartCycles);
+}
@@ -0,0 +1,180 @@
+#include "Core/DATimerWheelSubsystem.h"
+
+void UDATimerWheelSubsystem::Deinitialize()
+{
+    Timers.Empty();
+    for (int32 Level = 0; Level < NUM_LEVELS; ++Level)
+    {
+        for (int32 Slot = 0; Slot < SLOTS_PER_LEVEL; ++Slot)
+        {
+            Wheels[Level][Slot].Empty();
+        }
+    }
+    Overflow.Empty();
+    Super::Deinitialize();
+}
+
+void UDATimerWheelSubsystem::Tick(float DeltaTime)
+{
+    StepAccumulator += DeltaTime;
+
+    while (StepAccumulator >= TIMER_RESOLUTION)
+    {
+        StepAccumulator -= TIMER_RESOLUTION;
+        Step();
+
+        // Nothing left to fire; the wheel position is only meaningful relative to pending timers
+        if (Timers.Num() == 0)
+        {
+            StepAccumulator = 0.0f;
+            break;
+        }
+    }
+}
+
+FDATimerHandle UDATimerWheelSubsystem::Schedule(UObject* Owner, float Delay, FDATimerCallback Callback, float Interval)
+{
+    FDATimerHandle Handle;
+    if (!Callback)
+    {
+        return Handle;
+    }
+
+    Handle.Id = NextTimerId++;
+
+    FTimer& Timer = Timers.Add(Handle.Id);
+    Timer.DueStep = CurrentStep + FMath::Max<uint64>(1, SecondsToSteps(Delay));
+    Timer.IntervalSteps = Interval > 0.0f ? FMath::Max<uint64>(1, SecondsToSteps(Interval)) : 0;
+    Timer.Owner = Owner;
+    Timer.Callback = MoveTemp(Callback);
+
+    InsertTimer(Handle.Id, Timer.DueStep);
+    return Handle;
+}
+
+void UDATimerWheelSubsystem::Cancel(FDATimerHandle& Handle)
+{
+    if (Handle.IsValid())
+    {
+        Timers.Remove(Handle.Id);
+        Handle.Invalidate();
+    }
+}
+
+float UDATimerWheelSubsystem::GetTimeRemaining(const FDATimerHandle& Handle) const
+{
+    const FTimer* Timer = Timers.Find(Handle.Id);
+    if (!Timer)
+    {
+        return -1.0f;
+    }
+    return FMath::Max(0.0f, (Timer->DueStep - CurrentStep) * TIMER_RESOLUTION - StepAccumulator);
+}
+
+void UDATimerWheelSubsystem::InsertTimer(uint64 TimerId, uint64 DueStep)
+{
+    const uint64 Delta = DueStep > CurrentStep ? DueStep - CurrentStep : 0;
+
+    for (int32 Level = 0; Level < NUM_LEVELS; ++Level)
+    {
+        if (Delta < (1ull << (LEVEL_BITS * (Level + 1))))
+        {
+            const int32 Slot = (int32)((DueStep >> (LEVEL_BITS * Level)) & (SLOTS_PER_LEVEL - 1));
+            Wheels[Level][Slot].Add(TimerId);
+            return;
+        }
+    }
+
+    Overflow.Add(TimerId);
+}
+
+void UDATimerWheelSubsystem::Step()
+{
+    ++CurrentStep;
+
+    // Every time a level wraps, pull the matching slot of the level above down into finer slots
+    bool bCascadeOverflow = true;
+    for (int32 Level = 1; Level < NUM_LEVELS; ++Level)
+    {
+        if ((CurrentStep & ((1ull << (LEVEL_BITS * Level)) - 1)) != 0)
+        {
+            bCascadeOverflow = false;
+            break;
+        }
+
+        const int32 Slot = (int32)((CurrentStep >> (LEVEL_BITS * Level)) & (SLOTS_PER_LEVEL - 1));
+        const TArray<uint64> Cascaded = MoveTemp(Wheels[Level][Slot]);
+        for (const uint64 TimerId : Cascaded)
+        {
+            if (const FTimer* Timer = Timers.Find(TimerId))
+            {
+                InsertTimer(TimerId, Timer->DueStep);
+            }
+        }
+    }
+
+    if (bCascadeOverflow && Overflow.Num() > 0)
+    {
+        const TArray<uint64> Cascaded = MoveTemp(Overflow);
+        for (const uint64 TimerId : Cascaded)
+        {
+            if (const FTimer* Timer = Timers.Find(TimerId))
+            {
+                InsertTimer(TimerId, Timer->DueStep);
+            }
+        }
+    }
+
+    const TArray<uint64> DueTimers = MoveTemp(Wheels[0][CurrentStep & (SLOTS_PER_LEVEL - 1)]);
+    for (const uint64 TimerId : DueTimers)
+    {
+        FireTimer(TimerId);
+    }
+}
+
+void UDATimerWheelSubsystem::FireTimer(uint64 TimerId)
+{
+    FTimer* Timer = Timers.Find(TimerId);
+    if (!Timer)
+    {
+        // Cancelled after it was slotted
+        return;
+    }
+
+    if (Timer->DueStep > CurrentStep)
+    {
+        InsertTimer(TimerId, Timer->DueStep);
+        return;
+    }
+
+    if (Timer->Owner.IsStale())
+    {
+        Timers.Remove(TimerId);
+        return;
+    }
+
+    // The callback may schedule or cancel timers, which can reallocate Timers, so it runs from a local
+    FDATimerCallback Callback = MoveTemp(Timer->Callback);
+
+    if (Timer->IntervalSteps == 0)
+    {
+        Timers.Remove(TimerId);
+        Callback(FDATimerHandle{ TimerId });
+        return;
+    }
+
+    Timer->DueStep = CurrentStep + Timer->IntervalSteps;
+    InsertTimer(TimerId, Timer->DueStep);
+
+    Callback(FDATimerHandle{ TimerId });
+
+    if (FTimer* Repeating = Timers.Find(TimerId))
+    {
+        Repeating->Callback = MoveTemp(Callback);
+    }
+}
+
+uint64 UDATimerWheelSubsystem::SecondsToSteps(float Seconds)
+{
+    return (uint64)FMath::CeilToInt64(FMath::Max(0.0f, Seconds) / TIMER_RESOLUTION);
+}
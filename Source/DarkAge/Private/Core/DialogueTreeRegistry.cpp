@@ -0,0 +1,242 @@
+#include "Core/DialogueTreeRegistry.h"
+
+void UDialogueTreeRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    RegisterDefaultTrees();
+
+    UE_LOG(LogTemp, Log, TEXT("DialogueTreeRegistry initialized with %d trees"), Trees.Num());
+}
+
+void UDialogueTreeRegistry::Deinitialize()
+{
+    Strings.Empty();
+    StringIds.Empty();
+    Trees.Empty();
+    Lines.Empty();
+    Responses.Empty();
+    ResponseEndsDialogue.Empty();
+    Branches.Empty();
+    Conditions.Reset();
+    ClausesByConditionKey.Empty();
+    TreesByContentHash.Empty();
+    SharedTrees.Empty();
+
+    Super::Deinitialize();
+}
+
+FDialogueTreeHandle UDialogueTreeRegistry::RegisterTree(const FDialogueTree& Tree)
+{
+    // Compile into scratch arrays first so a duplicate can be found before anything is appended
+    const FName TreeID(*Tree.TreeID);
+    const int32 TreeIDString = InternString(Tree.TreeID);
+    TArray<FCompiledLine> TreeLines;
+    TArray<int32> TreeResponses;
+    TArray<FDialogueBranch> TreeBranches;
+    TreeLines.Reserve(Tree.Lines.Num());
+    TreeBranches.Reserve(Tree.Conditions.Num());
+
+    uint32 ContentHash = ::GetTypeHash(TreeIDString);
+    for (const FDialogueLine& Line : Tree.Lines)
+    {
+        FCompiledLine& Compiled = TreeLines.AddDefaulted_GetRef();
+        Compiled.SpeakerName = InternString(Line.SpeakerName);
+        Compiled.Text = InternString(Line.Text);
+        Compiled.FirstResponse = TreeResponses.Num();
+        Compiled.NumResponses = Line.Responses.Num();
+        Compiled.Mood = Line.Mood;
+        ContentHash = HashCombine(ContentHash, HashCombine(::GetTypeHash(Compiled.Text), ::GetTypeHash(Compiled.SpeakerName)));
+
+        for (const FString& Response : Line.Responses)
+        {
+            const int32 ResponseId = InternString(Response);
+            TreeResponses.Add(ResponseId);
+            ContentHash = HashCombine(ContentHash, ::GetTypeHash(ResponseId));
+        }
+    }
+
+    for (const TPair<FString, FString>& Condition : Tree.Conditions)
+    {
+        FDialogueBranch& Branch = TreeBranches.AddDefaulted_GetRef();
+        Branch.Condition = CompileCondition(Condition.Key);
+        Branch.NextTreeID = FName(*Condition.Value);
+        ContentHash = HashCombine(ContentHash, HashCombine(::GetTypeHash(Branch.Condition), GetTypeHash(Branch.NextTreeID)));
+    }
+
+    TArray<int32, TInlineAllocator<4>> Candidates;
+    TreesByContentHash.MultiFind(ContentHash, Candidates);
+    for (const int32 Candidate : Candidates)
+    {
+        const FCompiledTree& Existing = Trees[Candidate];
+        if (Existing.TreeIDString != TreeIDString || Existing.NumLines != TreeLines.Num() || Existing.NumBranches != TreeBranches.Num())
+        {
+            continue;
+        }
+
+        bool bMatches = true;
+        for (int32 LineIndex = 0; bMatches && LineIndex < TreeLines.Num(); ++LineIndex)
+        {
+            const FCompiledLine& ExistingLine = Lines[Existing.FirstLine + LineIndex];
+            const FCompiledLine& NewLine = TreeLines[LineIndex];
+            bMatches = ExistingLine == NewLine
+                && (NewLine.NumResponses == 0 || FMemory::Memcmp(&Responses[ExistingLine.FirstResponse], &TreeResponses[NewLine.FirstResponse], NewLine.NumResponses * sizeof(int32)) == 0);
+        }
+        for (int32 BranchIndex = 0; bMatches && BranchIndex < TreeBranches.Num(); ++BranchIndex)
+        {
+            bMatches = Branches[Existing.FirstBranch + BranchIndex] == TreeBranches[BranchIndex];
+        }
+
+        if (bMatches)
+        {
+            return FDialogueTreeHandle{Candidate};
+        }
+    }
+
+    FCompiledTree& Compiled = Trees.AddDefaulted_GetRef();
+    Compiled.TreeID = TreeID;
+    Compiled.TreeIDString = TreeIDString;
+    Compiled.FirstLine = Lines.Num();
+    Compiled.NumLines = TreeLines.Num();
+    Compiled.FirstBranch = Branches.Num();
+    Compiled.NumBranches = TreeBranches.Num();
+
+    const int32 ResponseOffset = Responses.Num();
+    for (FCompiledLine& Line : TreeLines)
+    {
+        Line.FirstResponse += ResponseOffset;
+    }
+    Lines.Append(TreeLines);
+    Branches.Append(TreeBranches);
+    for (const int32 ResponseId : TreeResponses)
+    {
+        Responses.Add(ResponseId);
+        ResponseEndsDialogue.Add(Strings[ResponseId].Contains(TEXT("[END]")));
+    }
+
+    const int32 TreeIndex = Trees.Num() - 1;
+    TreesByContentHash.Add(ContentHash, TreeIndex);
+    return FDialogueTreeHandle{TreeIndex};
+}
+
+FDialogueTreeHandle UDialogueTreeRegistry::RegisterSharedTree(const FDialogueTree& Tree)
+{
+    const FDialogueTreeHandle Handle = RegisterTree(Tree);
+    SharedTrees.Add(Trees[Handle.Index].TreeID, Handle.Index);
+    return Handle;
+}
+
+FDialogueTreeHandle UDialogueTreeRegistry::FindSharedTree(FName TreeID) const
+{
+    const int32* TreeIndex = SharedTrees.Find(TreeID);
+    return TreeIndex ? FDialogueTreeHandle{*TreeIndex} : FDialogueTreeHandle();
+}
+
+FName UDialogueTreeRegistry::GetTreeID(FDialogueTreeHandle Tree) const
+{
+    return Trees.IsValidIndex(Tree.Index) ? Trees[Tree.Index].TreeID : NAME_None;
+}
+
+int32 UDialogueTreeRegistry::GetNumLines(FDialogueTreeHandle Tree) const
+{
+    return Trees.IsValidIndex(Tree.Index) ? Trees[Tree.Index].NumLines : 0;
+}
+
+int32 UDialogueTreeRegistry::GetNumResponses(FDialogueTreeHandle Tree, int32 LineIndex) const
+{
+    const FCompiledLine* Line = FindLine(Tree, LineIndex);
+    return Line ? Line->NumResponses : 0;
+}
+
+bool UDialogueTreeRegistry::DoesResponseEndDialogue(FDialogueTreeHandle Tree, int32 LineIndex, int32 ResponseIndex) const
+{
+    const FCompiledLine* Line = FindLine(Tree, LineIndex);
+    if (!Line || ResponseIndex < 0 || ResponseIndex >= Line->NumResponses)
+    {
+        return true;
+    }
+    return ResponseEndsDialogue[Line->FirstResponse + ResponseIndex];
+}
+
+TConstArrayView<FDialogueBranch> UDialogueTreeRegistry::GetBranches(FDialogueTreeHandle Tree) const
+{
+    if (!Trees.IsValidIndex(Tree.Index))
+    {
+        return TConstArrayView<FDialogueBranch>();
+    }
+
+    const FCompiledTree& Compiled = Trees[Tree.Index];
+    return TConstArrayView<FDialogueBranch>(Branches.GetData() + Compiled.FirstBranch, Compiled.NumBranches);
+}
+
+void UDialogueTreeRegistry::GetLine(FDialogueTreeHandle Tree, int32 LineIndex, FDialogueLine& OutLine) const
+{
+    const FCompiledLine* Line = FindLine(Tree, LineIndex);
+    if (!Line)
+    {
+        return;
+    }
+
+    OutLine.SpeakerName = Strings[Line->SpeakerName];
+    OutLine.Text = Strings[Line->Text];
+    OutLine.Mood = Line->Mood;
+    OutLine.Responses.SetNum(Line->NumResponses);
+    for (int32 i = 0; i < Line->NumResponses; ++i)
+    {
+        OutLine.Responses[i] = Strings[Responses[Line->FirstResponse + i]];
+    }
+}
+
+int32 UDialogueTreeRegistry::InternString(const FString& String)
+{
+    if (const int32* StringId = StringIds.Find(String))
+    {
+        return *StringId;
+    }
+
+    const int32 StringId = Strings.Add(String);
+    StringIds.Add(String, StringId);
+    return StringId;
+}
+
+int32 UDialogueTreeRegistry::CompileCondition(const FString& ConditionKey)
+{
+    if (const int32* Clause = ClausesByConditionKey.Find(ConditionKey))
+    {
+        return *Clause;
+    }
+
+    const int32 Clause = Conditions.CompileDialogueCondition(ConditionKey);
+    ClausesByConditionKey.Add(ConditionKey, Clause);
+    return Clause;
+}
+
+const UDialogueTreeRegistry::FCompiledLine* UDialogueTreeRegistry::FindLine(FDialogueTreeHandle Tree, int32 LineIndex) const
+{
+    if (!Trees.IsValidIndex(Tree.Index))
+    {
+        return nullptr;
+    }
+
+    const FCompiledTree& Compiled = Trees[Tree.Index];
+    return (LineIndex >= 0 && LineIndex < Compiled.NumLines) ? &Lines[Compiled.FirstLine + LineIndex] : nullptr;
+}
+
+void UDialogueTreeRegistry::RegisterDefaultTrees()
+{
+    // Create default greeting tree; the speaker is filled in by the NPC running it
+    FDialogueTree DefaultTree;
+    DefaultTree.TreeID = TEXT("Default");
+
+    FDialogueLine GreetingLine;
+    GreetingLine.Text = TEXT("Hello there, traveler. What brings you to our humble settlement?");
+    GreetingLine.Mood = EDialogueMood::Neutral;
+    GreetingLine.Responses.Add(TEXT("I'm just exploring."));
+    GreetingLine.Responses.Add(TEXT("I'm looking for work."));
+    GreetingLine.Responses.Add(TEXT("I need directions."));
+    GreetingLine.Responses.Add(TEXT("Goodbye. [END]"));
+
+    DefaultTree.Lines.Add(GreetingLine);
+
+    RegisterSharedTree(DefaultTree);
+}
@@ -2,10 +2,14 @@
 #include "Core/WorldManagementSubsystem.h"
 #include "Core/FactionManagerSubsystem.h"
 #include "Core/EconomySubsystem.h"
+#include "Core/QuestRuntimeSubsystem.h"
 #include "Data/FactionData.h"
 #include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
 #include "TimerManager.h"
 #include "Misc/DateTime.h"
+#include "Misc/Paths.h"
 
 UDynamicQuestSubsystem::UDynamicQuestSubsystem()
 {
@@ -15,18 +19,36 @@ UDynamicQuestSubsystem::UDynamicQuestSubsystem()
 void UDynamicQuestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	Collection.InitializeDependency<UQuestObjectiveTrackerSubsystem>();
+	Collection.InitializeDependency<UEconomySubsystem>();
+	QuestRuntime = Collection.InitializeDependency<UQuestRuntimeSubsystem>();
 	
 	// Get reference to world management subsystem
 	WorldManagementSubsystem = GetGameInstance()->GetSubsystem<UWorldManagementSubsystem>();
 	EconomySubsystem = GetGameInstance()->GetSubsystem<UEconomySubsystem>();
+
+	if (QuestRuntime)
+	{
+		QuestRuntime->SetListener(EQuestRuntimeSource::Dynamic, FOnQuestRuntimeEvent::CreateUObject(this, &UDynamicQuestSubsystem::HandleRuntimeEvent));
+	}
 	
 	// Initialize quest templates
 	InitializeQuestTemplates();
+
+	// Each session starts a fresh spill file for events that age out of memory. Earlier sessions'
+	// files are rotated rather than deleted, and every PIE instance gets its own file.
+	const FWorldContext* WorldContext = GetGameInstance()->GetWorldContext();
+	const int32 PIEInstance = WorldContext ? WorldContext->PIEInstance : INDEX_NONE;
+	const FString EventSpillName = PIEInstance != INDEX_NONE ? FString::Printf(TEXT("QuestEvents_PIE%d.log"), PIEInstance) : FString(TEXT("QuestEvents.log"));
+	const FString EventSpillPath = FPaths::ProjectSavedDir() / EventSpillName;
+	FQuestEventLog::RotateSpillFile(EventSpillPath, MaxEventSpillBackups);
+	QuestEventLog.SetSpillPath(EventSpillPath);
 	
-	// Start quest update timer
-	if (UWorld* World = GetWorld())
+	// Shortage quests are generated from economy threshold events rather than periodic scans
+	if (EconomySubsystem.IsValid())
 	{
-		World->GetTimerManager().SetTimer(QuestUpdateTimer, this, &UDynamicQuestSubsystem::UpdateActiveQuests, QuestUpdateInterval, true);
+		EconomySubsystem->OnSupplyThresholdCrossed.AddDynamic(this, &UDynamicQuestSubsystem::HandleSupplyThresholdCrossed);
+		SeedResourceShortageQuests();
 	}
 	
 	UE_LOG(LogTemp, Log, TEXT("DynamicQuestSubsystem initialized"));
@@ -34,11 +56,24 @@ void UDynamicQuestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UDynamicQuestSubsystem::Deinitialize()
 {
-	// Clean up timer
-	if (UWorld* World = GetWorld())
+	if (EconomySubsystem.IsValid())
 	{
-		World->GetTimerManager().ClearTimer(QuestUpdateTimer);
+		EconomySubsystem->OnSupplyThresholdCrossed.RemoveDynamic(this, &UDynamicQuestSubsystem::HandleSupplyThresholdCrossed);
+	}
+
+	if (QuestRuntime)
+	{
+		QuestRuntime->ClearListener(EQuestRuntimeSource::Dynamic);
+	}
+	if (UQuestObjectiveTrackerSubsystem* Tracker = GetObjectiveTracker())
+	{
+		for (TPair<FDemandQuestKey, FQuestTrackingHandle>& Cooldown : DemandCooldowns)
+		{
+			Tracker->Cancel(Cooldown.Value);
+		}
 	}
+	DemandCooldowns.Empty();
+	PendingShortages.Empty();
 	
 	UE_LOG(LogTemp, Log, TEXT("DynamicQuestSubsystem deinitialized"));
 	Super::Deinitialize();
@@ -118,46 +153,75 @@ FDynamicQuest UDynamicQuestSubsystem::GenerateQuestOfType(EDynamicQuestType Ques
 
 bool UDynamicQuestSubsystem::AddQuest(const FDynamicQuest& Quest)
 {
-	if (ActiveQuests.Contains(Quest.QuestID))
+	if (!QuestRuntime)
+	{
+		return false;
+	}
+
+	const FQuestRuntimeHandle Handle = QuestRuntime->AddQuest(EQuestRuntimeSource::Dynamic, Quest, QuestUpdateInterval);
+	if (!Handle.IsValid())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Quest with ID %s already exists"), *Quest.QuestID);
 		return false;
 	}
 	
-	ActiveQuests.Add(Quest.QuestID, Quest);
 	LogQuestEvent(Quest.QuestID, EQuestEventType::Accepted, TEXT("Player"), TEXT(""));
+	QuestRuntime->StartTracking(Handle);
 	return true;
 }
 
 bool UDynamicQuestSubsystem::RemoveQuest(const FString& QuestID)
 {
-	return ActiveQuests.Remove(QuestID) > 0;
+	// The runtime reports the removal back, which releases any shortage slot the quest held
+	return QuestRuntime && QuestRuntime->RemoveQuest(FindQuestHandle(QuestID));
 }
 
 FDynamicQuest UDynamicQuestSubsystem::GetQuest(const FString& QuestID) const
 {
-	const FDynamicQuest* Quest = ActiveQuests.Find(QuestID);
-	return Quest ? *Quest : FDynamicQuest();
+	const FDynamicQuest* Quest = FindQuest(QuestID);
+	if (!Quest)
+	{
+		return FDynamicQuest();
+	}
+
+	FDynamicQuest Result = *Quest;
+	RefreshRemainingTime(Result);
+	return Result;
 }
 
 TArray<FDynamicQuest> UDynamicQuestSubsystem::GetActiveQuests() const
 {
 	TArray<FDynamicQuest> Quests;
-	ActiveQuests.GenerateValueArray(Quests);
+	if (QuestRuntime)
+	{
+		Quests.Reserve(QuestRuntime->GetNumQuests(EQuestRuntimeSource::Dynamic));
+		QuestRuntime->ForEachQuest(EQuestRuntimeSource::Dynamic, [&Quests](FQuestRuntimeHandle, const FDynamicQuest& Quest)
+		{
+			Quests.Add(Quest);
+		});
+	}
+	for (FDynamicQuest& Quest : Quests)
+	{
+		RefreshRemainingTime(Quest);
+	}
 	return Quests;
 }
 
 TArray<FDynamicQuest> UDynamicQuestSubsystem::GetQuestsByStatus(EDynamicQuestStatus Status) const
 {
 	TArray<FDynamicQuest> FilteredQuests;
+	if (!QuestRuntime)
+	{
+		return FilteredQuests;
+	}
 	
-	for (const auto& QuestPair : ActiveQuests)
+	QuestRuntime->ForEachQuest(EQuestRuntimeSource::Dynamic, [&FilteredQuests, Status](FQuestRuntimeHandle, const FDynamicQuest& Quest)
 	{
-		if (QuestPair.Value.Status == Status)
+		if (Quest.Status == Status)
 		{
-			FilteredQuests.Add(QuestPair.Value);
+			FilteredQuests.Add(Quest);
 		}
-	}
+	});
 	
 	return FilteredQuests;
 }
@@ -165,21 +229,25 @@ TArray<FDynamicQuest> UDynamicQuestSubsystem::GetQuestsByStatus(EDynamicQuestSta
 TArray<FDynamicQuest> UDynamicQuestSubsystem::GetQuestsInRegion(const FString& RegionID) const
 {
 	TArray<FDynamicQuest> RegionQuests;
+	if (!QuestRuntime)
+	{
+		return RegionQuests;
+	}
 	
-	for (const auto& QuestPair : ActiveQuests)
+	QuestRuntime->ForEachQuest(EQuestRuntimeSource::Dynamic, [&RegionQuests, &RegionID](FQuestRuntimeHandle, const FDynamicQuest& Quest)
 	{
-		if (QuestPair.Value.RegionID == RegionID)
+		if (Quest.RegionID == RegionID)
 		{
-			RegionQuests.Add(QuestPair.Value);
+			RegionQuests.Add(Quest);
 		}
-	}
+	});
 	
 	return RegionQuests;
 }
 
 bool UDynamicQuestSubsystem::UpdateQuestProgress(const FString& QuestID, const FString& ObjectiveKey, float ProgressAmount)
 {
-	FDynamicQuest* Quest = ActiveQuests.Find(QuestID);
+	FDynamicQuest* Quest = FindQuest(QuestID);
 	if (!Quest)
 	{
 		return false;
@@ -207,13 +275,14 @@ bool UDynamicQuestSubsystem::UpdateQuestProgress(const FString& QuestID, const F
 
 bool UDynamicQuestSubsystem::CompleteQuest(const FString& QuestID)
 {
-	FDynamicQuest* Quest = ActiveQuests.Find(QuestID);
+	const FQuestRuntimeHandle Handle = FindQuestHandle(QuestID);
+	FDynamicQuest* Quest = QuestRuntime ? QuestRuntime->FindQuest(Handle) : nullptr;
 	if (!Quest)
 	{
 		return false;
 	}
 	
-	Quest->Status = EDynamicQuestStatus::Completed;
+	QuestRuntime->FinishQuest(Handle, EDynamicQuestStatus::Completed);
 	UE_LOG(LogTemp, Log, TEXT("Quest completed: %s"), *Quest->QuestName);
 	LogQuestEvent(QuestID, EQuestEventType::Completed, TEXT("Player"), TEXT(""));
 	
@@ -248,13 +317,14 @@ bool UDynamicQuestSubsystem::CompleteQuest(const FString& QuestID)
 
 bool UDynamicQuestSubsystem::FailQuest(const FString& QuestID)
 {
-	FDynamicQuest* Quest = ActiveQuests.Find(QuestID);
+	const FQuestRuntimeHandle Handle = FindQuestHandle(QuestID);
+	FDynamicQuest* Quest = QuestRuntime ? QuestRuntime->FindQuest(Handle) : nullptr;
 	if (!Quest)
 	{
 		return false;
 	}
 	
-	Quest->Status = EDynamicQuestStatus::Failed;
+	QuestRuntime->FinishQuest(Handle, EDynamicQuestStatus::Failed);
 	UE_LOG(LogTemp, Log, TEXT("Quest failed: %s"), *Quest->QuestName);
 	LogQuestEvent(QuestID, EQuestEventType::Failed, TEXT("Player"), TEXT(""));
 	
@@ -263,22 +333,7 @@ bool UDynamicQuestSubsystem::FailQuest(const FString& QuestID)
 
 bool UDynamicQuestSubsystem::AreObjectivesCompleted(const FString& QuestID) const
 {
-	const FDynamicQuest* Quest = ActiveQuests.Find(QuestID);
-	if (!Quest)
-	{
-		return false;
-	}
-	
-	// Check if all objectives are completed
-	for (const FQuestObjective& Objective : Quest->Objectives)
-	{
-		if (!Objective.bIsCompleted)
-		{
-			return false;
-		}
-	}
-	
-	return true;
+	return QuestRuntime && QuestRuntime->AreObjectivesCompleted(FindQuestHandle(QuestID));
 }
 
 TArray<FDynamicQuest> UDynamicQuestSubsystem::GenerateEventQuests(const FString& EventType, const FVector& EventLocation)
@@ -398,42 +453,71 @@ void UDynamicQuestSubsystem::InitializeQuestTemplates()
 	QuestTemplates.Add("BasicGathering", GatheringTemplate);
 }
 
-void UDynamicQuestSubsystem::UpdateActiveQuests()
+FDynamicQuest* UDynamicQuestSubsystem::FindQuest(const FString& QuestID)
 {
-	GenerateResourceShortageQuests();
+	return QuestRuntime ? QuestRuntime->FindQuest(FindQuestHandle(QuestID)) : nullptr;
+}
 
-	TArray<FString> QuestsToRemove;
-	
-	for (auto& QuestPair : ActiveQuests)
+const FDynamicQuest* UDynamicQuestSubsystem::FindQuest(const FString& QuestID) const
+{
+	return QuestRuntime ? QuestRuntime->FindQuest(FindQuestHandle(QuestID)) : nullptr;
+}
+
+FQuestRuntimeHandle UDynamicQuestSubsystem::FindQuestHandle(const FString& QuestID) const
+{
+	return QuestRuntime ? QuestRuntime->FindHandle(EQuestRuntimeSource::Dynamic, QuestID) : FQuestRuntimeHandle();
+}
+
+void UDynamicQuestSubsystem::HandleRuntimeEvent(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex)
+{
+	const FDynamicQuest* Quest = QuestRuntime->FindQuest(Handle);
+	if (!Quest)
 	{
-		FDynamicQuest& Quest = QuestPair.Value;
-		
-		// Update time-limited quests
-		if (Quest.TimeLimit > 0.0f && Quest.Status == EDynamicQuestStatus::Active)
-		{
-			Quest.RemainingTime -= QuestUpdateInterval;
-			
-			if (Quest.RemainingTime <= 0.0f)
-			{
-				Quest.Status = EDynamicQuestStatus::Expired;
-				UE_LOG(LogTemp, Log, TEXT("Quest expired: %s"), *Quest.QuestName);
-			}
-		}
-		
-		// Clean up completed/failed/expired quests after some time
-		if (Quest.Status == EDynamicQuestStatus::Completed || 
-			Quest.Status == EDynamicQuestStatus::Failed || 
-			Quest.Status == EDynamicQuestStatus::Expired)
+		return;
+	}
+
+	const FString QuestID = Quest->QuestID;
+	switch (Event)
+	{
+	case EQuestRuntimeEvent::ObjectiveCompleted:
+		if (QuestRuntime->AreObjectivesCompleted(Handle))
 		{
-			QuestsToRemove.Add(QuestPair.Key);
+			CompleteQuest(QuestID);
 		}
+		break;
+	case EQuestRuntimeEvent::Expired:
+		UE_LOG(LogTemp, Log, TEXT("Quest expired: %s"), *Quest->QuestName);
+		LogQuestEvent(QuestID, EQuestEventType::Expired, TEXT("Player"), TEXT(""));
+		break;
+	case EQuestRuntimeEvent::Removed:
+		ReleaseDemandQuest(QuestID);
+		// Quest IDs aren't reused, so per-quest counts would otherwise grow forever
+		QuestEventLog.ForgetQuest(QuestID);
+		break;
+	case EQuestRuntimeEvent::Restored:
+		RestoreDemandQuest(*Quest);
+		break;
 	}
-	
-	// Remove old quests
-	for (const FString& QuestID : QuestsToRemove)
+}
+
+void UDynamicQuestSubsystem::RefreshRemainingTime(FDynamicQuest& Quest) const
+{
+	if (Quest.Status != EDynamicQuestStatus::Active || Quest.TimeLimit <= 0.0f || !QuestRuntime)
 	{
-		RemoveQuest(QuestID);
+		return;
 	}
+
+	const float Remaining = QuestRuntime->GetRemainingTime(FindQuestHandle(Quest.QuestID));
+	if (Remaining >= 0.0f)
+	{
+		Quest.RemainingTime = Remaining;
+	}
+}
+
+UQuestObjectiveTrackerSubsystem* UDynamicQuestSubsystem::GetObjectiveTracker() const
+{
+	UGameInstance* GameInstance = GetGameInstance();
+	return GameInstance ? GameInstance->GetSubsystem<UQuestObjectiveTrackerSubsystem>() : nullptr;
 }
 
 // Helper to log quest events
@@ -454,7 +538,15 @@ void UDynamicQuestSubsystem::LogQuestEvent(const FString& QuestID, EQuestEventTy
         Entry.Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
     }
 
-    this->QuestEventLog.Add(Entry);
+    if (EventType == EQuestEventType::Completed)
+    {
+        if (const FDynamicQuest* Quest = FindQuest(QuestID))
+        {
+            ++CompletionCountByQuestType.FindOrAdd(Quest->QuestType);
+        }
+    }
+
+    QuestEventLog.Add(MoveTemp(Entry));
 }
 
 void UDynamicQuestSubsystem::LogPlayerQuestChoice(const FString& QuestID, const FString& PlayerID, const FString& ChoiceDetail)
@@ -465,45 +557,19 @@ void UDynamicQuestSubsystem::LogPlayerQuestChoice(const FString& QuestID, const
 TArray<FQuestEventLogEntry> UDynamicQuestSubsystem::QueryQuestEvents(const FString& QuestID, EQuestEventType EventType, int32 MaxResults) const
 {
 	TArray<FQuestEventLogEntry> Results;
-	for (int32 i = QuestEventLog.Num() - 1; i >= 0 && Results.Num() < MaxResults; --i)
-	{
-		const FQuestEventLogEntry& Entry = QuestEventLog[i];
-		if ((QuestID.IsEmpty() || Entry.QuestID == QuestID) && Entry.EventType == EventType)
-		{
-			Results.Add(Entry);
-		}
-	}
+	QuestEventLog.Query(QuestID, EventType, MaxResults, Results);
 	return Results;
 }
 
 int32 UDynamicQuestSubsystem::GetQuestEventCount(const FString& QuestID, EQuestEventType EventType) const
 {
-	int32 Count = 0;
-	for (const FQuestEventLogEntry& Entry : QuestEventLog)
-	{
-		if ((QuestID.IsEmpty() || Entry.QuestID == QuestID) && Entry.EventType == EventType)
-		{
-			++Count;
-		}
-	}
-	return Count;
+	return QuestEventLog.GetCount(QuestID, EventType);
 }
 
 int32 UDynamicQuestSubsystem::GetQuestTypeCompletionCount(EDynamicQuestType QuestType) const
 {
-	int32 Count = 0;
-	for (const FQuestEventLogEntry& Entry : QuestEventLog)
-	{
-		if (Entry.EventType == EQuestEventType::Completed)
-		{
-			const FDynamicQuest* Quest = ActiveQuests.Find(Entry.QuestID);
-			if (Quest && Quest->QuestType == QuestType)
-			{
-				++Count;
-			}
-		}
-	}
-	return Count;
+	const int32* Count = CompletionCountByQuestType.Find(QuestType);
+	return Count ? *Count : 0;
 }
 
 // Quest generation implementations for each type
@@ -708,32 +774,163 @@ FDynamicQuest UDynamicQuestSubsystem::GenerateInvestigationQuest(const FQuestGen
 	   return Quest;
 }
 
-void UDynamicQuestSubsystem::GenerateResourceShortageQuests()
+void UDynamicQuestSubsystem::HandleSupplyThresholdCrossed(FName Region, FName ItemId, bool bLowSupply)
 {
-	   if (!EconomySubsystem.IsValid() || !WorldManagementSubsystem.IsValid())
-	   {
-	       return;
-	   }
+	const FDemandQuestKey Key{Region, ItemId, EDynamicQuestType::Gathering};
+	if (!bLowSupply)
+	{
+		// An open quest stays open; the shortage just stops asking for more
+		PendingShortages.Remove(Key);
+		return;
+	}
 
-	   TArray<FName> RegionIDs = WorldManagementSubsystem->GetAllRegionIDs();
-	   for (const FName& RegionID : RegionIDs)
-	   {
-	       TArray<FName> LowSupplyItems = EconomySubsystem->GetItemsWithLowSupply(RegionID);
-	       for (const FName& ItemID : LowSupplyItems)
-	       {
-	           FQuestGenerationParams Params;
-	           Params.TargetRegion = RegionID.ToString();
-	           Params.PreferredTypes = { EDynamicQuestType::Gathering };
-	           
-	           FDynamicQuest NewQuest = GenerateGatheringQuest(Params);
-	           NewQuest.QuestName = FString::Printf(TEXT("Resource Shortage: %s"), *ItemID.ToString());
-	           NewQuest.Description = FString::Printf(TEXT("The settlement in %s is running low on %s. Gather some to help them out."), *RegionID.ToString(), *ItemID.ToString());
-	           NewQuest.Requirements.Empty();
-	           NewQuest.Requirements.Add(ItemID.ToString(), FMath::RandRange(10, 20)); // Request 10-20 of the item
+	TryGenerateShortageQuest(Key);
+}
 
-	           AddQuest(NewQuest);
-	       }
-	   }
+void UDynamicQuestSubsystem::SeedResourceShortageQuests()
+{
+	TArray<TPair<FName, FName>> LowSupplyItems;
+	EconomySubsystem->GetLowSupplyItems(LowSupplyItems);
+	for (const TPair<FName, FName>& RegionItem : LowSupplyItems)
+	{
+		TryGenerateShortageQuest(FDemandQuestKey{RegionItem.Key, RegionItem.Value, EDynamicQuestType::Gathering});
+	}
+}
+
+bool UDynamicQuestSubsystem::TryGenerateShortageQuest(const FDemandQuestKey& Key)
+{
+	if (OpenDemandQuests.Contains(Key))
+	{
+		return false;
+	}
+
+	if (DemandCooldowns.Contains(Key))
+	{
+		// Retried when the cooldown deadline fires
+		PendingShortages.Add(Key);
+		return false;
+	}
+
+	int32& RegionCount = OpenDemandQuestsPerRegion.FindOrAdd(Key.RegionID);
+	if (RegionCount >= MaxShortageQuestsPerRegion)
+	{
+		PendingShortages.Add(Key);
+		return false;
+	}
+
+	FQuestGenerationParams Params;
+	Params.TargetRegion = Key.RegionID.ToString();
+	Params.PreferredTypes = { Key.Kind };
+
+	const FString ItemName = Key.ItemID.ToString();
+	const int32 RequestedAmount = FMath::RandRange(10, 20);
+
+	FDynamicQuest NewQuest = GenerateGatheringQuest(Params);
+	NewQuest.QuestID = FString::Printf(TEXT("Shortage_%s_%s_%d"), *Params.TargetRegion, *ItemName, NextDemandQuestSerial++);
+	NewQuest.QuestName = FString::Printf(TEXT("Resource Shortage: %s"), *ItemName);
+	NewQuest.Description = FString::Printf(TEXT("The settlement in %s is running low on %s. Gather some to help them out."), *Params.TargetRegion, *ItemName);
+	NewQuest.Requirements.Empty();
+	NewQuest.Requirements.Add(ItemName, RequestedAmount);
+	for (FQuestObjective& Objective : NewQuest.Objectives)
+	{
+		Objective.TargetItem = ItemName;
+		Objective.RequiredCount = RequestedAmount;
+	}
+
+	if (!AddQuest(NewQuest))
+	{
+		return false;
+	}
+
+	++RegionCount;
+	OpenDemandQuests.Add(Key, NewQuest.QuestID);
+	DemandQuestKeys.Add(NewQuest.QuestID, Key);
+	PendingShortages.Remove(Key);
+	return true;
+}
+
+void UDynamicQuestSubsystem::RetryPendingShortages(FName RegionID)
+{
+	TArray<FDemandQuestKey> RegionPending;
+	for (const FDemandQuestKey& Key : PendingShortages)
+	{
+		if (Key.RegionID == RegionID)
+		{
+			RegionPending.Add(Key);
+		}
+	}
+
+	for (const FDemandQuestKey& Key : RegionPending)
+	{
+		TryGenerateShortageQuest(Key);
+	}
+}
+
+void UDynamicQuestSubsystem::ReleaseDemandQuest(const FString& QuestID)
+{
+	FDemandQuestKey Key;
+	if (!DemandQuestKeys.RemoveAndCopyValue(QuestID, Key))
+	{
+		return;
+	}
+
+	OpenDemandQuests.Remove(Key);
+	if (int32* RegionCount = OpenDemandQuestsPerRegion.Find(Key.RegionID))
+	{
+		*RegionCount = FMath::Max(0, *RegionCount - 1);
+	}
+	if (UQuestObjectiveTrackerSubsystem* Tracker = GetObjectiveTracker())
+	{
+		FQuestTrackingHandle& Cooldown = DemandCooldowns.FindOrAdd(Key);
+		Tracker->Cancel(Cooldown);
+		Cooldown = Tracker->ScheduleDeadline(this, ShortageQuestCooldown, [this, Key]()
+		{
+			DemandCooldowns.Remove(Key);
+			if (PendingShortages.Contains(Key))
+			{
+				TryGenerateShortageQuest(Key);
+			}
+		});
+	}
+
+	// A quota slot just opened up; other shortages in the region may take it. During a load the
+	// slot belongs to the saved quests, and a new quest could take the ID of one still to be restored
+	if (!QuestRuntime || !QuestRuntime->IsLoadingQuests())
+	{
+		RetryPendingShortages(Key.RegionID);
+	}
+}
+
+void UDynamicQuestSubsystem::RestoreDemandQuest(const FDynamicQuest& Quest)
+{
+	// Shortage bookkeeping isn't saved; TryGenerateShortageQuest names and fills the quest so it can be rebuilt
+	static const FString ShortagePrefix = TEXT("Shortage_");
+	if (!Quest.QuestID.StartsWith(ShortagePrefix, ESearchCase::CaseSensitive) || Quest.Requirements.Num() != 1)
+	{
+		return;
+	}
+
+	FDemandQuestKey Key;
+	Key.RegionID = FName(*Quest.RegionID);
+	Key.ItemID = FName(*Quest.Requirements.CreateConstIterator()->Key);
+	Key.Kind = Quest.QuestType;
+	if (OpenDemandQuests.Contains(Key))
+	{
+		return;
+	}
+
+	OpenDemandQuests.Add(Key, Quest.QuestID);
+	DemandQuestKeys.Add(Quest.QuestID, Key);
+	++OpenDemandQuestsPerRegion.FindOrAdd(Key.RegionID);
+	PendingShortages.Remove(Key);
+
+	// New shortage quests must not reuse a restored quest's ID
+	int32 SerialStart = INDEX_NONE;
+	if (Quest.QuestID.FindLastChar(TEXT('_'), SerialStart))
+	{
+		const int32 Serial = FCString::Atoi(*Quest.QuestID.RightChop(SerialStart + 1));
+		NextDemandQuestSerial = FMath::Max(NextDemandQuestSerial, Serial + 1);
+	}
 }
 
 FString UDynamicQuestSubsystem::GenerateQuestName(EDynamicQuestType QuestType, EDynamicQuestDifficulty Difficulty)
@@ -756,10 +953,10 @@ FString UDynamicQuestSubsystem::GenerateQuestDescription(const FDynamicQuest& Qu
     FString RegionName = Quest.RegionID;
     if (WorldManagementSubsystem.IsValid())
     {
-        FRegionData Data = WorldManagementSubsystem->GetRegionData(Quest.RegionID);
-        if (!Data.RegionName.IsEmpty())
+        const FRegionData* Data = WorldManagementSubsystem->FindRegionData(Quest.RegionID);
+        if (Data && !Data->RegionName.IsEmpty())
         {
-            RegionName = Data.RegionName.ToString();
+            RegionName = Data->RegionName.ToString();
         }
     }
 
@@ -826,17 +1023,19 @@ FVector UDynamicQuestSubsystem::FindQuestLocation(const FString& RegionID, FName
 {
     if (WorldManagementSubsystem.IsValid())
     {
-        FRegionData RegionData = WorldManagementSubsystem->GetRegionData(RegionID);
-        if (RegionData.PointsOfInterest.Contains(PointOfInterestID))
+        if (const FRegionData* RegionData = WorldManagementSubsystem->FindRegionData(RegionID))
         {
-            return RegionData.PointsOfInterest[PointOfInterestID];
-        }
+            if (const FVector* Location = RegionData->PointsOfInterest.Find(PointOfInterestID))
+            {
+                return *Location;
+            }
 
-        if (RegionData.PointsOfInterest.Num() > 0)
-        {
-            TArray<FName> POIKeys;
-            RegionData.PointsOfInterest.GetKeys(POIKeys);
-            return RegionData.PointsOfInterest[POIKeys[FMath::RandRange(0, POIKeys.Num() - 1)]];
+            if (RegionData->PointsOfInterest.Num() > 0)
+            {
+                TArray<FName> POIKeys;
+                RegionData->PointsOfInterest.GetKeys(POIKeys);
+                return RegionData->PointsOfInterest[POIKeys[FMath::RandRange(0, POIKeys.Num() - 1)]];
+            }
         }
     }
 
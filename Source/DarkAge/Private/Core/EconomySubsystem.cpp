@@ -50,6 +50,9 @@ void UEconomySubsystem::Initialize(FSubsystemCollectionBase& Collection)
         SaveEconomy(); // Save the new default data so the file exists next time
     }
 
+    // Threshold state isn't saved; seed it without broadcasting so listeners start from a known state
+    RefreshSupplyThresholds();
+
     UE_LOG(LogTemp, Log, TEXT("EconomySubsystem Initialized. Loaded %d regional markets."), RegionalMarkets.Num());
 
     if (UWorld* World = GetWorld())
@@ -113,6 +116,18 @@ float UEconomySubsystem::GetItemPrice(const FName& Region, const FName& ItemId)
     return 0.f;
 }
 
+float UEconomySubsystem::GetItemSupply(const FName& Region, const FName& ItemId) const
+{
+    if (const FRegionMarketData* RegionMarket = RegionalMarkets.Find(Region))
+    {
+        if (const FBasicMarketData* ItemData = RegionMarket->MarketItems.Find(ItemId))
+        {
+            return ItemData->Supply;
+        }
+    }
+    return 0.f;
+}
+
 TArray<FName> UEconomySubsystem::GetItemsWithHighDemand(const FName& Region) const
 {
     TArray<FName> HighDemandItems;
@@ -136,7 +151,7 @@ TArray<FName> UEconomySubsystem::GetItemsWithLowSupply(const FName& Region) cons
     {
         for (const auto& Elem : RegionMarket->MarketItems)
         {
-            if (Elem.Value.Supply < Elem.Value.Demand * 0.5f) // Example threshold for low supply
+            if (Elem.Value.Supply < Elem.Value.Demand * LowSupplyRatio)
             {
                 LowSupplyItems.Add(Elem.Key);
             }
@@ -193,6 +208,52 @@ void UEconomySubsystem::UpdatePrice(const FName& Region, const FName& ItemId)
             float SupplyFactor = FMath::Pow(ItemData->Supply / 1000.f, 0.5f);
             ItemData->CurrentPrice = ItemData->BasePrice * (1.0f + DemandFactor - SupplyFactor);
             ItemData->CurrentPrice = FMath::Max(1.f, ItemData->CurrentPrice); // Ensure price doesn't drop below a minimum value
+
+            // Every supply or demand change ends up here, so this is where shortages are detected
+            UpdateSupplyThreshold(Region, ItemId, *ItemData);
+        }
+    }
+}
+
+void UEconomySubsystem::UpdateSupplyThreshold(const FName& Region, const FName& ItemId, FBasicMarketData& ItemData, bool bBroadcast)
+{
+    const bool bLowSupply = ItemData.bLowSupply
+        ? ItemData.Supply < ItemData.Demand * RecoveredSupplyRatio
+        : ItemData.Supply < ItemData.Demand * LowSupplyRatio;
+
+    if (bLowSupply == ItemData.bLowSupply)
+    {
+        return;
+    }
+
+    ItemData.bLowSupply = bLowSupply;
+    if (bBroadcast)
+    {
+        OnSupplyThresholdCrossed.Broadcast(Region, ItemId, bLowSupply);
+    }
+}
+
+void UEconomySubsystem::RefreshSupplyThresholds()
+{
+    for (auto& RegionPair : RegionalMarkets)
+    {
+        for (auto& ItemPair : RegionPair.Value.MarketItems)
+        {
+            UpdateSupplyThreshold(RegionPair.Key, ItemPair.Key, ItemPair.Value, false);
+        }
+    }
+}
+
+void UEconomySubsystem::GetLowSupplyItems(TArray<TPair<FName, FName>>& OutRegionItems) const
+{
+    for (const auto& RegionPair : RegionalMarkets)
+    {
+        for (const auto& ItemPair : RegionPair.Value.MarketItems)
+        {
+            if (ItemPair.Value.bLowSupply)
+            {
+                OutRegionItems.Emplace(RegionPair.Key, ItemPair.Key);
+            }
         }
     }
 }
@@ -4,11 +4,14 @@
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "Components/StatusEffectComponent.h"
-#include "Core/WeatherSystem.h"
+#include "Components/WorldInteractionComponent.h"
+#include "Core/EnvironmentalFieldSubsystem.h"
+#include "Data/StatusEffectData.h"
 
 UEnvironmentalFactorsComponent::UEnvironmentalFactorsComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // Environmental changes are pushed by UEnvironmentalFieldSubsystem
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UEnvironmentalFactorsComponent::BeginPlay()
@@ -16,22 +19,45 @@ void UEnvironmentalFactorsComponent::BeginPlay()
     Super::BeginPlay();
 
     StatusEffectComponent = GetOwner()->FindComponentByClass<UStatusEffectComponent>();
-    if (GetWorld())
+
+    FName Region = DefaultRegion;
+    if (UWorldInteractionComponent* WorldInteraction = GetOwner()->FindComponentByClass<UWorldInteractionComponent>())
     {
-        WeatherSystem = GetWorld()->GetGameInstance()->GetSubsystem<UWeatherSystem>();
+        Region = WorldInteraction->GetCurrentRegion();
+        WorldInteraction->OnRegionChanged.AddDynamic(this, &UEnvironmentalFactorsComponent::HandleRegionChanged);
+    }
+
+    if (GetWorld() && GetWorld()->GetGameInstance())
+    {
+        FieldSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UEnvironmentalFieldSubsystem>();
+    }
+
+    if (FieldSubsystem.IsValid())
+    {
+        FieldSubsystem->Subscribe(this, Region);
     }
 }
 
-void UEnvironmentalFactorsComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UEnvironmentalFactorsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    if (FieldSubsystem.IsValid())
+    {
+        FieldSubsystem->Unsubscribe(this);
+    }
 
-    if (WeatherSystem.IsValid())
+    if (UWorldInteractionComponent* WorldInteraction = GetOwner()->FindComponentByClass<UWorldInteractionComponent>())
     {
-        FEnvironmentalFactors CurrentFactors;
-        CurrentFactors.AirTemperature = WeatherSystem->GetCurrentTemperature();
-        CurrentFactors.Weather = WeatherSystem->GetCurrentWeather();
-        UpdateEnvironmentalFactors(CurrentFactors);
+        WorldInteraction->OnRegionChanged.RemoveDynamic(this, &UEnvironmentalFactorsComponent::HandleRegionChanged);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UEnvironmentalFactorsComponent::HandleRegionChanged(FName OldRegion, FName NewRegion)
+{
+    if (FieldSubsystem.IsValid())
+    {
+        FieldSubsystem->MoveSubscriber(this, NewRegion);
     }
 }
 
@@ -47,45 +73,72 @@ void UEnvironmentalFactorsComponent::UpdateEnvironmentalFactors(const FEnvironme
 
 void UEnvironmentalFactorsComponent::UpdateTemperatureEffects(float AirTemperature)
 {
-    if (!StatusEffectComponent.IsValid())
+    // Leaving a band needs the temperature to move back past the threshold by the hysteresis margin,
+    // so readings hovering around a threshold don't toggle effects on every push
+    EThermalState NewState = ThermalState;
+    if (ThermalState == EThermalState::Cold && AirTemperature > ColdThreshold + TemperatureHysteresis)
     {
-        return;
+        NewState = EThermalState::Neutral;
+    }
+    else if (ThermalState == EThermalState::Hot && AirTemperature < HotThreshold - TemperatureHysteresis)
+    {
+        NewState = EThermalState::Neutral;
     }
 
-    // Example logic: Apply "Cold" or "Hot" status effects based on temperature thresholds.
-    if (AirTemperature < 10.0f) // Cold threshold
+    if (NewState == EThermalState::Neutral)
     {
-        // Apply "Cold" status effect
-        // FDataTableRowHandle ColdEffectHandle;
-        // ColdEffectHandle.DataTable = ...;
-        // ColdEffectHandle.RowName = "Cold";
-        // StatusEffectComponent->ApplyEffect(ColdEffectHandle);
+        if (AirTemperature < ColdThreshold)
+        {
+            NewState = EThermalState::Cold;
+        }
+        else if (AirTemperature > HotThreshold)
+        {
+            NewState = EThermalState::Hot;
+        }
     }
-    else if (AirTemperature > 30.0f) // Hot threshold
+
+    if (NewState == ThermalState)
     {
-        // Apply "Hot" status effect
-        // FDataTableRowHandle HotEffectHandle;
-        // HotEffectHandle.DataTable = ...;
-        // HotEffectHandle.RowName = "Hot";
-        // StatusEffectComponent->ApplyEffect(HotEffectHandle);
+        return;
     }
+
+    ThermalState = NewState;
+    SetEffectActive(ColdEffect, ThermalState == EThermalState::Cold);
+    SetEffectActive(HotEffect, ThermalState == EThermalState::Hot);
 }
 
 void UEnvironmentalFactorsComponent::UpdateWeatherEffects(EWeatherType WeatherType)
 {
-    if (!StatusEffectComponent.IsValid())
+    const bool bNowWet = WeatherType == EWeatherType::Rain;
+    if (bNowWet == bIsWet)
     {
         return;
     }
 
-    // Example logic: Apply "Wet" status effect during rain.
-    if (WeatherType == EWeatherType::Rain)
+    bIsWet = bNowWet;
+    SetEffectActive(WetEffect, bIsWet);
+}
+
+void UEnvironmentalFactorsComponent::SetEffectActive(const FDataTableRowHandle& EffectHandle, bool bActive)
+{
+    if (!StatusEffectComponent.IsValid() || !EffectHandle.DataTable)
+    {
+        return;
+    }
+
+    const FStatusEffectData* EffectData = EffectHandle.GetRow<FStatusEffectData>(TEXT("EnvironmentalFactorsComponent"));
+    if (!EffectData)
+    {
+        return;
+    }
+
+    if (!bActive)
+    {
+        StatusEffectComponent->RemoveEffect(EffectData->EffectID);
+    }
+    else if (!StatusEffectComponent->HasEffect(EffectData->EffectID))
     {
-        // Apply "Wet" status effect
-        // FDataTableRowHandle WetEffectHandle;
-        // WetEffectHandle.DataTable = ...;
-        // WetEffectHandle.RowName = "Wet";
-        // StatusEffectComponent->ApplyEffect(WetEffectHandle);
+        StatusEffectComponent->ApplyEffect(EffectHandle);
     }
 }
 
@@ -0,0 +1,190 @@
+#include "Core/EnvironmentalFieldSubsystem.h"
+#include "Core/EnvironmentalFactorsComponent.h"
+
+void UEnvironmentalFieldSubsystem::Deinitialize()
+{
+    RegionSubscribers.Empty();
+    SubscriberRegions.Empty();
+    RegionOverrides.Empty();
+    Super::Deinitialize();
+}
+
+void UEnvironmentalFieldSubsystem::Subscribe(UEnvironmentalFactorsComponent* Component, FName Region)
+{
+    if (!Component)
+    {
+        return;
+    }
+
+    if (SubscriberRegions.Contains(Component))
+    {
+        MoveSubscriber(Component, Region);
+        return;
+    }
+
+    SubscriberRegions.Add(Component, Region);
+    RegionSubscribers.FindOrAdd(Region).Add(Component);
+
+    if (bHasGlobalFactors || RegionOverrides.Contains(Region))
+    {
+        Component->UpdateEnvironmentalFactors(GetFactors(Region));
+    }
+}
+
+void UEnvironmentalFieldSubsystem::Unsubscribe(UEnvironmentalFactorsComponent* Component)
+{
+    FName Region;
+    if (!SubscriberRegions.RemoveAndCopyValue(Component, Region))
+    {
+        return;
+    }
+
+    if (TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>>* Subscribers = RegionSubscribers.Find(Region))
+    {
+        Subscribers->RemoveSingleSwap(Component);
+        if (Subscribers->Num() == 0)
+        {
+            RegionSubscribers.Remove(Region);
+        }
+    }
+}
+
+void UEnvironmentalFieldSubsystem::MoveSubscriber(UEnvironmentalFactorsComponent* Component, FName NewRegion)
+{
+    const FName* OldRegion = SubscriberRegions.Find(Component);
+    if (!OldRegion)
+    {
+        Subscribe(Component, NewRegion);
+        return;
+    }
+
+    if (*OldRegion == NewRegion)
+    {
+        return;
+    }
+
+    const FEnvironmentalFactors OldFactors = GetFactors(*OldRegion);
+    Unsubscribe(Component);
+    SubscriberRegions.Add(Component, NewRegion);
+    RegionSubscribers.FindOrAdd(NewRegion).Add(Component);
+
+    const FEnvironmentalFactors NewFactors = GetFactors(NewRegion);
+    if (IsMeaningfulChange(OldFactors, NewFactors))
+    {
+        Component->UpdateEnvironmentalFactors(NewFactors);
+    }
+}
+
+void UEnvironmentalFieldSubsystem::PublishGlobalFactors(const FEnvironmentalFactors& Factors)
+{
+    if (bHasGlobalFactors && !IsMeaningfulChange(GlobalFactors, Factors))
+    {
+        return;
+    }
+
+    GlobalFactors = Factors;
+    bHasGlobalFactors = true;
+    OnFieldChanged.Broadcast(NAME_None, GlobalFactors);
+
+    // Only regions that follow the global field are affected
+    TArray<FName> Regions;
+    RegionSubscribers.GetKeys(Regions);
+    for (const FName& Region : Regions)
+    {
+        if (!RegionOverrides.Contains(Region))
+        {
+            PushToRegion(Region, GlobalFactors);
+        }
+    }
+}
+
+void UEnvironmentalFieldSubsystem::PublishRegionFactors(FName Region, const FEnvironmentalFactors& Factors)
+{
+    if (Region.IsNone())
+    {
+        PublishGlobalFactors(Factors);
+        return;
+    }
+
+    const FEnvironmentalFactors* Current = RegionOverrides.Find(Region);
+    const bool bHadFactors = Current || bHasGlobalFactors;
+    const FEnvironmentalFactors Previous = Current ? *Current : GlobalFactors;
+
+    if (bHadFactors && !IsMeaningfulChange(Previous, Factors))
+    {
+        // Leave the last pushed value in place so slow drift still accumulates towards the publish step. A region
+        // without an override keeps following the global factors; copying them in would freeze a stale override.
+        return;
+    }
+
+    RegionOverrides.Add(Region, Factors);
+
+    OnFieldChanged.Broadcast(Region, Factors);
+    PushToRegion(Region, Factors);
+}
+
+void UEnvironmentalFieldSubsystem::ClearRegionFactors(FName Region)
+{
+    FEnvironmentalFactors Previous;
+    if (!RegionOverrides.RemoveAndCopyValue(Region, Previous))
+    {
+        return;
+    }
+
+    if (bHasGlobalFactors && IsMeaningfulChange(Previous, GlobalFactors))
+    {
+        OnFieldChanged.Broadcast(Region, GlobalFactors);
+        PushToRegion(Region, GlobalFactors);
+    }
+}
+
+FEnvironmentalFactors UEnvironmentalFieldSubsystem::GetFactors(FName Region) const
+{
+    if (const FEnvironmentalFactors* Override = RegionOverrides.Find(Region))
+    {
+        return *Override;
+    }
+    return GlobalFactors;
+}
+
+bool UEnvironmentalFieldSubsystem::IsMeaningfulChange(const FEnvironmentalFactors& Current, const FEnvironmentalFactors& Incoming) const
+{
+    return Current.Weather != Incoming.Weather
+        || FMath::Abs(Current.AirTemperature - Incoming.AirTemperature) >= TemperaturePublishStep;
+}
+
+void UEnvironmentalFieldSubsystem::PushToRegion(FName Region, const FEnvironmentalFactors& Factors)
+{
+    TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>>* Subscribers = RegionSubscribers.Find(Region);
+    if (!Subscribers)
+    {
+        return;
+    }
+
+    // Subscribers may move region or unsubscribe while handling the push
+    const TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>> Targets = *Subscribers;
+    for (const TWeakObjectPtr<UEnvironmentalFactorsComponent>& Target : Targets)
+    {
+        if (UEnvironmentalFactorsComponent* Component = Target.Get())
+        {
+            Component->UpdateEnvironmentalFactors(Factors);
+        }
+        else
+        {
+            // Destroyed without EndPlay; drop it here
+            SubscriberRegions.Remove(Target);
+            if (TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>>* Remaining = RegionSubscribers.Find(Region))
+            {
+                Remaining->RemoveSingleSwap(Target);
+            }
+        }
+    }
+
+    if (const TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>>* Remaining = RegionSubscribers.Find(Region))
+    {
+        if (Remaining->Num() == 0)
+        {
+            RegionSubscribers.Remove(Region);
+        }
+    }
+}
@@ -1,8 +1,25 @@
 #include "Core/NPCEcosystemSubsystem.h"
 #include "Core/FactionManagerSubsystem.h"
 #include "Core/EconomySubsystem.h"
+#include "Core/SettlementProductionSubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    // Raw good a specialization starts a settlement's stores with; crafting and trade bring none
+    FName GetSpecializationResource(ESettlementSpecialization Specialization)
+    {
+        switch (Specialization)
+        {
+        case ESettlementSpecialization::Agriculture: return TEXT("Grain");
+        case ESettlementSpecialization::Mining:      return TEXT("IronOre");
+        case ESettlementSpecialization::Fishing:     return TEXT("Fish");
+        default:                                     return NAME_None;
+        }
+    }
+}
 
 UNPCEcosystemSubsystem::UNPCEcosystemSubsystem()
 {
@@ -24,6 +41,9 @@ void UNPCEcosystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
+    SettlementProduction = Collection.InitializeDependency<USettlementProductionSubsystem>();
+
+    PopulationRandomStream.GenerateNewSeed();
     InitializeSettlements();
     InitializeNPCArchetypes();
     InitializeSocialNetworks();
@@ -36,7 +56,9 @@ void UNPCEcosystemSubsystem::Deinitialize()
     // Clean up NPC data
     NPCPopulation.Empty();
     Settlements.Empty();
+    SettlementIndex.Empty();
     SocialNetworks.Empty();
+    InteractionQueue.Empty();
     
     Super::Deinitialize();
     UE_LOG(LogTemp, Log, TEXT("NPCEcosystemSubsystem deinitialized"));
@@ -81,19 +103,21 @@ void UNPCEcosystemSubsystem::Tick(float DeltaTime)
 void UNPCEcosystemSubsystem::InitializeSettlements()
 {
     // Create major settlements
-    CreateSettlement(TEXT("Millhaven"), FVector(0, 0, 0), ESettlementType::Village, 150);
-    CreateSettlement(TEXT("Oakstead"), FVector(5000, 0, 0), ESettlementType::Town, 300);
-    CreateSettlement(TEXT("Ironhold"), FVector(-3000, 4000, 0), ESettlementType::City, 450);
-    CreateSettlement(TEXT("Riverside"), FVector(2000, -3000, 0), ESettlementType::Village, 120);
-    CreateSettlement(TEXT("Goldport"), FVector(8000, 6000, 0), ESettlementType::Port, 280);
+    // Regions are the economy markets the settlements trade in
+    CreateSettlement(TEXT("Millhaven"), FVector(0, 0, 0), ESettlementType::Village, 150, TEXT("Heartlands"));
+    CreateSettlement(TEXT("Oakstead"), FVector(5000, 0, 0), ESettlementType::Town, 300, TEXT("Heartlands"));
+    CreateSettlement(TEXT("Ironhold"), FVector(-3000, 4000, 0), ESettlementType::City, 450, TEXT("Frostspire"));
+    CreateSettlement(TEXT("Riverside"), FVector(2000, -3000, 0), ESettlementType::Village, 120, TEXT("Heartlands"));
+    CreateSettlement(TEXT("Goldport"), FVector(8000, 6000, 0), ESettlementType::Port, 280, TEXT("Heartlands"));
     
     UE_LOG(LogTemp, Log, TEXT("Initialized %d settlements"), Settlements.Num());
 }
 
-void UNPCEcosystemSubsystem::CreateSettlement(const FString& Name, const FVector& Location, ESettlementType Type, int32 InitialPopulation)
+void UNPCEcosystemSubsystem::CreateSettlement(const FString& Name, const FVector& Location, ESettlementType Type, int32 InitialPopulation, FName RegionID)
 {
     FSettlementData Settlement;
     Settlement.SettlementName = Name;
+    Settlement.RegionID = RegionID;
     Settlement.Location = Location;
     Settlement.SettlementType = Type;
     Settlement.Population = InitialPopulation;
@@ -129,6 +153,23 @@ void UNPCEcosystemSubsystem::CreateSettlement(const FString& Name, const FVector
     }
     
     Settlements.Add(Name, Settlement);
+    SettlementIndex.FindOrAdd(Name);
+
+    if (SettlementProduction)
+    {
+        SettlementProduction->RegisterSettlement(FName(*Name), RegionID);
+
+        // Seed the stores so crafting workers have inputs before the gatherers have produced any
+        const int32 SeedStock = FMath::RoundToInt(Settlement.ResourceAvailability * InitialPopulation);
+        for (const ESettlementSpecialization Specialization : Settlement.Specializations)
+        {
+            const FName Resource = GetSpecializationResource(Specialization);
+            if (Resource != NAME_None)
+            {
+                SettlementProduction->AddSettlementStock(FName(*Name), Resource, SeedStock);
+            }
+        }
+    }
     
     // Populate settlement with NPCs
     PopulateSettlement(Name, InitialPopulation);
@@ -143,40 +184,70 @@ void UNPCEcosystemSubsystem::PopulateSettlement(const FString& SettlementName, i
     if (!Settlement)
         return;
     
-    for (int32 i = 0; i < PopulationCount; i++)
+    // Generate NPCs in parallel chunks, each with its own stream seeded from the population stream
+    const int32 ChunkSize = 256;
+    const int32 NumChunks = FMath::DivideAndRoundUp(PopulationCount, ChunkSize);
+    const ESettlementType SettlementType = Settlement->SettlementType;
+    const int32 BaseSeed = PopulationRandomStream.RandHelper(MAX_int32);
+    
+    TArray<FNPCData> GeneratedNPCs;
+    GeneratedNPCs.SetNum(PopulationCount);
+    ParallelFor(NumChunks, [this, &GeneratedNPCs, &SettlementName, SettlementType, BaseSeed, ChunkSize, PopulationCount](int32 ChunkIndex)
     {
-        FNPCData NewNPC = GenerateNPC(SettlementName, Settlement->SettlementType);
-        NPCPopulation.Add(NewNPC.NPCID, NewNPC);
+        const FRandomStream ChunkStream(HashCombine(BaseSeed, ChunkIndex));
+        const int32 FirstIndex = ChunkIndex * ChunkSize;
+        const int32 LastIndex = FMath::Min(FirstIndex + ChunkSize, PopulationCount);
+        for (int32 i = FirstIndex; i < LastIndex; i++)
+        {
+            GeneratedNPCs[i] = GenerateNPC(SettlementName, SettlementType, ChunkStream);
+        }
+    });
+    
+    // Insert and index on the game thread
+    NPCPopulation.Reserve(NPCPopulation.Num() + PopulationCount);
+    for (const FNPCData& NewNPC : GeneratedNPCs)
+    {
+        AddNPC(NewNPC);
     }
+    UpdateSettlementProduction(SettlementName);
     
     UE_LOG(LogTemp, Log, TEXT("Populated %s with %d NPCs"), *SettlementName, PopulationCount);
 }
 
-FNPCData UNPCEcosystemSubsystem::GenerateNPC(const FString& SettlementName, ESettlementType SettlementType)
+void UNPCEcosystemSubsystem::UpdateSettlementProduction(const FString& SettlementName)
+{
+    const FSettlementPopulationIndex* Index = SettlementIndex.Find(SettlementName);
+    if (SettlementProduction && Index)
+    {
+        SettlementProduction->SetProfessionWorkers(FName(*SettlementName), Index->ProfessionCounts);
+    }
+}
+
+FNPCData UNPCEcosystemSubsystem::GenerateNPC(const FString& SettlementName, ESettlementType SettlementType, const FRandomStream& RandomStream) const
 {
     FNPCData NewNPC;
     NewNPC.NPCID = FGuid::NewGuid();
-    NewNPC.Name = GenerateNPCName();
+    NewNPC.Name = GenerateNPCName(RandomStream);
     NewNPC.HomeSettlement = SettlementName;
     NewNPC.CurrentSettlement = SettlementName;
     
     // Assign profession based on settlement specializations
-    NewNPC.Profession = AssignProfession(SettlementType);
+    NewNPC.Profession = AssignProfession(SettlementType, RandomStream);
     
     // Generate personality traits
-    NewNPC.PersonalityTraits.Sociability = FMath::FRandRange(0.0f, 1.0f);
-    NewNPC.PersonalityTraits.Ambition = FMath::FRandRange(0.0f, 1.0f);
-    NewNPC.PersonalityTraits.Loyalty = FMath::FRandRange(0.3f, 1.0f); // Most NPCs are somewhat loyal
-    NewNPC.PersonalityTraits.Courage = FMath::FRandRange(0.0f, 1.0f);
-    NewNPC.PersonalityTraits.Intelligence = FMath::FRandRange(0.2f, 1.0f);
+    NewNPC.PersonalityTraits.Sociability = RandomStream.FRandRange(0.0f, 1.0f);
+    NewNPC.PersonalityTraits.Ambition = RandomStream.FRandRange(0.0f, 1.0f);
+    NewNPC.PersonalityTraits.Loyalty = RandomStream.FRandRange(0.3f, 1.0f); // Most NPCs are somewhat loyal
+    NewNPC.PersonalityTraits.Courage = RandomStream.FRandRange(0.0f, 1.0f);
+    NewNPC.PersonalityTraits.Intelligence = RandomStream.FRandRange(0.2f, 1.0f);
     
     // Initialize needs
-    NewNPC.Needs.Hunger = FMath::FRandRange(60.0f, 90.0f);
-    NewNPC.Needs.Thirst = FMath::FRandRange(60.0f, 90.0f);
-    NewNPC.Needs.Rest = FMath::FRandRange(60.0f, 90.0f);
-    NewNPC.Needs.Safety = FMath::FRandRange(50.0f, 80.0f);
-    NewNPC.Needs.Social = FMath::FRandRange(40.0f, 80.0f);
-    NewNPC.Needs.Purpose = FMath::FRandRange(50.0f, 90.0f);
+    NewNPC.Needs.Hunger = RandomStream.FRandRange(60.0f, 90.0f);
+    NewNPC.Needs.Thirst = RandomStream.FRandRange(60.0f, 90.0f);
+    NewNPC.Needs.Rest = RandomStream.FRandRange(60.0f, 90.0f);
+    NewNPC.Needs.Safety = RandomStream.FRandRange(50.0f, 80.0f);
+    NewNPC.Needs.Social = RandomStream.FRandRange(40.0f, 80.0f);
+    NewNPC.Needs.Purpose = RandomStream.FRandRange(50.0f, 90.0f);
     
     // Initialize relationships (will be populated later)
     NewNPC.Relationships.Empty();
@@ -187,32 +258,32 @@ FNPCData UNPCEcosystemSubsystem::GenerateNPC(const FString& SettlementName, ESet
     NewNPC.HealthStatus = ENPCHealthStatus::Healthy;
     
     // Generate daily schedule
-    GenerateDailySchedule(NewNPC);
+    GenerateDailySchedule(NewNPC, RandomStream);
     
     return NewNPC;
 }
 
-FString UNPCEcosystemSubsystem::GenerateNPCName()
+FString UNPCEcosystemSubsystem::GenerateNPCName(const FRandomStream& RandomStream) const
 {
-    TArray<FString> FirstNames = {
+    static const TArray<FString> FirstNames = {
         TEXT("Aldric"), TEXT("Brenna"), TEXT("Cedric"), TEXT("Dara"), TEXT("Ewan"),
         TEXT("Fiona"), TEXT("Gareth"), TEXT("Hilda"), TEXT("Ivan"), TEXT("Jora"),
         TEXT("Kael"), TEXT("Lyra"), TEXT("Magnus"), TEXT("Nora"), TEXT("Osric"),
         TEXT("Petra"), TEXT("Quinn"), TEXT("Rhea"), TEXT("Soren"), TEXT("Thea")
     };
     
-    TArray<FString> LastNames = {
+    static const TArray<FString> LastNames = {
         TEXT("Ironforge"), TEXT("Goldleaf"), TEXT("Stormwind"), TEXT("Brightblade"), TEXT("Darkwood"),
         TEXT("Silverstone"), TEXT("Redmane"), TEXT("Blackwater"), TEXT("Greycloak"), TEXT("Whitehawk")
     };
     
-    FString FirstName = FirstNames[FMath::RandRange(0, FirstNames.Num() - 1)];
-    FString LastName = LastNames[FMath::RandRange(0, LastNames.Num() - 1)];
+    FString FirstName = FirstNames[RandomStream.RandRange(0, FirstNames.Num() - 1)];
+    FString LastName = LastNames[RandomStream.RandRange(0, LastNames.Num() - 1)];
     
     return FString::Printf(TEXT("%s %s"), *FirstName, *LastName);
 }
 
-ENPCProfession UNPCEcosystemSubsystem::AssignProfession(ESettlementType SettlementType)
+ENPCProfession UNPCEcosystemSubsystem::AssignProfession(ESettlementType SettlementType, const FRandomStream& RandomStream) const
 {
     TArray<ENPCProfession> PossibleProfessions;
     
@@ -251,10 +322,10 @@ ENPCProfession UNPCEcosystemSubsystem::AssignProfession(ESettlementType Settleme
         break;
     }
     
-    return PossibleProfessions[FMath::RandRange(0, PossibleProfessions.Num() - 1)];
+    return PossibleProfessions[RandomStream.RandRange(0, PossibleProfessions.Num() - 1)];
 }
 
-void UNPCEcosystemSubsystem::GenerateDailySchedule(FNPCData& NPC)
+void UNPCEcosystemSubsystem::GenerateDailySchedule(FNPCData& NPC, const FRandomStream& RandomStream) const
 {
     NPC.DailySchedule.Empty();
     
@@ -285,7 +356,7 @@ void UNPCEcosystemSubsystem::GenerateDailySchedule(FNPCData& NPC)
         
     case ENPCProfession::Guard:
         // Guards work in shifts
-        if (FMath::RandBool()) // Day shift
+        if (RandomStream.FRand() < 0.5f) // Day shift
         {
             NPC.DailySchedule.Add(FScheduleEntry{22.0f, 8.0f, ENPCActivity::Sleeping, TEXT("Barracks")});
             NPC.DailySchedule.Add(FScheduleEntry{8.0f, 12.0f, ENPCActivity::Patrolling, TEXT("Settlement")});
@@ -368,32 +439,32 @@ void UNPCEcosystemSubsystem::InitializeSocialNetworks()
 
 void UNPCEcosystemSubsystem::CreateSocialConnections(FNPCData& NPC)
 {
-    // Find other NPCs in the same settlement
-    TArray<FGuid> PotentialConnections;
+    // Other NPCs in the same settlement come from the settlement index
+    const FSettlementPopulationIndex* Index = SettlementIndex.Find(NPC.CurrentSettlement);
+    if (!Index)
+        return;
+    
+    const TArray<FGuid>& Residents = Index->Residents;
+    
+    // Create relationships based on personality and profession compatibility
+    int32 MaxConnections = FMath::RandRange(2, 8); // Each NPC has 2-8 relationships
+    int32 ConnectionsToCreate = FMath::Min(MaxConnections, Residents.Num() - 1);
     
-    for (const auto& OtherNPCPair : NPCPopulation)
+    // Sample distinct residents directly rather than collecting the whole settlement first.
+    // Existing relationships are skipped: each one already has its interactions scheduled.
+    TArray<FGuid, TInlineAllocator<8>> PotentialConnections;
+    const int32 MaxAttempts = ConnectionsToCreate * 8;
+    for (int32 Attempt = 0; Attempt < MaxAttempts && PotentialConnections.Num() < ConnectionsToCreate; Attempt++)
     {
-        const FNPCData& OtherNPC = OtherNPCPair.Value;
-        
-        if (OtherNPC.NPCID != NPC.NPCID && OtherNPC.CurrentSettlement == NPC.CurrentSettlement)
+        const FGuid& Candidate = Residents[FMath::RandRange(0, Residents.Num() - 1)];
+        if (Candidate != NPC.NPCID && !NPC.Relationships.Contains(Candidate) && !PotentialConnections.Contains(Candidate))
         {
-            PotentialConnections.Add(OtherNPC.NPCID);
+            PotentialConnections.Add(Candidate);
         }
     }
     
-    // Create relationships based on personality and profession compatibility
-    int32 MaxConnections = FMath::RandRange(2, 8); // Each NPC has 2-8 relationships
-    int32 ConnectionsToCreate = FMath::Min(MaxConnections, PotentialConnections.Num());
-    
-    for (int32 i = 0; i < ConnectionsToCreate; i++)
+    for (const FGuid& TargetNPCID : PotentialConnections)
     {
-        if (PotentialConnections.Num() == 0)
-            break;
-            
-        int32 RandomIndex = FMath::RandRange(0, PotentialConnections.Num() - 1);
-        FGuid TargetNPCID = PotentialConnections[RandomIndex];
-        PotentialConnections.RemoveAt(RandomIndex);
-        
         // Determine relationship type and strength
         ERelationshipType RelType = DetermineRelationshipType(NPC, *NPCPopulation.Find(TargetNPCID));
         float RelStrength = FMath::FRandRange(0.3f, 0.9f);
@@ -402,20 +473,23 @@ void UNPCEcosystemSubsystem::CreateSocialConnections(FNPCData& NPC)
         Relationship.TargetNPCID = TargetNPCID;
         Relationship.RelationshipType = RelType;
         Relationship.RelationshipStrength = RelStrength;
-        Relationship.LastInteractionTime = 0.0f;
+        Relationship.LastInteractionTime = SocialUpdateCount;
         
         NPC.Relationships.Add(TargetNPCID, Relationship);
+        ScheduleNPCInteraction(NPC.NPCID, TargetNPCID);
         
-        // Create reciprocal relationship
-        if (FNPCData* TargetNPC = NPCPopulation.Find(TargetNPCID))
+        // Create reciprocal relationship, scheduling it only if the target didn't already have one
+        FNPCData* TargetNPC = NPCPopulation.Find(TargetNPCID);
+        if (TargetNPC && !TargetNPC->Relationships.Contains(NPC.NPCID))
         {
             FNPCRelationship ReciprocalRelationship;
             ReciprocalRelationship.TargetNPCID = NPC.NPCID;
             ReciprocalRelationship.RelationshipType = RelType;
             ReciprocalRelationship.RelationshipStrength = RelStrength;
-            ReciprocalRelationship.LastInteractionTime = 0.0f;
+            ReciprocalRelationship.LastInteractionTime = SocialUpdateCount;
             
             TargetNPC->Relationships.Add(NPC.NPCID, ReciprocalRelationship);
+            ScheduleNPCInteraction(TargetNPCID, NPC.NPCID);
         }
     }
 }
@@ -480,6 +554,12 @@ void UNPCEcosystemSubsystem::UpdateEcosystem()
     UpdateSettlementConditions();
     UpdatePopulationDynamics();
     ProcessNPCLifeEvents();
+
+    // Deaths, births and migration since the last update change who works in each settlement
+    for (const auto& SettlementPair : Settlements)
+    {
+        UpdateSettlementProduction(SettlementPair.Key);
+    }
     
     UE_LOG(LogTemp, Log, TEXT("Ecosystem updated - Total NPCs: %d"), NPCPopulation.Num());
 }
@@ -568,13 +648,10 @@ float UNPCEcosystemSubsystem::CalculateSecurityFactor(const FSettlementData& Set
     
     // Count guards in settlement
     int32 GuardCount = 0;
-    for (const auto& NPCPair : NPCPopulation)
+    if (const FSettlementPopulationIndex* Index = SettlementIndex.Find(Settlement.SettlementName))
     {
-        const FNPCData& NPC = NPCPair.Value;
-        if (NPC.CurrentSettlement == Settlement.SettlementName && NPC.Profession == ENPCProfession::Guard)
-        {
-            GuardCount++;
-        }
+        const int32* Guards = Index->ProfessionCounts.Find(ENPCProfession::Guard);
+        GuardCount = Guards ? *Guards : 0;
     }
     
     // Security based on guard ratio
@@ -614,8 +691,7 @@ void UNPCEcosystemSubsystem::UpdatePopulationDynamics()
             if (FMath::FRand() < PopulationGrowthRate && Settlement.Population < MaxPopulationPerSettlement)
             {
                 // Add new NPC
-                FNPCData NewNPC = GenerateNPC(Settlement.SettlementName, Settlement.SettlementType);
-                NPCPopulation.Add(NewNPC.NPCID, NewNPC);
+                AddNPC(GenerateNPC(Settlement.SettlementName, Settlement.SettlementType, PopulationRandomStream));
                 Settlement.Population++;
                 
                 UE_LOG(LogTemp, Log, TEXT("Population growth in %s - New population: %d"),
@@ -627,7 +703,8 @@ void UNPCEcosystemSubsystem::UpdatePopulationDynamics()
 
 void UNPCEcosystemSubsystem::ProcessNPCLifeEvents()
 {
-    // Process major life events for NPCs
+    // Process major life events for NPCs; the dead are removed after the loop so the map isn't modified while iterating
+    TArray<FGuid> Deaths;
     for (auto& NPCPair : NPCPopulation)
     {
         FNPCData& NPC = NPCPair.Value;
@@ -635,15 +712,24 @@ void UNPCEcosystemSubsystem::ProcessNPCLifeEvents()
         // Random life events
         if (FMath::FRand() < 0.001f) // Very rare events
         {
-            ProcessLifeEvent(NPC);
+            if (ProcessLifeEvent(NPC))
+            {
+                Deaths.Add(NPCPair.Key);
+                continue;
+            }
         }
         
         // Update NPC needs over time
         UpdateNPCNeeds(NPC);
     }
+    
+    for (const FGuid& NPCID : Deaths)
+    {
+        RemoveNPC(NPCID);
+    }
 }
 
-void UNPCEcosystemSubsystem::ProcessLifeEvent(FNPCData& NPC)
+bool UNPCEcosystemSubsystem::ProcessLifeEvent(FNPCData& NPC)
 {
     // Determine type of life event
     float EventRoll = FMath::FRand();
@@ -651,11 +737,16 @@ void UNPCEcosystemSubsystem::ProcessLifeEvent(FNPCData& NPC)
     if (EventRoll < 0.3f)
     {
         // Career change
-        ENPCProfession NewProfession = AssignProfession(ESettlementType::Village); // Use generic assignment
+        ENPCProfession NewProfession = AssignProfession(ESettlementType::Village, PopulationRandomStream); // Use generic assignment
         if (NewProfession != NPC.Profession)
         {
+            if (FSettlementPopulationIndex* Index = SettlementIndex.Find(NPC.CurrentSettlement))
+            {
+                Index->ProfessionCounts.FindOrAdd(NPC.Profession)--;
+                Index->ProfessionCounts.FindOrAdd(NewProfession)++;
+            }
             NPC.Profession = NewProfession;
-            GenerateDailySchedule(NPC); // Update schedule for new profession
+            GenerateDailySchedule(NPC, PopulationRandomStream); // Update schedule for new profession
             UE_LOG(LogTemp, Log, TEXT("NPC %s changed profession"), *NPC.Name);
         }
     }
@@ -668,11 +759,23 @@ void UNPCEcosystemSubsystem::ProcessLifeEvent(FNPCData& NPC)
     }
     else if (EventRoll < 0.9f)
     {
-        // Health event
+        // Health event; a dying NPC's next one is fatal, and only the sick or injured can start dying
+        if (NPC.HealthStatus == ENPCHealthStatus::Dying)
+        {
+            UE_LOG(LogTemp, Log, TEXT("NPC %s died"), *NPC.Name);
+            return true;
+        }
+        
         TArray<ENPCHealthStatus> PossibleHealth = {ENPCHealthStatus::Healthy, ENPCHealthStatus::Sick, ENPCHealthStatus::Injured};
+        if (NPC.HealthStatus == ENPCHealthStatus::Sick || NPC.HealthStatus == ENPCHealthStatus::Injured)
+        {
+            PossibleHealth.Add(ENPCHealthStatus::Dying);
+        }
         NPC.HealthStatus = PossibleHealth[FMath::RandRange(0, PossibleHealth.Num() - 1)];
         UE_LOG(LogTemp, Log, TEXT("NPC %s health status changed"), *NPC.Name);
     }
+    
+    return false;
 }
 
 void UNPCEcosystemSubsystem::UpdateNPCNeeds(FNPCData& NPC)
@@ -693,43 +796,63 @@ void UNPCEcosystemSubsystem::UpdateNPCNeeds(FNPCData& NPC)
 
 void UNPCEcosystemSubsystem::UpdateSocialInteractions()
 {
-    // Update relationships and social dynamics
-    for (auto& NPCPair : NPCPopulation)
+    ++SocialUpdateCount;
+    
+    // Only relationships with a due interaction are touched; idle decay is evaluated on read
+    int32 InteractionCount = 0;
+    while (InteractionQueue.Num() > 0 && InteractionQueue.HeapTop().DueUpdate <= SocialUpdateCount)
     {
-        FNPCData& NPC = NPCPair.Value;
-        UpdateNPCRelationships(NPC);
+        FScheduledNPCInteraction DueInteraction;
+        InteractionQueue.HeapPop(DueInteraction, EAllowShrinking::No);
+        
+        FNPCData* NPC = NPCPopulation.Find(DueInteraction.NPCID);
+        FNPCRelationship* Relationship = NPC ? NPC->Relationships.Find(DueInteraction.TargetNPCID) : nullptr;
+        if (!Relationship)
+        {
+            continue;
+        }
+        
+        ProcessSocialInteraction(*NPC, *Relationship);
+        ScheduleNPCInteraction(DueInteraction.NPCID, DueInteraction.TargetNPCID);
+        InteractionCount++;
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Updated social interactions for %d NPCs"), NPCPopulation.Num());
+    UE_LOG(LogTemp, Log, TEXT("Processed %d social interactions for %d NPCs"), InteractionCount, NPCPopulation.Num());
 }
 
-void UNPCEcosystemSubsystem::UpdateNPCRelationships(FNPCData& NPC)
+void UNPCEcosystemSubsystem::ScheduleNPCInteraction(const FGuid& NPCID, const FGuid& TargetNPCID)
 {
-    // Update existing relationships
-    for (auto& RelationshipPair : NPC.Relationships)
+    // Each relationship has a 10% chance of an interaction per social update, so the wait
+    // until the next one is geometric and can be drawn once instead of rolled every update
+    const float InteractionChance = 0.1f;
+    const float Roll = FMath::Max(FMath::FRand(), UE_KINDA_SMALL_NUMBER);
+    const int32 UpdatesUntilInteraction = 1 + FMath::FloorToInt(FMath::Loge(Roll) / FMath::Loge(1.0f - InteractionChance));
+    
+    FScheduledNPCInteraction Interaction;
+    Interaction.DueUpdate = SocialUpdateCount + UpdatesUntilInteraction;
+    Interaction.NPCID = NPCID;
+    Interaction.TargetNPCID = TargetNPCID;
+    InteractionQueue.HeapPush(Interaction);
+}
+
+float UNPCEcosystemSubsystem::GetEffectiveRelationshipStrength(const FNPCRelationship& Relationship) const
+{
+    // Relationships naturally decay by 0.01 per update after 30 updates without interaction
+    const float IdleUpdates = SocialUpdateCount - Relationship.LastInteractionTime;
+    const float DecaySteps = FMath::Max(0.0f, IdleUpdates - 30.0f);
+    if (DecaySteps <= 0.0f || Relationship.RelationshipStrength <= 0.1f)
     {
-        FNPCRelationship& Relationship = RelationshipPair.Value;
-        
-        // Relationships naturally decay over time without interaction
-        Relationship.LastInteractionTime += 1.0f; // Increment by update interval
-        
-        if (Relationship.LastInteractionTime > 30.0f) // 30 time units without interaction
-        {
-            Relationship.RelationshipStrength = FMath::Max(0.1f, Relationship.RelationshipStrength - 0.01f);
-        }
-        
-        // Chance for random interaction
-        if (FMath::FRand() < 0.1f) // 10% chance per update
-        {
-            ProcessSocialInteraction(NPC, Relationship);
-        }
+        return Relationship.RelationshipStrength;
     }
+    
+    return FMath::Max(0.1f, Relationship.RelationshipStrength - DecaySteps * 0.01f);
 }
 
 void UNPCEcosystemSubsystem::ProcessSocialInteraction(FNPCData& NPC, FNPCRelationship& Relationship)
 {
-    // Reset interaction timer
-    Relationship.LastInteractionTime = 0.0f;
+    // Materialize idle decay before applying the interaction, then reset the interaction timer
+    Relationship.RelationshipStrength = GetEffectiveRelationshipStrength(Relationship);
+    Relationship.LastInteractionTime = SocialUpdateCount;
     
     // Determine interaction outcome based on relationship type and personalities
     float InteractionOutcome = FMath::FRandRange(-0.1f, 0.1f);
@@ -766,14 +889,28 @@ void UNPCEcosystemSubsystem::UpdateMigrationPatterns()
     // Handle NPCs moving between settlements
     TArray<FGuid> NPCsToMigrate;
     
-    for (const auto& NPCPair : NPCPopulation)
+    for (const auto& IndexPair : SettlementIndex)
     {
-        const FNPCData& NPC = NPCPair.Value;
+        const FSettlementData* Settlement = Settlements.Find(IndexPair.Key);
+        if (!Settlement)
+            continue;
+        
+        // On top of settlement pressure, personality adds at most +0.1 (ambition) or -0.2 (loyalty)
+        // and the random factor at most +0.1, so calm settlements can be skipped outright and
+        // loyal residents only need checking when pressure alone exceeds the threshold
+        const float SettlementPressure = GetSettlementMigrationPressure(*Settlement);
+        if (SettlementPressure + 0.2f <= 0.5f)
+            continue;
         
-        // Check if NPC wants to migrate
-        if (ShouldNPCMigrate(NPC))
+        const TArray<FGuid>& Candidates = (SettlementPressure > 0.5f) ? IndexPair.Value.Residents : IndexPair.Value.MigrationProneResidents;
+        for (const FGuid& NPCID : Candidates)
         {
-            NPCsToMigrate.Add(NPC.NPCID);
+            // Check if NPC wants to migrate
+            const FNPCData* NPC = NPCPopulation.Find(NPCID);
+            if (NPC && ShouldNPCMigrate(*NPC))
+            {
+                NPCsToMigrate.Add(NPCID);
+            }
         }
     }
     
@@ -797,25 +934,7 @@ bool UNPCEcosystemSubsystem::ShouldNPCMigrate(const FNPCData& NPC)
         return false;
     
     // Migration factors
-    float MigrationDesire = 0.0f;
-    
-    // Unhappiness in current settlement
-    if (CurrentSettlement->Happiness < MigrationThreshold)
-    {
-        MigrationDesire += 0.3f;
-    }
-    
-    // Low prosperity
-    if (CurrentSettlement->Prosperity < MigrationThreshold)
-    {
-        MigrationDesire += 0.2f;
-    }
-    
-    // Low security
-    if (CurrentSettlement->Security < MigrationThreshold)
-    {
-        MigrationDesire += 0.2f;
-    }
+    float MigrationDesire = GetSettlementMigrationPressure(*CurrentSettlement);
     
     // Personality factors
     if (NPC.PersonalityTraits.Ambition > 0.7f)
@@ -834,6 +953,31 @@ bool UNPCEcosystemSubsystem::ShouldNPCMigrate(const FNPCData& NPC)
     return MigrationDesire > 0.5f && FMath::FRand() < 0.05f; // 5% chance if conditions are met
 }
 
+float UNPCEcosystemSubsystem::GetSettlementMigrationPressure(const FSettlementData& Settlement) const
+{
+    float Pressure = 0.0f;
+    
+    // Unhappiness in current settlement
+    if (Settlement.Happiness < MigrationThreshold)
+    {
+        Pressure += 0.3f;
+    }
+    
+    // Low prosperity
+    if (Settlement.Prosperity < MigrationThreshold)
+    {
+        Pressure += 0.2f;
+    }
+    
+    // Low security
+    if (Settlement.Security < MigrationThreshold)
+    {
+        Pressure += 0.2f;
+    }
+    
+    return Pressure;
+}
+
 void UNPCEcosystemSubsystem::ProcessNPCMigration(const FGuid& NPCID)
 {
     FNPCData* NPC = NPCPopulation.Find(NPCID);
@@ -872,7 +1016,9 @@ void UNPCEcosystemSubsystem::ProcessNPCMigration(const FGuid& NPCID)
     if (!BestDestination.IsEmpty() && BestScore > 0.4f)
     {
         FString OldSettlement = NPC->CurrentSettlement;
+        UnindexNPC(*NPC);
         NPC->CurrentSettlement = BestDestination;
+        IndexNPC(*NPC);
         
         // Update settlement populations
         if (FSettlementData* OldSettlementData = Settlements.Find(OldSettlement))
@@ -948,4 +1094,67 @@ void UNPCEcosystemSubsystem::UpdateNPCActivity(FNPCData& NPC, float DeltaTime)
             break;
         }
     }
-}
\ No newline at end of file
+}
+
+void UNPCEcosystemSubsystem::RemoveNPC(const FGuid& NPCID)
+{
+    const FNPCData* NPC = NPCPopulation.Find(NPCID);
+    if (!NPC)
+        return;
+    
+    UnindexNPC(*NPC);
+    if (FSettlementData* Settlement = Settlements.Find(NPC->CurrentSettlement))
+    {
+        Settlement->Population = FMath::Max(0, Settlement->Population - 1);
+    }
+    
+    // Relationships are reciprocal, so only the NPC's own neighbours hold references to it
+    for (const auto& RelPair : NPC->Relationships)
+    {
+        if (FNPCData* Other = NPCPopulation.Find(RelPair.Key))
+        {
+            Other->Relationships.Remove(NPCID);
+        }
+    }
+    NPCPopulation.Remove(NPCID);
+}
+
+void UNPCEcosystemSubsystem::AddNPC(const FNPCData& NPC)
+{
+    NPCPopulation.Add(NPC.NPCID, NPC);
+    IndexNPC(NPC);
+}
+
+void UNPCEcosystemSubsystem::IndexNPC(const FNPCData& NPC)
+{
+    FSettlementPopulationIndex& Index = SettlementIndex.FindOrAdd(NPC.CurrentSettlement);
+    Index.Residents.Add(NPC.NPCID);
+    if (IsMigrationProne(NPC))
+    {
+        Index.MigrationProneResidents.Add(NPC.NPCID);
+    }
+    Index.ProfessionCounts.FindOrAdd(NPC.Profession)++;
+}
+
+void UNPCEcosystemSubsystem::UnindexNPC(const FNPCData& NPC)
+{
+    FSettlementPopulationIndex* Index = SettlementIndex.Find(NPC.CurrentSettlement);
+    if (!Index)
+        return;
+    
+    Index->Residents.RemoveSwap(NPC.NPCID, EAllowShrinking::No);
+    if (IsMigrationProne(NPC))
+    {
+        Index->MigrationProneResidents.RemoveSwap(NPC.NPCID, EAllowShrinking::No);
+    }
+    if (int32* Count = Index->ProfessionCounts.Find(NPC.Profession))
+    {
+        *Count = FMath::Max(0, *Count - 1);
+    }
+}
+
+bool UNPCEcosystemSubsystem::IsMigrationProne(const FNPCData& NPC)
+{
+    // Matches the loyalty penalty in ShouldNPCMigrate
+    return NPC.PersonalityTraits.Loyalty <= 0.8f;
+}
@@ -6,6 +6,7 @@
 #include "Components/StatlineComponent.h"
 #include "Components/DAQuestLogComponent.h"
 #include "Components/PlayerSkillsComponent.h"
+#include "Core/QuestRuntimeSubsystem.h"
 
 bool UPlayerProfileManager::SaveProfile(const FString& SlotName, UPlayerSaveGame* SaveData)
 {
@@ -55,6 +56,11 @@ bool UPlayerProfileManager::SaveProfile(const FString& SlotName, UPlayerSaveGame
         }
     }
 
+    if (UQuestRuntimeSubsystem* QuestRuntime = GetGameInstance()->GetSubsystem<UQuestRuntimeSubsystem>())
+    {
+        QuestRuntime->SaveQuests(SaveData->DynamicQuests);
+    }
+
     SaveData->LastSaveTime = FDateTime::Now();
     return UGameplayStatics::SaveGameToSlot(SaveData, SlotName, 0);
 }
@@ -111,6 +117,11 @@ UPlayerSaveGame* UPlayerProfileManager::LoadProfile(const FString& SlotName)
                     }
                 }
             }
+
+            if (UQuestRuntimeSubsystem* QuestRuntime = GetGameInstance()->GetSubsystem<UQuestRuntimeSubsystem>())
+            {
+                QuestRuntime->LoadQuests(SaveData->DynamicQuests);
+            }
             return SaveData;
         }
     }
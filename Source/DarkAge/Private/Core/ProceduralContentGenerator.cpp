@@ -1,5 +1,47 @@
 #include "Core/ProceduralContentGenerator.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+FArchive& operator<<(FArchive& Ar, FProceduralLocation& Location)
+{
+    Ar << Location.LocationName;
+    Ar << Location.Position;
+    Ar << Location.LocationType;
+    Ar << Location.Features;
+    Ar << Location.DangerLevel;
+    Ar << Location.EconomicValue;
+    return Ar;
+}
+
+// QuestID is left out: it is assigned per call, so cached quests never share one
+FArchive& operator<<(FArchive& Ar, FProceduralQuest& Quest)
+{
+    Ar << Quest.QuestTitle;
+    Ar << Quest.QuestDescription;
+    Ar << Quest.QuestType;
+    Ar << Quest.TargetLocation;
+    Ar << Quest.Objectives;
+    Ar << Quest.QuestData;
+    Ar << Quest.Difficulty;
+    Ar << Quest.RewardGold;
+    Ar << Quest.RewardItems;
+    return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FProceduralNPC& NPC)
+{
+    Ar << NPC.NPCName;
+    Ar << NPC.NPCType;
+    Ar << NPC.PersonalityType;
+    Ar << NPC.Background;
+    Ar << NPC.Skills;
+    Ar << NPC.Relationships;
+    Ar << NPC.Wealth;
+    Ar << NPC.Influence;
+    return Ar;
+}
 
 UProceduralContentGenerator::UProceduralContentGenerator()
 {
@@ -11,13 +53,66 @@ void UProceduralContentGenerator::Initialize(FSubsystemCollectionBase& Collectio
 {
     Super::Initialize(Collection);
     InitializeContentTemplates();
+
+    const FString CachePath = FPaths::ProjectSavedDir() / TEXT("ProcGenCache.bin");
+    GenerationCache.Open(CachePath, static_cast<int64>(MaxCacheSizeMB) * 1024 * 1024);
 }
 
 void UProceduralContentGenerator::Deinitialize()
 {
+    GenerationCache.Flush();
+    GenerationCache.Reset();
+
     Super::Deinitialize();
 }
 
+void UProceduralContentGenerator::FlushGenerationCache()
+{
+    GenerationCache.Flush();
+}
+
+template <typename... ArgTypes>
+uint64 UProceduralContentGenerator::MakeGenerationKey(const TCHAR* Generator, ArgTypes... Args)
+{
+    KeyScratch.Reset();
+    FMemoryWriter Writer(KeyScratch);
+
+    uint32 Version = GeneratorVersion;
+    FString GeneratorName(Generator);
+    Writer << Version << TemplateHash << RandomSeed << GeneratorName;
+    (Writer << ... << Args);
+
+    return FDAGenerationCache::MakeKey(KeyScratch);
+}
+
+void UProceduralContentGenerator::BeginGeneration(uint64 Key)
+{
+    RandomStream.Initialize(static_cast<int32>(Key ^ (Key >> 32)));
+}
+
+template <typename ResultType>
+bool UProceduralContentGenerator::LoadCachedResult(uint64 Key, ResultType& OutResult) const
+{
+    const TConstArrayView<uint8> Payload = GenerationCache.Find(Key);
+    if (Payload.Num() == 0)
+    {
+        return false;
+    }
+
+    FMemoryReaderView Reader(Payload);
+    Reader << OutResult;
+    return !Reader.IsError();
+}
+
+template <typename ResultType>
+void UProceduralContentGenerator::StoreResult(uint64 Key, ResultType& Result)
+{
+    PayloadScratch.Reset();
+    FMemoryWriter Writer(PayloadScratch);
+    Writer << Result;
+    GenerationCache.Add(Key, PayloadScratch);
+}
+
 void UProceduralContentGenerator::InitializeContentTemplates()
 {
     // Location types
@@ -56,9 +151,34 @@ void UProceduralContentGenerator::InitializeContentTemplates()
         "Bandit Attack", "Merchant Caravan", "Strange Occurrence", "Political Crisis",
         "Resource Discovery", "Festival", "Natural Disaster", "Royal Visit"
     };
+
+    TemplateHash = 0;
+    for (const TArray<FString>* Table : { &LocationTypes, &LocationFeatures, &QuestTypes, &NPCNames, &NPCBackgrounds, &EventTypes })
+    {
+        for (const FString& Entry : *Table)
+        {
+            TemplateHash = HashCombine(TemplateHash, GetTypeHash(Entry));
+        }
+        TemplateHash = HashCombine(TemplateHash, ::GetTypeHash(Table->Num()));
+    }
+}
+
+FProceduralLocation UProceduralContentGenerator::GenerateLocation(const FVector& BasePosition, const FString& PreferredType, int32 Variant)
+{
+    FProceduralLocation Location;
+    const uint64 Key = MakeGenerationKey(TEXT("Location"), BasePosition, PreferredType, Variant);
+    if (LoadCachedResult(Key, Location))
+    {
+        return Location;
+    }
+
+    BeginGeneration(Key);
+    Location = BuildLocation(BasePosition, PreferredType);
+    StoreResult(Key, Location);
+    return Location;
 }
 
-FProceduralLocation UProceduralContentGenerator::GenerateLocation(const FVector& BasePosition, const FString& PreferredType)
+FProceduralLocation UProceduralContentGenerator::BuildLocation(const FVector& BasePosition, const FString& PreferredType)
 {
     FProceduralLocation Location;
 
@@ -89,24 +209,61 @@ FProceduralLocation UProceduralContentGenerator::GenerateLocation(const FVector&
     return Location;
 }
 
-TArray<FProceduralLocation> UProceduralContentGenerator::GenerateRegion(int32 LocationCount, const FVector& Center, float Radius)
+TArray<FProceduralLocation> UProceduralContentGenerator::GenerateRegion(int32 LocationCount, const FVector& Center, float Radius, const FString& RegionID, int32 Variant)
 {
     TArray<FProceduralLocation> Locations;
+    const uint64 Key = MakeGenerationKey(TEXT("Region"), LocationCount, Center, Radius, RegionID, Variant);
+    if (LoadCachedResult(Key, Locations))
+    {
+        return Locations;
+    }
 
+    // One stream for the whole region, so its locations differ from each other
+    BeginGeneration(Key);
+    Locations.Reserve(LocationCount);
     for (int32 i = 0; i < LocationCount; ++i)
     {
-        FProceduralLocation Location = GenerateLocation(Center);
-        Locations.Add(Location);
+        Locations.Add(BuildLocation(Center, FString()));
     }
 
+    StoreResult(Key, Locations);
     return Locations;
 }
 
-FProceduralQuest UProceduralContentGenerator::GenerateQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation)
+FProceduralQuest UProceduralContentGenerator::GenerateQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation, int32 Variant)
+{
+    // Keyed on the player's cell rather than the exact position, and built from the cell centre so the key fixes the result
+    FProceduralQuest Quest;
+    const FIntVector Cell = GetQuestCell(PlayerLocation);
+    const uint64 Key = MakeGenerationKey(TEXT("Quest"), QuestType, Difficulty, Cell, Variant);
+    if (!LoadCachedResult(Key, Quest))
+    {
+        BeginGeneration(Key);
+        Quest = BuildQuest(QuestType, Difficulty, GetQuestCellCenter(Cell));
+        StoreResult(Key, Quest);
+    }
+
+    AssignQuestID(Quest);
+    return Quest;
+}
+
+FIntVector UProceduralContentGenerator::GetQuestCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / QuestLocationCellSize),
+        FMath::FloorToInt(Location.Y / QuestLocationCellSize),
+        FMath::FloorToInt(Location.Z / QuestLocationCellSize));
+}
+
+FVector UProceduralContentGenerator::GetQuestCellCenter(const FIntVector& Cell) const
+{
+    return (FVector(Cell) + FVector(0.5)) * QuestLocationCellSize;
+}
+
+FProceduralQuest UProceduralContentGenerator::BuildQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation)
 {
     FProceduralQuest Quest;
 
-    Quest.QuestID = FString::Printf(TEXT("Quest_%d_%s"), GetRandomInt(1000, 9999), *QuestType);
     Quest.QuestType = QuestType;
     Quest.Difficulty = Difficulty;
 
@@ -132,28 +289,59 @@ FProceduralQuest UProceduralContentGenerator::GenerateQuest(const FString& Quest
     return Quest;
 }
 
-TArray<FProceduralQuest> UProceduralContentGenerator::GenerateQuestChain(int32 ChainLength, const FVector& StartLocation)
+TArray<FProceduralQuest> UProceduralContentGenerator::GenerateQuestChain(int32 ChainLength, const FVector& StartLocation, int32 Variant)
 {
     TArray<FProceduralQuest> QuestChain;
+    const FIntVector StartCell = GetQuestCell(StartLocation);
+    const uint64 Key = MakeGenerationKey(TEXT("QuestChain"), ChainLength, StartCell, Variant);
+    if (!LoadCachedResult(Key, QuestChain))
+    {
+        BeginGeneration(Key);
+        FVector CurrentLocation = GetQuestCellCenter(StartCell);
 
-    FVector CurrentLocation = StartLocation;
+        for (int32 i = 0; i < ChainLength; ++i)
+        {
+            FString QuestType = GetRandomElement(QuestTypes);
+            int32 Difficulty = FMath::Clamp(i + 1, 1, 5); // Increasing difficulty
 
-    for (int32 i = 0; i < ChainLength; ++i)
-    {
-        FString QuestType = GetRandomElement(QuestTypes);
-        int32 Difficulty = FMath::Clamp(i + 1, 1, 5); // Increasing difficulty
+            FProceduralQuest Quest = BuildQuest(QuestType, Difficulty, CurrentLocation);
 
-        FProceduralQuest Quest = GenerateQuest(QuestType, Difficulty, CurrentLocation);
-        QuestChain.Add(Quest);
+            // Next quest starts near the previous one's target
+            CurrentLocation = Quest.TargetLocation;
+            QuestChain.Add(MoveTemp(Quest));
+        }
 
-        // Next quest starts near the previous one's target
-        CurrentLocation = Quest.TargetLocation;
+        StoreResult(Key, QuestChain);
     }
 
+    for (FProceduralQuest& Quest : QuestChain)
+    {
+        AssignQuestID(Quest);
+    }
     return QuestChain;
 }
 
-FProceduralNPC UProceduralContentGenerator::GenerateNPC(const FString& NPCType, int32 PowerLevel)
+void UProceduralContentGenerator::AssignQuestID(FProceduralQuest& Quest)
+{
+    Quest.QuestID = FString::Printf(TEXT("Quest_%s_%s"), *Quest.QuestType, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+FProceduralNPC UProceduralContentGenerator::GenerateNPC(const FString& NPCType, int32 PowerLevel, int32 Variant)
+{
+    FProceduralNPC NPC;
+    const uint64 Key = MakeGenerationKey(TEXT("NPC"), NPCType, PowerLevel, Variant);
+    if (LoadCachedResult(Key, NPC))
+    {
+        return NPC;
+    }
+
+    BeginGeneration(Key);
+    NPC = BuildNPC(NPCType, PowerLevel);
+    StoreResult(Key, NPC);
+    return NPC;
+}
+
+FProceduralNPC UProceduralContentGenerator::BuildNPC(const FString& NPCType, int32 PowerLevel)
 {
     FProceduralNPC NPC;
 
@@ -161,7 +349,7 @@ FProceduralNPC UProceduralContentGenerator::GenerateNPC(const FString& NPCType,
     NPC.NPCName = GenerateNPCName(NPCType);
 
     // Generate personality
-    TArray<FString> Personalities = {"Brave", "Cowardly", "Greedy", "Generous", "Honest", "Deceitful"};
+    static const TArray<FString> Personalities = {"Brave", "Cowardly", "Greedy", "Generous", "Honest", "Deceitful"};
     NPC.PersonalityType = GetRandomElement(Personalities);
 
     // Generate background
@@ -181,9 +369,16 @@ FProceduralNPC UProceduralContentGenerator::GenerateNPC(const FString& NPCType,
     return NPC;
 }
 
-TArray<FProceduralNPC> UProceduralContentGenerator::GenerateSettlementNPCs(int32 NPCCount, const FString& SettlementType)
+TArray<FProceduralNPC> UProceduralContentGenerator::GenerateSettlementNPCs(int32 NPCCount, const FString& SettlementType, const FString& SettlementID, int32 Variant)
 {
     TArray<FProceduralNPC> NPCs;
+    const uint64 Key = MakeGenerationKey(TEXT("SettlementNPCs"), NPCCount, SettlementType, SettlementID, Variant);
+    if (LoadCachedResult(Key, NPCs))
+    {
+        return NPCs;
+    }
+
+    BeginGeneration(Key);
 
     TArray<FString> NPCTypes;
     if (SettlementType == "Village")
@@ -199,19 +394,23 @@ TArray<FProceduralNPC> UProceduralContentGenerator::GenerateSettlementNPCs(int32
         NPCTypes = {"Merchant", "Guard", "Innkeeper", "Blacksmith", "Priest", "Scholar"};
     }
 
+    NPCs.Reserve(NPCCount);
     for (int32 i = 0; i < NPCCount; ++i)
     {
         FString NPCType = GetRandomElement(NPCTypes);
         int32 PowerLevel = GetRandomInt(1, 3);
-        FProceduralNPC NPC = GenerateNPC(NPCType, PowerLevel);
-        NPCs.Add(NPC);
+        NPCs.Add(BuildNPC(NPCType, PowerLevel));
     }
 
+    StoreResult(Key, NPCs);
     return NPCs;
 }
 
 FString UProceduralContentGenerator::GenerateRandomEvent(const FVector& Location)
 {
+    // A single table pick, too small to be worth caching. The sequence number makes every
+    // call a new draw while a given seed still replays the same run of events.
+    BeginGeneration(MakeGenerationKey(TEXT("Event"), Location, EventSequence++));
     return GetRandomElement(EventTypes);
 }
 
@@ -219,9 +418,11 @@ TArray<FString> UProceduralContentGenerator::GenerateEventChain(int32 EventCount
 {
     TArray<FString> Events;
 
+    BeginGeneration(MakeGenerationKey(TEXT("EventChain"), EventCount, EventSequence++));
+    Events.Reserve(EventCount);
     for (int32 i = 0; i < EventCount; ++i)
     {
-        Events.Add(GenerateRandomEvent(FVector::ZeroVector));
+        Events.Add(GetRandomElement(EventTypes));
     }
 
     return Events;
@@ -231,13 +432,14 @@ void UProceduralContentGenerator::SeedRandomGenerator(int32 Seed)
 {
     RandomSeed = Seed;
     RandomStream.Initialize(RandomSeed);
+    EventSequence = 0;
 }
 
 // Private helper functions
 FString UProceduralContentGenerator::GenerateLocationName(const FString& Type)
 {
-    TArray<FString> Prefixes = {"North", "South", "East", "West", "High", "Low", "Old", "New"};
-    TArray<FString> Suffixes = {"ville", "town", "burg", "ford", "ham", "field", "wood", "hill"};
+    static const TArray<FString> Prefixes = {"North", "South", "East", "West", "High", "Low", "Old", "New"};
+    static const TArray<FString> Suffixes = {"ville", "town", "burg", "ford", "ham", "field", "wood", "hill"};
 
     FString Prefix = GetRandomBool(0.5f) ? GetRandomElement(Prefixes) + " " : "";
     FString Suffix = GetRandomBool(0.7f) ? GetRandomElement(Suffixes) : "";
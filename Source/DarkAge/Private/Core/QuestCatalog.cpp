@@ -0,0 +1,100 @@
+#include "Core/QuestCatalog.h"
+#include "Engine/DataTable.h"
+
+void FQuestCatalog::Build(const UDataTable* InQuestDataTable)
+{
+    Reset();
+    if (!InQuestDataTable || InQuestDataTable->GetRowStruct() == nullptr || !InQuestDataTable->GetRowStruct()->IsChildOf(FQuestData::StaticStruct()))
+    {
+        return;
+    }
+
+    SourceTable = InQuestDataTable;
+
+    const TMap<FName, uint8*>& RowMap = InQuestDataTable->GetRowMap();
+    QuestIDs.Reserve(RowMap.Num());
+    Rows.Reserve(RowMap.Num());
+    IndexByQuestID.Reserve(RowMap.Num());
+    FirstStageOfQuest.Reserve(RowMap.Num() + 1);
+
+    for (const TPair<FName, uint8*>& Row : RowMap)
+    {
+        const FQuestData* QuestData = reinterpret_cast<const FQuestData*>(Row.Value);
+        const int32 QuestIndex = QuestIDs.Add(Row.Key);
+        Rows.Add(QuestData);
+        IndexByQuestID.Add(Row.Key, QuestIndex);
+        RequiresPrerequisiteCheck.Add(QuestData->RequiredItems.Num() > 0);
+
+        FirstStageOfQuest.Add(CompiledStages.Num());
+        for (const FQuestStageEntry& StageEntry : QuestData->Stages)
+        {
+            FCompiledStage& Stage = CompiledStages.AddDefaulted_GetRef();
+            Stage.StageID = StageEntry.StageID;
+            Stage.FirstBranch = StageBranches.Num();
+            Stage.NumBranches = StageEntry.Stage.Branches.Num();
+            for (const FQuestBranch& Branch : StageEntry.Stage.Branches)
+            {
+                StageBranches.Add(FStageBranch{Branch.NextStageID, Conditions.CompileClause(Branch.Conditions)});
+            }
+        }
+
+        QuestsByRegion.FindOrAdd(QuestData->RegionID).Add(QuestIndex);
+        QuestsByGiver.FindOrAdd(QuestData->QuestGiver).Add(QuestIndex);
+        QuestsByType.FindOrAdd(QuestData->QuestType).Add(QuestIndex);
+        for (const FName& Tag : QuestData->Tags)
+        {
+            TArray<int32>& Tagged = QuestsByTag.FindOrAdd(Tag);
+            if (Tagged.Num() == 0 || Tagged.Last() != QuestIndex)
+            {
+                Tagged.Add(QuestIndex);
+            }
+        }
+    }
+
+    FirstStageOfQuest.Add(CompiledStages.Num());
+
+    UE_LOG(LogTemp, Log, TEXT("QuestCatalog: indexed %d quests (%d regions, %d givers, %d tags, %d branch conditions)"),
+        QuestIDs.Num(), QuestsByRegion.Num(), QuestsByGiver.Num(), QuestsByTag.Num(), Conditions.NumInstructions());
+}
+
+void FQuestCatalog::Reset()
+{
+    SourceTable.Reset();
+    QuestIDs.Reset();
+    Rows.Reset();
+    RequiresPrerequisiteCheck.Reset();
+    IndexByQuestID.Reset();
+    QuestsByRegion.Reset();
+    QuestsByGiver.Reset();
+    QuestsByTag.Reset();
+    QuestsByType.Reset();
+    FirstStageOfQuest.Reset();
+    CompiledStages.Reset();
+    StageBranches.Reset();
+    Conditions.Reset();
+}
+
+int32 FQuestCatalog::FindQuestIndex(FName QuestID) const
+{
+    const int32* QuestIndex = IndexByQuestID.Find(QuestID);
+    return QuestIndex ? *QuestIndex : INDEX_NONE;
+}
+
+bool FQuestCatalog::FindStageBranches(int32 QuestIndex, FName StageID, TConstArrayView<FStageBranch>& OutBranches) const
+{
+    if (!QuestIDs.IsValidIndex(QuestIndex))
+    {
+        return false;
+    }
+
+    for (int32 StageIndex = FirstStageOfQuest[QuestIndex]; StageIndex < FirstStageOfQuest[QuestIndex + 1]; ++StageIndex)
+    {
+        const FCompiledStage& Stage = CompiledStages[StageIndex];
+        if (Stage.StageID == StageID)
+        {
+            OutBranches = TConstArrayView<FStageBranch>(StageBranches.GetData() + Stage.FirstBranch, Stage.NumBranches);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,229 @@
+#include "Core/QuestEventLog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace QuestEventLog
+{
+    static void SerializeEntry(FArchive& Ar, FQuestEventLogEntry& Entry)
+    {
+        uint8 EventType = static_cast<uint8>(Entry.EventType);
+        Ar << Entry.QuestID;
+        Ar << EventType;
+        Ar << Entry.PlayerID;
+        Ar << Entry.ChoiceOrDetail;
+        Ar << Entry.Timestamp;
+        Entry.EventType = static_cast<EQuestEventType>(EventType);
+    }
+}
+
+FQuestEventLog::FQuestEventLog(int32 InSegmentSize, int32 InMaxSegments)
+    : SegmentSize(FMath::Max(1, InSegmentSize))
+{
+    Segments.SetNum(FMath::Max(1, InMaxSegments));
+}
+
+void FQuestEventLog::FSegment::Reset()
+{
+    Entries.Reset();
+    EntriesByQuest.Reset();
+    for (TArray<int32>& TypeEntries : EntriesByType)
+    {
+        TypeEntries.Reset();
+    }
+}
+
+void FQuestEventLog::Add(FQuestEventLogEntry&& Entry)
+{
+    const int32 TypeIndex = static_cast<int32>(Entry.EventType);
+    if (TypeIndex < 0 || TypeIndex >= NumEventTypes)
+    {
+        return;
+    }
+
+    ++TotalCounts.Counts[TypeIndex];
+    ++CountsByQuest.FindOrAdd(Entry.QuestID).Counts[TypeIndex];
+
+    FSegment& Segment = (NumSegments == 0 || GetSegment(NumSegments - 1).Entries.Num() >= SegmentSize)
+        ? StartSegment()
+        : GetSegment(NumSegments - 1);
+
+    const int32 EntryIndex = Segment.Entries.Num();
+    Segment.EntriesByQuest.FindOrAdd(Entry.QuestID).Add(EntryIndex);
+    Segment.EntriesByType[TypeIndex].Add(EntryIndex);
+    Segment.Entries.Add(MoveTemp(Entry));
+}
+
+void FQuestEventLog::ForgetQuest(const FString& QuestID)
+{
+    CountsByQuest.Remove(QuestID);
+}
+
+void FQuestEventLog::Reset()
+{
+    for (FSegment& Segment : Segments)
+    {
+        Segment.Reset();
+    }
+    OldestSegment = 0;
+    NumSegments = 0;
+    SpilledCount = 0;
+    TotalCounts = FEventCounts();
+    CountsByQuest.Reset();
+}
+
+FQuestEventLog::FSegment& FQuestEventLog::StartSegment()
+{
+    if (NumSegments == Segments.Num())
+    {
+        FSegment& Oldest = GetSegment(0);
+        SpillSegment(Oldest);
+        Oldest.Reset();
+        OldestSegment = (OldestSegment + 1) % Segments.Num();
+        --NumSegments;
+    }
+
+    FSegment& Segment = GetSegment(NumSegments++);
+    Segment.Reset();
+    Segment.Entries.Reserve(SegmentSize);
+    return Segment;
+}
+
+void FQuestEventLog::SpillSegment(const FSegment& Segment)
+{
+    SpilledCount += Segment.Entries.Num();
+    if (SpillPath.IsEmpty() || Segment.Entries.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<uint8> SpillData;
+    FMemoryWriter MemoryWriter(SpillData, true);
+
+    int32 EntryCount = Segment.Entries.Num();
+    MemoryWriter << EntryCount;
+    for (const FQuestEventLogEntry& Entry : Segment.Entries)
+    {
+        FQuestEventLogEntry Copy = Entry;
+        QuestEventLog::SerializeEntry(MemoryWriter, Copy);
+    }
+
+    if (!FFileHelper::SaveArrayToFile(SpillData, *SpillPath, &IFileManager::Get(), FILEWRITE_Append))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("QuestEventLog: failed to spill %d events to %s"), EntryCount, *SpillPath);
+    }
+}
+
+void FQuestEventLog::Query(const FString& QuestID, EQuestEventType EventType, int32 MaxResults, TArray<FQuestEventLogEntry>& OutEntries) const
+{
+    const int32 TypeIndex = static_cast<int32>(EventType);
+    if (TypeIndex < 0 || TypeIndex >= NumEventTypes)
+    {
+        return;
+    }
+
+    for (int32 Age = NumSegments - 1; Age >= 0 && OutEntries.Num() < MaxResults; --Age)
+    {
+        const FSegment& Segment = GetSegment(Age);
+        const TArray<int32>* Candidates = QuestID.IsEmpty() ? &Segment.EntriesByType[TypeIndex] : Segment.EntriesByQuest.Find(QuestID);
+        if (!Candidates)
+        {
+            continue;
+        }
+
+        for (int32 i = Candidates->Num() - 1; i >= 0 && OutEntries.Num() < MaxResults; --i)
+        {
+            const FQuestEventLogEntry& Entry = Segment.Entries[(*Candidates)[i]];
+            if (Entry.EventType == EventType)
+            {
+                OutEntries.Add(Entry);
+            }
+        }
+    }
+}
+
+int32 FQuestEventLog::GetCount(const FString& QuestID, EQuestEventType EventType) const
+{
+    const int32 TypeIndex = static_cast<int32>(EventType);
+    if (TypeIndex < 0 || TypeIndex >= NumEventTypes)
+    {
+        return 0;
+    }
+
+    if (QuestID.IsEmpty())
+    {
+        return TotalCounts.Counts[TypeIndex];
+    }
+
+    const FEventCounts* QuestCounts = CountsByQuest.Find(QuestID);
+    return QuestCounts ? QuestCounts->Counts[TypeIndex] : 0;
+}
+
+int32 FQuestEventLog::NumResident() const
+{
+    int32 Count = 0;
+    for (int32 Age = 0; Age < NumSegments; ++Age)
+    {
+        Count += GetSegment(Age).Entries.Num();
+    }
+    return Count;
+}
+
+bool FQuestEventLog::LoadSpilledEntries(const FString& Path, TArray<FQuestEventLogEntry>& OutEntries)
+{
+    TArray<uint8> SpillData;
+    if (!FFileHelper::LoadFileToArray(SpillData, *Path))
+    {
+        return false;
+    }
+
+    FMemoryReader MemoryReader(SpillData, true);
+    while (!MemoryReader.AtEnd() && !MemoryReader.IsError())
+    {
+        int32 EntryCount = 0;
+        MemoryReader << EntryCount;
+        for (int32 i = 0; i < EntryCount && !MemoryReader.IsError(); ++i)
+        {
+            FQuestEventLogEntry Entry;
+            QuestEventLog::SerializeEntry(MemoryReader, Entry);
+            OutEntries.Add(MoveTemp(Entry));
+        }
+    }
+
+    return !MemoryReader.IsError();
+}
+
+void FQuestEventLog::RotateSpillFile(const FString& Path, int32 MaxBackups)
+{
+    IFileManager& FileManager = IFileManager::Get();
+    if (Path.IsEmpty() || !FileManager.FileExists(*Path))
+    {
+        return;
+    }
+
+    if (MaxBackups <= 0)
+    {
+        FileManager.Delete(*Path);
+        return;
+    }
+
+    const FString BasePath = FPaths::GetBaseFilename(Path, false);
+    const FString Extension = FPaths::GetExtension(Path, true);
+    const auto GetBackupPath = [&BasePath, &Extension](int32 Backup)
+    {
+        return FString::Printf(TEXT("%s_%d%s"), *BasePath, Backup, *Extension);
+    };
+
+    FileManager.Delete(*GetBackupPath(MaxBackups));
+    for (int32 Backup = MaxBackups - 1; Backup >= 1; --Backup)
+    {
+        const FString BackupPath = GetBackupPath(Backup);
+        if (FileManager.FileExists(*BackupPath))
+        {
+            FileManager.Move(*GetBackupPath(Backup + 1), *BackupPath);
+        }
+    }
+    FileManager.Move(*GetBackupPath(1), *Path);
+}
@@ -8,18 +8,27 @@
 #include "GameFramework/PlayerController.h"
 #include "BaseClass/DAPlayerCharacter.h"
 #include "Components/InventoryComponent.h"
-#include "Components/StatlineComponent.h"
-#include "Core/SocialSimulationSubsystem.h"
 #include "Data/ItemData.h"
 #include "Items/DABaseItem.h"
 
 void UQuestManagementSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+
+    if (QuestDataTable)
+    {
+        BuildQuestCatalog();
+    }
 }
 
 void UQuestManagementSubsystem::Deinitialize()
 {
+    ReleaseQuestLogBinding();
+    if (UDataTable* SourceTable = const_cast<UDataTable*>(QuestCatalog.GetSourceTable()))
+    {
+        SourceTable->OnDataTableChanged().Remove(QuestDataTableChangedHandle);
+    }
+    QuestCatalog.Reset();
     Super::Deinitialize();
 }
 
@@ -49,13 +58,14 @@ bool UQuestManagementSubsystem::StartQuest(FName QuestID, const FString& QuestGi
 
 bool UQuestManagementSubsystem::IsQuestAvailable(FName QuestID) const
 {
-    FQuestData QuestData;
-    if (!GetQuestData(QuestID, QuestData))
+    const int32 QuestIndex = GetQuestCatalog().FindQuestIndex(QuestID);
+    if (QuestIndex == INDEX_NONE)
     {
         return false;
     }
 
-    return GetQuestState(QuestID) == EQuestState::QS_NotStarted && CheckQuestPrerequisites(QuestData);
+    const TBitArray<>* NotStarted = GetNotStartedQuests();
+    return NotStarted && IsCatalogQuestAvailable(QuestIndex, *NotStarted);
 }
 
 bool UQuestManagementSubsystem::IsQuestActive(FName QuestID) const
@@ -179,16 +189,25 @@ bool UQuestManagementSubsystem::ActivateQuestStage(FName QuestID, FName StageID)
 
 bool UQuestManagementSubsystem::CompleteQuestStage(FName QuestID)
 {
-    FQuestStage CurrentStage;
-    if (!GetQuestStage(QuestID, CurrentStage))
+    UDAQuestLogComponent* CurrentQuestLog = GetPlayerQuestLog();
+    FQuestLogEntry LogEntry;
+    if (!CurrentQuestLog || !CurrentQuestLog->GetQuestLogEntry(QuestID, LogEntry))
     {
         return false;
     }
 
-    // Iterate through the branches and find the first one whose conditions are met
-    for (const FQuestBranch& Branch : CurrentStage.Branches)
+    const FQuestCatalog& Catalog = GetQuestCatalog();
+    TConstArrayView<FQuestCatalog::FStageBranch> Branches;
+    if (!Catalog.FindStageBranches(Catalog.FindQuestIndex(QuestID), LogEntry.CurrentStageID, Branches))
     {
-        if (AreBranchConditionsMet(Branch))
+        return false;
+    }
+
+    // Take the first branch whose compiled conditions are met
+    const FDAConditionContext& Context = GetConditionContext(CurrentQuestLog);
+    for (const FQuestCatalog::FStageBranch& Branch : Branches)
+    {
+        if (Catalog.GetConditions().Evaluate(Branch.Clause, Context))
         {
             return ActivateQuestStage(QuestID, Branch.NextStageID);
         }
@@ -208,15 +227,11 @@ bool UQuestManagementSubsystem::CompleteQuestStage(FName QuestID)
 
 bool UQuestManagementSubsystem::GetQuestData(FName QuestID, FQuestData& OutData) const
 {
-    if (!QuestDataTable)
-    {
-        return false;
-    }
-
-    FQuestData* Row = QuestDataTable->FindRow<FQuestData>(QuestID, TEXT(""));
-    if (Row)
+    const FQuestCatalog& Catalog = GetQuestCatalog();
+    const int32 QuestIndex = Catalog.FindQuestIndex(QuestID);
+    if (QuestIndex != INDEX_NONE)
     {
-        OutData = *Row;
+        OutData = Catalog.GetQuestData(QuestIndex);
         return true;
     }
     return false;
@@ -254,205 +269,210 @@ bool UQuestManagementSubsystem::CheckQuestPrerequisites(const FQuestData& QuestD
     return true;
 }
 
-bool UQuestManagementSubsystem::AreBranchConditionsMet(const FQuestBranch& Branch) const
+const FDAConditionContext& UQuestManagementSubsystem::GetConditionContext(const UDAQuestLogComponent* QuestLog) const
 {
-    for (const FQuestCondition& Condition : Branch.Conditions)
+    // Rebind only when the player's character changes; evaluation then reads the cached components
+    const AActor* LogOwner = QuestLog ? QuestLog->GetOwner() : nullptr;
+    const AController* Controller = Cast<AController>(LogOwner);
+    const AActor* Subject = Controller ? Controller->GetPawn() : LogOwner;
+    if (!Subject)
     {
-        if (!CheckQuestCondition(Condition))
-        {
-            return false; // If any condition fails, the branch is not taken
-        }
+        ConditionContext.Reset();
     }
-    return true; // All conditions met
+    else if (!ConditionContext.IsBoundTo(Subject))
+    {
+        ConditionContext.Bind(Subject);
+    }
+    return ConditionContext;
 }
 
-bool UQuestManagementSubsystem::CheckQuestCondition(const FQuestCondition& Condition) const
+UDAQuestLogComponent* UQuestManagementSubsystem::GetPlayerQuestLog() const
 {
-    int32 PlayerValue = 0;
-    ADAPlayerCharacter* PlayerCharacter = Cast<ADAPlayerCharacter>(GetPlayerQuestLog()->GetOwner());
-    if (!PlayerCharacter)
+    if (GetGameInstance() && GetGameInstance()->GetFirstLocalPlayerController())
     {
-        return false;
+        return GetGameInstance()->GetFirstLocalPlayerController()->FindComponentByClass<UDAQuestLogComponent>();
     }
+    return nullptr;
+}
 
-    switch (Condition.ConditionType)
+const FQuestCatalog& UQuestManagementSubsystem::GetQuestCatalog() const
+{
+    const bool bStale = QuestDataTable ? !QuestCatalog.IsBuiltFrom(QuestDataTable) : QuestCatalog.Num() > 0;
+    if (bStale)
     {
-        case EQuestConditionType::QCT_HasItem:
-        {
-            UInventoryComponent* InventoryComponent = PlayerCharacter->FindComponentByClass<UInventoryComponent>();
-            if (InventoryComponent)
-            {
-               PlayerValue = InventoryComponent->GetItemQuantity(Condition.TargetID);
-            }
-            break;
-        }
-        case EQuestConditionType::QCT_SkillLevel:
-        {
-            UStatlineComponent* StatlineComponent = PlayerCharacter->FindComponentByClass<UStatlineComponent>();
-            if (StatlineComponent)
-            {
-                PlayerValue = StatlineComponent->GetCurrentStatValue(Condition.TargetID);
-            }
-            break;
-        }
-        case EQuestConditionType::QCT_FactionReputation:
-        {
-            USocialSimulationSubsystem* SocialSubsystem = GetGameInstance()->GetSubsystem<USocialSimulationSubsystem>();
-            if (SocialSubsystem)
-            {
-                // Assuming GetCharacterFactionReputation exists and returns an int
-                // PlayerValue = SocialSubsystem->GetCharacterFactionReputation(PlayerCharacter->GetCharacterID(), Condition.TargetID);
-            }
-            break;
-        }
-        case EQuestConditionType::QCT_QuestCompleted:
-        {
-            PlayerValue = (GetQuestState(Condition.TargetID) == EQuestState::QS_Completed);
-            break;
-        }
-        default:
-            return false;
+        BuildQuestCatalog();
+    }
+    return QuestCatalog;
+}
+
+void UQuestManagementSubsystem::BuildQuestCatalog() const
+{
+    if (UDataTable* PreviousTable = const_cast<UDataTable*>(QuestCatalog.GetSourceTable()))
+    {
+        PreviousTable->OnDataTableChanged().Remove(QuestDataTableChangedHandle);
     }
+    QuestDataTableChangedHandle.Reset();
 
-    switch (Condition.Operator)
+    QuestCatalog.Build(QuestDataTable);
+    if (QuestCatalog.IsBuiltFrom(QuestDataTable))
     {
-        case EComparisonOperator::CO_EqualTo:
-            return PlayerValue == Condition.Value;
-        case EComparisonOperator::CO_NotEqualTo:
-            return PlayerValue != Condition.Value;
-        case EComparisonOperator::CO_GreaterThan:
-            return PlayerValue > Condition.Value;
-        case EComparisonOperator::CO_LessThan:
-            return PlayerValue < Condition.Value;
-        case EComparisonOperator::CO_GreaterThanOrEqualTo:
-            return PlayerValue >= Condition.Value;
-        case EComparisonOperator::CO_LessThanOrEqualTo:
-            return PlayerValue <= Condition.Value;
-        default:
-            return false;
+        UQuestManagementSubsystem* MutableThis = const_cast<UQuestManagementSubsystem*>(this);
+        QuestDataTableChangedHandle = QuestDataTable->OnDataTableChanged().AddUObject(MutableThis, &UQuestManagementSubsystem::HandleQuestDataTableChanged);
     }
 
+    // Bit positions follow catalog indices, so the availability bits have to be reseeded
+    ReleaseQuestLogBinding();
 }
 
-UDAQuestLogComponent* UQuestManagementSubsystem::GetPlayerQuestLog() const
+void UQuestManagementSubsystem::HandleQuestDataTableChanged()
 {
-    if (GetGameInstance() && GetGameInstance()->GetFirstLocalPlayerController())
+    BuildQuestCatalog();
+}
+
+const TBitArray<>* UQuestManagementSubsystem::GetNotStartedQuests() const
+{
+    UDAQuestLogComponent* QuestLog = GetPlayerQuestLog();
+    if (!QuestLog)
     {
-        return GetGameInstance()->GetFirstLocalPlayerController()->FindComponentByClass<UDAQuestLogComponent>();
+        return nullptr;
     }
-    return nullptr;
+
+    GetQuestCatalog();
+    if (AvailabilityQuestLog.Get() != QuestLog)
+    {
+        RebuildQuestAvailability(QuestLog);
+    }
+    return &NotStartedQuests;
 }
-TArray<FName> UQuestManagementSubsystem::GetAvailableQuests() const
+
+void UQuestManagementSubsystem::RebuildQuestAvailability(UDAQuestLogComponent* QuestLog) const
 {
-    TArray<FName> AvailableQuests;
-    if (!QuestDataTable)
+    ReleaseQuestLogBinding();
+
+    const FQuestCatalog& Catalog = GetQuestCatalog();
+    NotStartedQuests.Init(false, Catalog.Num());
+    for (int32 QuestIndex = 0; QuestIndex < Catalog.Num(); ++QuestIndex)
     {
-        return AvailableQuests;
+        NotStartedQuests[QuestIndex] = QuestLog->GetQuestState(Catalog.GetQuestID(QuestIndex)) == EQuestState::QS_NotStarted;
+    }
+
+    UQuestManagementSubsystem* MutableThis = const_cast<UQuestManagementSubsystem*>(this);
+    QuestLog->OnQuestStateChanged.AddUniqueDynamic(MutableThis, &UQuestManagementSubsystem::HandleQuestLogStateChanged);
+    AvailabilityQuestLog = QuestLog;
+}
+
+void UQuestManagementSubsystem::ReleaseQuestLogBinding() const
+{
+    if (UDAQuestLogComponent* QuestLog = AvailabilityQuestLog.Get())
+    {
+        UQuestManagementSubsystem* MutableThis = const_cast<UQuestManagementSubsystem*>(this);
+        QuestLog->OnQuestStateChanged.RemoveDynamic(MutableThis, &UQuestManagementSubsystem::HandleQuestLogStateChanged);
     }
+    AvailabilityQuestLog.Reset();
+    NotStartedQuests.Reset();
+}
 
-    TArray<FName> QuestIDs = QuestDataTable->GetRowNames();
-    for (FName QuestID : QuestIDs)
+void UQuestManagementSubsystem::HandleQuestLogStateChanged(FName QuestID, EQuestState NewState)
+{
+    const int32 QuestIndex = QuestCatalog.FindQuestIndex(QuestID);
+    if (NotStartedQuests.IsValidIndex(QuestIndex))
     {
-        if (IsQuestAvailable(QuestID))
-        {
-            AvailableQuests.Add(QuestID);
-        }
+        NotStartedQuests[QuestIndex] = NewState == EQuestState::QS_NotStarted;
     }
-    return AvailableQuests;
 }
 
-TArray<FName> UQuestManagementSubsystem::GetAvailableQuestsInRegion(const FString& RegionID) const
+bool UQuestManagementSubsystem::IsCatalogQuestAvailable(int32 QuestIndex, const TBitArray<>& NotStarted) const
+{
+    if (!NotStarted[QuestIndex])
+    {
+        return false;
+    }
+
+    // Item requirements depend on the inventory, which the bits do not track
+    return !QuestCatalog.HasPrerequisites(QuestIndex) || CheckQuestPrerequisites(QuestCatalog.GetQuestData(QuestIndex));
+}
+
+TArray<FName> UQuestManagementSubsystem::CollectAvailableQuests(TConstArrayView<int32> Candidates) const
 {
     TArray<FName> AvailableQuests;
-    if (!QuestDataTable)
+    const TBitArray<>* NotStarted = GetNotStartedQuests();
+    if (!NotStarted)
     {
         return AvailableQuests;
     }
 
-    TArray<FName> QuestIDs = QuestDataTable->GetRowNames();
-    for (FName QuestID : QuestIDs)
+    for (const int32 QuestIndex : Candidates)
     {
-        FQuestData QuestData;
-        if (GetQuestData(QuestID, QuestData) && IsQuestAvailable(QuestID))
+        if (IsCatalogQuestAvailable(QuestIndex, *NotStarted))
         {
-            if (QuestData.RegionID == FName(*RegionID))
-            {
-                 AvailableQuests.Add(QuestID);
-            }
+            AvailableQuests.Add(QuestCatalog.GetQuestID(QuestIndex));
         }
     }
     return AvailableQuests;
 }
 
-TArray<FName> UQuestManagementSubsystem::GetAvailableQuestsFromGiver(const FString& QuestGiverID) const
+TArray<FName> UQuestManagementSubsystem::GetAvailableQuests() const
 {
     TArray<FName> AvailableQuests;
-    if (!QuestDataTable)
+    const TBitArray<>* NotStarted = GetNotStartedQuests();
+    if (!NotStarted)
     {
         return AvailableQuests;
     }
 
-    TArray<FName> QuestIDs = QuestDataTable->GetRowNames();
-    for (FName QuestID : QuestIDs)
+    for (TConstSetBitIterator<> It(*NotStarted); It; ++It)
     {
-        FQuestData QuestData;
-        if (GetQuestData(QuestID, QuestData) && IsQuestAvailable(QuestID) && QuestData.QuestGiver.ToString() == QuestGiverID)
+        if (IsCatalogQuestAvailable(It.GetIndex(), *NotStarted))
         {
-            AvailableQuests.Add(QuestID);
+            AvailableQuests.Add(QuestCatalog.GetQuestID(It.GetIndex()));
         }
     }
     return AvailableQuests;
 }
 
+TArray<FName> UQuestManagementSubsystem::GetAvailableQuestsInRegion(const FString& RegionID) const
+{
+    return CollectAvailableQuests(GetQuestCatalog().GetQuestsInRegion(FName(*RegionID)));
+}
+
+TArray<FName> UQuestManagementSubsystem::GetAvailableQuestsFromGiver(const FString& QuestGiverID) const
+{
+    return CollectAvailableQuests(GetQuestCatalog().GetQuestsFromGiver(FName(*QuestGiverID)));
+}
+
 void UQuestManagementSubsystem::UpdateQuestAvailability()
 {
-    // This could be called when player level, reputation, etc. changes.
-    // It could broadcast an event to UI to refresh available quests.
+    // The log broadcasts every change, including a loaded save, so this only forces a reseed
+    if (UDAQuestLogComponent* QuestLog = GetPlayerQuestLog())
+    {
+        RebuildQuestAvailability(QuestLog);
+    }
     UE_LOG(LogTemp, Log, TEXT("Quest availability updated."));
 }
 
 bool UQuestManagementSubsystem::DoesQuestExist(FName QuestID) const
 {
-    FQuestData QuestData;
-    return GetQuestData(QuestID, QuestData);
+    return GetQuestCatalog().FindQuestIndex(QuestID) != INDEX_NONE;
 }
 
 TArray<FName> UQuestManagementSubsystem::GetQuestsByType(EQuestType QuestType) const
 {
+    const FQuestCatalog& Catalog = GetQuestCatalog();
     TArray<FName> Quests;
-    if (!QuestDataTable)
+    for (const int32 QuestIndex : Catalog.GetQuestsByType(QuestType))
     {
-        return Quests;
-    }
-
-    TArray<FName> QuestIDs = QuestDataTable->GetRowNames();
-    for (FName QuestID : QuestIDs)
-    {
-        FQuestData QuestData;
-        if (GetQuestData(QuestID, QuestData) && QuestData.QuestType == QuestType)
-        {
-            Quests.Add(QuestID);
-        }
+        Quests.Add(Catalog.GetQuestID(QuestIndex));
     }
     return Quests;
 }
 
 TArray<FName> UQuestManagementSubsystem::GetQuestsByTag(const FString& Tag) const
 {
+    const FQuestCatalog& Catalog = GetQuestCatalog();
     TArray<FName> Quests;
-    if (!QuestDataTable)
-    {
-        return Quests;
-    }
-
-    TArray<FName> QuestIDs = QuestDataTable->GetRowNames();
-    for (FName QuestID : QuestIDs)
+    for (const int32 QuestIndex : Catalog.GetQuestsByTag(FName(*Tag)))
     {
-        FQuestData QuestData;
-        if (GetQuestData(QuestID, QuestData) && QuestData.Tags.Contains(FName(*Tag)))
-        {
-            Quests.Add(QuestID);
-        }
+        Quests.Add(Catalog.GetQuestID(QuestIndex));
     }
     return Quests;
 }
@@ -467,8 +487,7 @@ FName UQuestManagementSubsystem::GenerateDynamicQuest(EQuestType QuestType, cons
 
 void UQuestManagementSubsystem::OnWorldTimeUpdate(float CurrentWorldTime)
 {
-    // Check for timed quests that may have expired.
-    // UE_LOG(LogTemp, Log, TEXT("Checking for timed quest updates at time %f"), CurrentWorldTime);
+    // Timed quests expire on their own deadlines in UQuestRuntimeSubsystem; nothing to poll here.
 }
 
 void UQuestManagementSubsystem::OnPlayerRegionChanged(const FString& NewRegionID, const FString& PreviousRegionID)
@@ -0,0 +1,292 @@
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+#include "Core/DynamicQuestSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+namespace
+{
+    // Bus events that advance objectives
+    const EGlobalEventType ObjectiveEventTypes[] = { EGlobalEventType::NPCDied, EGlobalEventType::PlayerEnteredRegion };
+
+    FName ToEventTarget(const FString& Target)
+    {
+        return Target.IsEmpty() ? NAME_None : FName(*Target);
+    }
+}
+
+void UQuestObjectiveTrackerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    BindEventBus(Collection.InitializeDependency<UGlobalEventBus>());
+}
+
+void UQuestObjectiveTrackerSubsystem::Deinitialize()
+{
+    UnbindEventBus();
+    Watches.Empty();
+    WatchesByEvent.Empty();
+    Deadlines.Empty();
+    DeadlineHeap.Empty();
+    Super::Deinitialize();
+}
+
+UQuestObjectiveTrackerSubsystem* UQuestObjectiveTrackerSubsystem::Get(const UObject* WorldContext)
+{
+    const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull) : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UQuestObjectiveTrackerSubsystem>() : nullptr;
+}
+
+void UQuestObjectiveTrackerSubsystem::BindEventBus(UGlobalEventBus* InEventBus)
+{
+    UnbindEventBus();
+
+    EventBus = InEventBus;
+    if (!EventBus)
+    {
+        return;
+    }
+
+    GlobalEventDelegate.AddDynamic(this, &UQuestObjectiveTrackerSubsystem::HandleGlobalEvent);
+    for (const EGlobalEventType EventType : ObjectiveEventTypes)
+    {
+        EventBus->RegisterDelegate(EventType, GlobalEventDelegate);
+    }
+}
+
+void UQuestObjectiveTrackerSubsystem::UnbindEventBus()
+{
+    if (EventBus)
+    {
+        for (const EGlobalEventType EventType : ObjectiveEventTypes)
+        {
+            EventBus->UnregisterDelegate(EventType, GlobalEventDelegate);
+        }
+        EventBus = nullptr;
+    }
+    GlobalEventDelegate.Clear();
+}
+
+void UQuestObjectiveTrackerSubsystem::HandleGlobalEvent(const FGlobalEvent& Event)
+{
+    switch (Event.EventType)
+    {
+    case EGlobalEventType::NPCDied:
+    {
+        // Kill objectives name an enemy type; NPCs without one are reported by name
+        const FString* EnemyType = Event.EventData.Find(TEXT("EnemyType"));
+        ReportObjectiveEvent(EObjectiveType::Kill, ToEventTarget(EnemyType ? *EnemyType : Event.Target));
+        break;
+    }
+    case EGlobalEventType::PlayerEnteredRegion:
+    {
+        // Both location objectives are satisfied by reaching the location
+        const FName Region = ToEventTarget(Event.Target);
+        if (!Region.IsNone())
+        {
+            ReportObjectiveEvent(EObjectiveType::Investigate, Region);
+            ReportObjectiveEvent(EObjectiveType::Deliver, Region);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void UQuestObjectiveTrackerSubsystem::Tick(float DeltaTime)
+{
+    TrackerTime += DeltaTime;
+
+    while (DeadlineHeap.Num() > 0 && DeadlineHeap.HeapTop().DueTime <= TrackerTime)
+    {
+        FDeadlineEntry Entry;
+        DeadlineHeap.HeapPop(Entry, FDeadlineOrder(), EAllowShrinking::No);
+
+        FDeadline Deadline;
+        if (!Deadlines.RemoveAndCopyValue(Entry.Id, Deadline))
+        {
+            continue; // Cancelled
+        }
+
+        if (Deadline.Owner.IsValid() && Deadline.Callback)
+        {
+            Deadline.Callback();
+        }
+    }
+
+    if (Deadlines.Num() == 0)
+    {
+        DeadlineHeap.Reset();
+    }
+}
+
+FQuestTrackingHandle UQuestObjectiveTrackerSubsystem::WatchObjective(UObject* Owner, EObjectiveType EventType, FName Target, FQuestObjectiveCallback Callback)
+{
+    FQuestTrackingHandle Handle;
+    if (!Owner || !Callback)
+    {
+        return Handle;
+    }
+
+    Handle.Id = NextHandleId++;
+
+    FWatch& Watch = Watches.Add(Handle.Id);
+    Watch.Key = FEventKey{EventType, Target};
+    Watch.Owner = Owner;
+    Watch.Callback = MoveTemp(Callback);
+    WatchesByEvent.FindOrAdd(Watch.Key).Add(Handle.Id);
+
+    return Handle;
+}
+
+FQuestTrackingHandle UQuestObjectiveTrackerSubsystem::ScheduleDeadline(UObject* Owner, float Delay, FQuestDeadlineCallback Callback)
+{
+    FQuestTrackingHandle Handle;
+    if (!Owner || !Callback)
+    {
+        return Handle;
+    }
+
+    Handle.Id = NextHandleId++;
+
+    FDeadline& Deadline = Deadlines.Add(Handle.Id);
+    Deadline.Owner = Owner;
+    Deadline.Callback = MoveTemp(Callback);
+    Deadline.DueTime = TrackerTime + FMath::Max(0.0f, Delay);
+    DeadlineHeap.HeapPush(FDeadlineEntry{Deadline.DueTime, Handle.Id}, FDeadlineOrder());
+
+    return Handle;
+}
+
+void UQuestObjectiveTrackerSubsystem::Cancel(FQuestTrackingHandle& Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    if (Watches.Contains(Handle.Id))
+    {
+        RemoveWatch(Handle.Id);
+    }
+    else if (Deadlines.Remove(Handle.Id) > 0 && Deadlines.Num() == 0)
+    {
+        DeadlineHeap.Reset();
+    }
+
+    Handle.Invalidate();
+}
+
+void UQuestObjectiveTrackerSubsystem::Cancel(TArray<FQuestTrackingHandle>& Handles)
+{
+    for (FQuestTrackingHandle& Handle : Handles)
+    {
+        Cancel(Handle);
+    }
+    Handles.Reset();
+}
+
+float UQuestObjectiveTrackerSubsystem::GetDeadlineRemaining(const FQuestTrackingHandle& Handle) const
+{
+    const FDeadline* Deadline = Deadlines.Find(Handle.Id);
+    return Deadline ? static_cast<float>(FMath::Max(0.0, Deadline->DueTime - TrackerTime)) : -1.0f;
+}
+
+void UQuestObjectiveTrackerSubsystem::ReportObjectiveEvent(EObjectiveType EventType, FName Target, int32 Amount)
+{
+    if (Amount <= 0)
+    {
+        return;
+    }
+
+    DispatchEvent(FEventKey{EventType, Target}, Amount);
+    if (!Target.IsNone())
+    {
+        DispatchEvent(FEventKey{EventType, NAME_None}, Amount);
+    }
+}
+
+void UQuestObjectiveTrackerSubsystem::DispatchEvent(const FEventKey& Key, int32 Amount)
+{
+    const TArray<uint64>* WatchIds = WatchesByEvent.Find(Key);
+    if (!WatchIds)
+    {
+        return;
+    }
+
+    // Callbacks may add or cancel watches on this key
+    const TArray<uint64> Snapshot = *WatchIds;
+    for (const uint64 WatchId : Snapshot)
+    {
+        const FWatch* Watch = Watches.Find(WatchId);
+        if (!Watch)
+        {
+            continue;
+        }
+
+        if (!Watch->Owner.IsValid())
+        {
+            RemoveWatch(WatchId);
+            continue;
+        }
+
+        const FQuestObjectiveCallback Callback = Watch->Callback;
+        Callback(Amount);
+    }
+}
+
+void UQuestObjectiveTrackerSubsystem::RemoveWatch(uint64 WatchId)
+{
+    FWatch Watch;
+    if (!Watches.RemoveAndCopyValue(WatchId, Watch))
+    {
+        return;
+    }
+
+    if (TArray<uint64>* WatchIds = WatchesByEvent.Find(Watch.Key))
+    {
+        WatchIds->RemoveSingleSwap(WatchId);
+        if (WatchIds->Num() == 0)
+        {
+            WatchesByEvent.Remove(Watch.Key);
+        }
+    }
+}
+
+FName UQuestObjectiveTrackerSubsystem::GetObjectiveTarget(const FQuestObjective& Objective)
+{
+    const FString* Target = nullptr;
+    switch (Objective.ObjectiveType)
+    {
+    case EObjectiveType::Kill:
+        Target = &Objective.TargetEnemy;
+        break;
+    case EObjectiveType::TalkTo:
+        Target = &Objective.TargetNPC;
+        break;
+    case EObjectiveType::Deliver:
+    case EObjectiveType::Investigate:
+        Target = &Objective.TargetLocation;
+        break;
+    case EObjectiveType::Collect:
+    case EObjectiveType::Craft:
+    default:
+        Target = &Objective.TargetItem;
+        break;
+    }
+    return Target->IsEmpty() ? NAME_None : FName(**Target);
+}
+
+bool UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(FQuestObjective& Objective, int32 Amount)
+{
+    if (Objective.bIsCompleted)
+    {
+        return false;
+    }
+
+    Objective.CurrentCount = FMath::Min(Objective.CurrentCount + Amount, Objective.RequiredCount);
+    Objective.bIsCompleted = Objective.CurrentCount >= Objective.RequiredCount;
+    return Objective.bIsCompleted;
+}
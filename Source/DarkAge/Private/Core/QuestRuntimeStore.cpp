@@ -0,0 +1,107 @@
+#include "Core/QuestRuntimeStore.h"
+
+FQuestRuntimeHandle FQuestRuntimeStore::Add(EQuestRuntimeSource Source, const FDynamicQuest& Quest, float FinishedRetention)
+{
+    TMap<FString, FQuestRuntimeHandle>& SourceIndex = QuestIndex[static_cast<int32>(Source)];
+    if (SourceIndex.Contains(Quest.QuestID))
+    {
+        return FQuestRuntimeHandle();
+    }
+
+    const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+    FSlot& Slot = Slots[SlotIndex];
+
+    // Generation zero marks the invalid handle, so skip it on wrap-around
+    Slot.Generation = Slot.Generation == MAX_uint32 ? 1 : Slot.Generation + 1;
+    Slot.RecordIndex = Records.Num();
+
+    FQuestRuntimeRecord& Record = Records.AddDefaulted_GetRef();
+    Record.Quest = Quest;
+    Record.Source = Source;
+    Record.FinishedRetention = FinishedRetention;
+    RecordSlots.Add(SlotIndex);
+
+    const FQuestRuntimeHandle Handle{ static_cast<uint32>(SlotIndex), Slot.Generation };
+    SourceIndex.Add(Quest.QuestID, Handle);
+    return Handle;
+}
+
+bool FQuestRuntimeStore::Remove(FQuestRuntimeHandle Handle)
+{
+    const int32 RecordIndex = GetRecordIndex(Handle);
+    if (RecordIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FQuestRuntimeRecord& Record = Records[RecordIndex];
+    QuestIndex[static_cast<int32>(Record.Source)].Remove(Record.Quest.QuestID);
+
+    // Fill the hole with the last record and point its slot at the new position
+    const int32 LastIndex = Records.Num() - 1;
+    if (RecordIndex != LastIndex)
+    {
+        Slots[RecordSlots[LastIndex]].RecordIndex = RecordIndex;
+    }
+    Records.RemoveAtSwap(RecordIndex, 1, EAllowShrinking::No);
+    RecordSlots.RemoveAtSwap(RecordIndex, 1, EAllowShrinking::No);
+
+    Slots[Handle.Index].RecordIndex = INDEX_NONE;
+    FreeSlots.Add(Handle.Index);
+    return true;
+}
+
+FQuestRuntimeRecord* FQuestRuntimeStore::Find(FQuestRuntimeHandle Handle)
+{
+    const int32 RecordIndex = GetRecordIndex(Handle);
+    return RecordIndex != INDEX_NONE ? &Records[RecordIndex] : nullptr;
+}
+
+const FQuestRuntimeRecord* FQuestRuntimeStore::Find(FQuestRuntimeHandle Handle) const
+{
+    const int32 RecordIndex = GetRecordIndex(Handle);
+    return RecordIndex != INDEX_NONE ? &Records[RecordIndex] : nullptr;
+}
+
+FQuestRuntimeHandle FQuestRuntimeStore::FindHandle(EQuestRuntimeSource Source, const FString& QuestID) const
+{
+    const FQuestRuntimeHandle* Handle = QuestIndex[static_cast<int32>(Source)].Find(QuestID);
+    return Handle ? *Handle : FQuestRuntimeHandle();
+}
+
+FQuestRuntimeHandle FQuestRuntimeStore::GetHandle(int32 RecordIndex) const
+{
+    const int32 SlotIndex = RecordSlots[RecordIndex];
+    return FQuestRuntimeHandle{ static_cast<uint32>(SlotIndex), Slots[SlotIndex].Generation };
+}
+
+void FQuestRuntimeStore::Reset()
+{
+    // Slots keep their generations so handles from before the reset stay invalid
+    for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+    {
+        if (Slots[SlotIndex].RecordIndex != INDEX_NONE)
+        {
+            Slots[SlotIndex].RecordIndex = INDEX_NONE;
+            FreeSlots.Add(SlotIndex);
+        }
+    }
+
+    Records.Reset();
+    RecordSlots.Reset();
+    for (TMap<FString, FQuestRuntimeHandle>& SourceIndex : QuestIndex)
+    {
+        SourceIndex.Reset();
+    }
+}
+
+int32 FQuestRuntimeStore::GetRecordIndex(FQuestRuntimeHandle Handle) const
+{
+    if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+    {
+        return INDEX_NONE;
+    }
+
+    const FSlot& Slot = Slots[Handle.Index];
+    return Slot.Generation == Handle.Generation ? Slot.RecordIndex : INDEX_NONE;
+}
@@ -0,0 +1,319 @@
+#include "Core/QuestRuntimeSubsystem.h"
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+
+namespace
+{
+    bool IsFinishedStatus(EDynamicQuestStatus Status)
+    {
+        return Status == EDynamicQuestStatus::Completed || Status == EDynamicQuestStatus::Failed || Status == EDynamicQuestStatus::Expired;
+    }
+}
+
+void UQuestRuntimeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Tracker = Collection.InitializeDependency<UQuestObjectiveTrackerSubsystem>();
+
+    UE_LOG(LogTemp, Log, TEXT("QuestRuntimeSubsystem initialized"));
+}
+
+void UQuestRuntimeSubsystem::Deinitialize()
+{
+    if (Tracker)
+    {
+        for (FQuestRuntimeRecord& Record : Store.GetRecords())
+        {
+            Tracker->Cancel(Record.Watches);
+            Tracker->Cancel(Record.Deadline);
+        }
+    }
+
+    Store.Reset();
+    for (FOnQuestRuntimeEvent& Listener : Listeners)
+    {
+        Listener.Unbind();
+    }
+
+    Super::Deinitialize();
+}
+
+void UQuestRuntimeSubsystem::SetListener(EQuestRuntimeSource Source, FOnQuestRuntimeEvent Listener)
+{
+    Listeners[static_cast<int32>(Source)] = MoveTemp(Listener);
+}
+
+void UQuestRuntimeSubsystem::ClearListener(EQuestRuntimeSource Source)
+{
+    Listeners[static_cast<int32>(Source)].Unbind();
+}
+
+FQuestRuntimeHandle UQuestRuntimeSubsystem::AddQuest(EQuestRuntimeSource Source, const FDynamicQuest& Quest, float FinishedRetention)
+{
+    return Store.Add(Source, Quest, FinishedRetention);
+}
+
+bool UQuestRuntimeSubsystem::RemoveQuest(FQuestRuntimeHandle Handle)
+{
+    if (!Store.IsValid(Handle))
+    {
+        return false;
+    }
+
+    StopTracking(Handle);
+    Notify(Handle, EQuestRuntimeEvent::Removed);
+    Store.Remove(Handle);
+    return true;
+}
+
+FDynamicQuest* UQuestRuntimeSubsystem::FindQuest(FQuestRuntimeHandle Handle)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    return Record ? &Record->Quest : nullptr;
+}
+
+const FDynamicQuest* UQuestRuntimeSubsystem::FindQuest(FQuestRuntimeHandle Handle) const
+{
+    const FQuestRuntimeRecord* Record = Store.Find(Handle);
+    return Record ? &Record->Quest : nullptr;
+}
+
+void UQuestRuntimeSubsystem::StartTracking(FQuestRuntimeHandle Handle)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record || Record->bTracked || !Tracker)
+    {
+        return;
+    }
+
+    Record->bTracked = true;
+
+    const FDynamicQuest& Quest = Record->Quest;
+    for (int32 ObjectiveIndex = 0; ObjectiveIndex < Quest.Objectives.Num(); ++ObjectiveIndex)
+    {
+        const FQuestObjective& Objective = Quest.Objectives[ObjectiveIndex];
+        if (Objective.bIsCompleted)
+        {
+            continue;
+        }
+
+        Record->Watches.Add(Tracker->WatchObjective(this, Objective.ObjectiveType, UQuestObjectiveTrackerSubsystem::GetObjectiveTarget(Objective),
+            [this, Handle, ObjectiveIndex](int32 Amount)
+            {
+                HandleObjectiveEvent(Handle, ObjectiveIndex, Amount);
+            }));
+    }
+
+    // Only active quests run down their time limit
+    if (Quest.TimeLimit > 0.0f && Quest.Status == EDynamicQuestStatus::Active)
+    {
+        const float Remaining = Quest.RemainingTime > 0.0f ? Quest.RemainingTime : Quest.TimeLimit;
+        Record->Deadline = Tracker->ScheduleDeadline(this, Remaining, [this, Handle]()
+        {
+            HandleDeadline(Handle);
+        });
+    }
+}
+
+void UQuestRuntimeSubsystem::StopTracking(FQuestRuntimeHandle Handle)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record)
+    {
+        return;
+    }
+
+    if (Tracker)
+    {
+        Tracker->Cancel(Record->Watches);
+        Tracker->Cancel(Record->Deadline);
+    }
+    Record->Watches.Reset();
+    Record->Deadline.Invalidate();
+    Record->bTracked = false;
+}
+
+void UQuestRuntimeSubsystem::FinishQuest(FQuestRuntimeHandle Handle, EDynamicQuestStatus Status)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record)
+    {
+        return;
+    }
+
+    StopTracking(Handle);
+    Record->Quest.Status = Status;
+    Record->Quest.bIsCompleted = Status == EDynamicQuestStatus::Completed;
+    Record->Quest.bIsExpired = Status == EDynamicQuestStatus::Expired;
+    ScheduleRemoval(Handle);
+}
+
+bool UQuestRuntimeSubsystem::AreObjectivesCompleted(FQuestRuntimeHandle Handle) const
+{
+    const FDynamicQuest* Quest = FindQuest(Handle);
+    if (!Quest)
+    {
+        return false;
+    }
+
+    for (const FQuestObjective& Objective : Quest->Objectives)
+    {
+        if (!Objective.bIsCompleted)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+float UQuestRuntimeSubsystem::GetRemainingTime(FQuestRuntimeHandle Handle) const
+{
+    const FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record || !Tracker || Record->Quest.Status != EDynamicQuestStatus::Active || !Record->Deadline.IsValid())
+    {
+        return -1.0f;
+    }
+
+    return Tracker->GetDeadlineRemaining(Record->Deadline);
+}
+
+void UQuestRuntimeSubsystem::SaveQuests(TArray<FQuestRuntimeSaveRecord>& OutRecords) const
+{
+    const TConstArrayView<FQuestRuntimeRecord> Records = Store.GetRecords();
+    OutRecords.Reset(Records.Num());
+
+    for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+    {
+        const FQuestRuntimeRecord& Record = Records[RecordIndex];
+
+        FQuestRuntimeSaveRecord& Saved = OutRecords.AddDefaulted_GetRef();
+        Saved.Source = static_cast<uint8>(Record.Source);
+        Saved.Quest = Record.Quest;
+        Saved.FinishedRetention = Record.FinishedRetention;
+        Saved.bTracked = Record.bTracked;
+
+        const float Remaining = GetRemainingTime(Store.GetHandle(RecordIndex));
+        if (Remaining >= 0.0f)
+        {
+            Saved.Quest.RemainingTime = Remaining;
+        }
+    }
+}
+
+void UQuestRuntimeSubsystem::LoadQuests(const TArray<FQuestRuntimeSaveRecord>& Records)
+{
+    // Listeners must not create quests from Removed while the saved ones are still to be added
+    TGuardValue<bool> LoadingGuard(bLoadingQuests, true);
+
+    TArray<FQuestRuntimeHandle> CurrentQuests;
+    for (int32 RecordIndex = 0; RecordIndex < Store.Num(); ++RecordIndex)
+    {
+        CurrentQuests.Add(Store.GetHandle(RecordIndex));
+    }
+    for (const FQuestRuntimeHandle Handle : CurrentQuests)
+    {
+        RemoveQuest(Handle);
+    }
+
+    TArray<FQuestRuntimeHandle> Restored;
+    Restored.Reserve(Records.Num());
+    for (const FQuestRuntimeSaveRecord& Saved : Records)
+    {
+        if (Saved.Source >= static_cast<uint8>(EQuestRuntimeSource::Count))
+        {
+            continue;
+        }
+
+        const FQuestRuntimeHandle Handle = Store.Add(static_cast<EQuestRuntimeSource>(Saved.Source), Saved.Quest, Saved.FinishedRetention);
+        if (!Handle.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("QuestRuntimeSubsystem: Skipping duplicate saved quest %s"), *Saved.Quest.QuestID);
+            continue;
+        }
+
+        if (IsFinishedStatus(Saved.Quest.Status))
+        {
+            ScheduleRemoval(Handle);
+        }
+        else if (Saved.bTracked)
+        {
+            StartTracking(Handle);
+        }
+        Restored.Add(Handle);
+    }
+
+    for (const FQuestRuntimeHandle Handle : Restored)
+    {
+        Notify(Handle, EQuestRuntimeEvent::Restored);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("QuestRuntimeSubsystem: Restored %d quests"), Restored.Num());
+}
+
+void UQuestRuntimeSubsystem::HandleObjectiveEvent(FQuestRuntimeHandle Handle, int32 ObjectiveIndex, int32 Amount)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record || IsFinishedStatus(Record->Quest.Status) || !Record->Quest.Objectives.IsValidIndex(ObjectiveIndex))
+    {
+        return;
+    }
+
+    if (UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(Record->Quest.Objectives[ObjectiveIndex], Amount))
+    {
+        Notify(Handle, EQuestRuntimeEvent::ObjectiveCompleted, ObjectiveIndex);
+    }
+}
+
+void UQuestRuntimeSubsystem::HandleDeadline(FQuestRuntimeHandle Handle)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record)
+    {
+        return;
+    }
+
+    // The deadline has fired, so only the handle needs forgetting
+    Record->Deadline.Invalidate();
+    if (Record->Quest.Status != EDynamicQuestStatus::Active)
+    {
+        return;
+    }
+
+    StopTracking(Handle);
+    Record->Quest.Status = EDynamicQuestStatus::Expired;
+    Record->Quest.bIsExpired = true;
+    Record->Quest.RemainingTime = 0.0f;
+
+    Notify(Handle, EQuestRuntimeEvent::Expired);
+
+    // The listener may have removed the quest
+    ScheduleRemoval(Handle);
+}
+
+void UQuestRuntimeSubsystem::ScheduleRemoval(FQuestRuntimeHandle Handle)
+{
+    FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (!Record || !Tracker)
+    {
+        return;
+    }
+
+    // Finished quests stay readable for a while so the UI can show the outcome
+    Tracker->Cancel(Record->Deadline);
+    Record->Deadline = Tracker->ScheduleDeadline(this, Record->FinishedRetention, [this, Handle]()
+    {
+        if (FQuestRuntimeRecord* Finished = Store.Find(Handle))
+        {
+            Finished->Deadline.Invalidate();
+        }
+        RemoveQuest(Handle);
+    });
+}
+
+void UQuestRuntimeSubsystem::Notify(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex)
+{
+    const FQuestRuntimeRecord* Record = Store.Find(Handle);
+    if (Record)
+    {
+        Listeners[static_cast<int32>(Record->Source)].ExecuteIfBound(Handle, Event, ObjectiveIndex);
+    }
+}
@@ -3,6 +3,7 @@
 #include "Data/QuestData.h"
 #include "Core/FactionManagerSubsystem.h"
 #include "Core/EconomySubsystem.h"
+#include "Core/QuestManagementSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
 UQuestSystem::UQuestSystem()
@@ -15,6 +16,7 @@ void UQuestSystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 	EconomySubsystem = GetGameInstance()->GetSubsystem<UEconomySubsystem>();
 	FactionManagerSubsystem = GetGameInstance()->GetSubsystem<UFactionManagerSubsystem>();
+	QuestManagementSubsystem = Collection.InitializeDependency<UQuestManagementSubsystem>();
 }
 
 void UQuestSystem::Deinitialize()
@@ -31,7 +33,7 @@ void UQuestSystem::UpdateQuests(float DeltaTime)
         TimeSinceLastGeneration = 0.f;
     }
 
-    CheckQuestExpiration();
+    // Time limits are deadlines in UQuestRuntimeSubsystem, so there is nothing to scan here
 }
 
 FName UQuestSystem::GenerateQuest(EQuestType Type, FName Region, int32 Difficulty)
@@ -42,16 +44,14 @@ FName UQuestSystem::GenerateQuest(EQuestType Type, FName Region, int32 Difficult
 bool UQuestSystem::AcceptQuest(FName QuestID)
 {
     UE_LOG(LogTemp, Warning, TEXT("[QuestSystem] Attempting to accept quest: %s"), *QuestID.ToString());
-    // Accept a quest: set state to InProgress if available
-    if (FQuestData* Quest = Quests.Find(QuestID))
+    // Accept a quest: start it in the player's quest log if it hasn't been started
+    if (QuestManagementSubsystem
+        && QuestManagementSubsystem->GetQuestState(QuestID) == EQuestState::QS_NotStarted
+        && QuestManagementSubsystem->StartQuest(QuestID))
     {
-        if (Quest->State == EQuestState::QS_NotStarted)
-        {
-            Quest->State = EQuestState::QS_InProgress;
-            OnQuestStatusChanged.Broadcast(QuestID, Quest->State);
-            UE_LOG(LogTemp, Warning, TEXT("[QuestSystem] Quest accepted: %s"), *QuestID.ToString());
-            return true;
-        }
+        OnQuestStatusChanged.Broadcast(QuestID, QuestManagementSubsystem->GetQuestState(QuestID));
+        UE_LOG(LogTemp, Warning, TEXT("[QuestSystem] Quest accepted: %s"), *QuestID.ToString());
+        return true;
     }
     return false;
 }
@@ -94,11 +94,12 @@ TArray<FQuestData> UQuestSystem::GetActiveQuests() const
 
 FQuestData UQuestSystem::GetQuestData(FName QuestID) const
 {
-    if (const FQuestData* Quest = Quests.Find(QuestID))
+    FQuestData Quest;
+    if (QuestManagementSubsystem)
     {
-        return *Quest;
+        QuestManagementSubsystem->GetQuestData(QuestID, Quest);
     }
-    return FQuestData();
+    return Quest;
 }
 
 bool UQuestSystem::AreAllObjectivesCompleted(FName QuestID) const
@@ -132,23 +133,6 @@ FQuestData UQuestSystem::GenerateEnvironmentalQuest(FName Region, int32 Difficul
     return FQuestData();
 }
 
-void UQuestSystem::CheckQuestExpiration()
-{
-    // This is a simplified example. A real implementation would need to store the expiration time.
-    for (auto& Elem : Quests)
-    {
-        if (Elem.Value.State == EQuestState::QS_InProgress)
-        {
-            // Assuming a simple expiration condition for demonstration
-            if (false) // Replace with actual expiration logic
-            {
-                Elem.Value.State = EQuestState::QS_Failed;
-                OnQuestStatusChanged.Broadcast(Elem.Key, Elem.Value.State);
-            }
-        }
-    }
-}
-
 void UQuestSystem::GenerateDynamicQuests()
 {
     // In a real game, this would be a complex system based on world state, player actions, etc.
@@ -170,9 +154,4 @@ FName UQuestSystem::GenerateAndAcceptTestQuest()
     AcceptQuest(QuestID);
     UE_LOG(LogTemp, Warning, TEXT("[QuestSystem] GenerateAndAcceptTestQuest called. QuestID: %s"), *QuestID.ToString());
     return QuestID;
-   }
-   
-   FQuestData* UQuestSystem::GetMutableQuestData(FName QuestID)
-   {
-       return Quests.Find(QuestID);
-   }
\ No newline at end of file
+}
\ No newline at end of file
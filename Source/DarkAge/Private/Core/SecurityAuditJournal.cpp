@@ -0,0 +1,496 @@
+#include "Core/SecurityAuditJournal.h"
+#include "Core/SecurityAuditSubsystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+    constexpr uint32 SegmentMagic = 0x4A415344; // "DSAJ"
+    constexpr uint32 SegmentVersion = 1;
+    constexpr int64 SegmentHeaderSize = sizeof(uint32) * 2 + sizeof(int32);
+
+    // Group commit cadence and early-wake threshold
+    constexpr uint32 CommitIntervalMilliseconds = 100;
+    constexpr int32 CommitBatchSize = 256;
+
+    // Rotation limits
+    constexpr int64 MaxSegmentBytes = 16 * 1024 * 1024;
+    constexpr double MaxSegmentAgeHours = 6.0;
+
+    // One time checkpoint per this many records
+    constexpr int32 CheckpointInterval = 64;
+
+    FString GetSegmentPath(const FString& Directory, int32 Sequence)
+    {
+        return Directory / FString::Printf(TEXT("Audit_%06d.jnl"), Sequence);
+    }
+
+    FString GetIndexPath(const FString& SegmentPath)
+    {
+        return FPaths::ChangeExtension(SegmentPath, TEXT("idx"));
+    }
+
+    void SaveSegmentIndex(FSecurityAuditSegmentIndex& Index)
+    {
+        TArray<uint8> IndexBytes;
+        FMemoryWriter Writer(IndexBytes);
+        Writer << Index;
+        FFileHelper::SaveArrayToFile(IndexBytes, *GetIndexPath(Index.Path));
+    }
+}
+
+void FSecurityAuditSegmentIndex::AddRecord(const FSecurityAuditEvent& Event, int64 Offset)
+{
+    const int64 Ticks = Event.Timestamp.GetTicks();
+    if (NumRecords % CheckpointInterval == 0)
+    {
+        Checkpoints.Add({Ticks, Offset});
+    }
+
+    MinTicks = FMath::Min(MinTicks, Ticks);
+    MaxTicks = FMath::Max(MaxTicks, Ticks);
+    EventTypeMask |= FSecurityAuditJournal::GetEventTypeBit((uint8)Event.EventType);
+    UserOffsets.FindOrAdd(Event.UserId).Add(Offset);
+    NumRecords++;
+}
+
+FSecurityAuditJournal::FSecurityAuditJournal()
+{
+}
+
+FSecurityAuditJournal::~FSecurityAuditJournal()
+{
+    Close();
+}
+
+bool FSecurityAuditJournal::Open(const FString& InDirectory)
+{
+    Directory = InDirectory;
+    IFileManager::Get().MakeDirectory(*Directory, true);
+
+    // Load or rebuild the index of every existing segment; events stay on disk
+    TArray<FString> SegmentFiles;
+    IFileManager::Get().FindFiles(SegmentFiles, *(Directory / TEXT("Audit_*.jnl")), true, false);
+    SegmentFiles.Sort();
+
+    int32 LoadedSegments = 0;
+    {
+        FScopeLock IndexLock(&IndexCriticalSection);
+        Segments.Reset();
+        for (const FString& SegmentFile : SegmentFiles)
+        {
+            const FString SegmentPath = Directory / SegmentFile;
+            FSecurityAuditSegmentIndex Index;
+            if (LoadSegmentIndex(SegmentPath, Index))
+            {
+                Segments.Add(MoveTemp(Index));
+                LoadedSegments++;
+            }
+            else if (RebuildSegmentIndex(SegmentPath, Index))
+            {
+                // Missing or stale sidecar (e.g. after a crash); rewrite it for next time
+                SaveSegmentIndex(Index);
+                Segments.Add(MoveTemp(Index));
+                LoadedSegments++;
+            }
+        }
+        Segments.Sort([](const FSecurityAuditSegmentIndex& A, const FSecurityAuditSegmentIndex& B) { return A.Sequence < B.Sequence; });
+    }
+
+    OpenNewSegment();
+
+    bStopRequested = false;
+    WriterWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    WriterThread = FRunnableThread::Create(this, TEXT("SecurityAuditJournal"), 0, TPri_BelowNormal);
+
+    UE_LOG(LogTemp, Log, TEXT("SecurityAuditJournal: Opened %s with %d existing segments"), *Directory, LoadedSegments);
+    return SegmentArchive.IsValid();
+}
+
+void FSecurityAuditJournal::Close()
+{
+    if (WriterThread)
+    {
+        WriterThread->Kill(true);
+        delete WriterThread;
+        WriterThread = nullptr;
+    }
+    if (WriterWakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WriterWakeEvent);
+        WriterWakeEvent = nullptr;
+    }
+
+    CommitPending();
+
+    FScopeLock WriteLock(&WriteCriticalSection);
+    SealActiveSegment();
+}
+
+void FSecurityAuditJournal::Append(const FSecurityAuditEvent& Event)
+{
+    int32 NumPending = 0;
+    {
+        FScopeLock PendingLock(&PendingCriticalSection);
+        NumPending = PendingEvents.Add(Event) + 1;
+    }
+
+    // Critical events and large bursts are committed without waiting for the next interval
+    if (WriterWakeEvent && (NumPending >= CommitBatchSize || Event.Severity >= ESecuritySeverity::Critical))
+    {
+        WriterWakeEvent->Trigger();
+    }
+}
+
+void FSecurityAuditJournal::Flush()
+{
+    CommitPending();
+}
+
+uint32 FSecurityAuditJournal::Run()
+{
+    while (!bStopRequested)
+    {
+        WriterWakeEvent->Wait(CommitIntervalMilliseconds);
+        CommitPending();
+    }
+    return 0;
+}
+
+void FSecurityAuditJournal::Stop()
+{
+    bStopRequested = true;
+    if (WriterWakeEvent)
+    {
+        WriterWakeEvent->Trigger();
+    }
+}
+
+void FSecurityAuditJournal::CommitPending()
+{
+    FScopeLock WriteLock(&WriteCriticalSection);
+
+    TArray<FSecurityAuditEvent> Batch;
+    {
+        FScopeLock PendingLock(&PendingCriticalSection);
+        Swap(Batch, PendingEvents);
+    }
+
+    if (Batch.Num() > 0 && SegmentArchive.IsValid())
+    {
+        // Serialize the whole group into one buffer, then write and flush once
+        int64 BaseOffset = 0;
+        {
+            FScopeLock IndexLock(&IndexCriticalSection);
+            BaseOffset = Segments.Last().Size;
+        }
+
+        TArray<uint8> Bytes;
+        TArray<int64> Offsets;
+        Offsets.Reserve(Batch.Num());
+        for (const FSecurityAuditEvent& Event : Batch)
+        {
+            Offsets.Add(BaseOffset + Bytes.Num());
+            SerializeRecord(Bytes, Event);
+        }
+
+        SegmentArchive->Serialize(Bytes.GetData(), Bytes.Num());
+        SegmentArchive->Flush();
+
+        // Index only after the records are on disk so queries never see an offset that cannot be read
+        FScopeLock IndexLock(&IndexCriticalSection);
+        FSecurityAuditSegmentIndex& Active = Segments.Last();
+        for (int32 Index = 0; Index < Batch.Num(); Index++)
+        {
+            Active.AddRecord(Batch[Index], Offsets[Index]);
+        }
+        Active.Size = BaseOffset + Bytes.Num();
+    }
+
+    if (ShouldRotate())
+    {
+        SealActiveSegment();
+        OpenNewSegment();
+    }
+}
+
+void FSecurityAuditJournal::OpenNewSegment()
+{
+    FScopeLock IndexLock(&IndexCriticalSection);
+
+    FSecurityAuditSegmentIndex& Index = Segments.AddDefaulted_GetRef();
+    Index.Sequence = Segments.Num() > 1 ? Segments[Segments.Num() - 2].Sequence + 1 : 1;
+    Index.Path = GetSegmentPath(Directory, Index.Sequence);
+    Index.CreatedTicks = FDateTime::Now().GetTicks();
+
+    SegmentArchive = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Index.Path, FILEWRITE_AllowRead));
+    if (!SegmentArchive.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("SecurityAuditJournal: Could not create segment %s"), *Index.Path);
+        return;
+    }
+
+    uint32 Magic = SegmentMagic;
+    uint32 Version = SegmentVersion;
+    int32 Sequence = Index.Sequence;
+    *SegmentArchive << Magic << Version << Sequence;
+    SegmentArchive->Flush();
+    Index.Size = SegmentHeaderSize;
+}
+
+void FSecurityAuditJournal::SealActiveSegment()
+{
+    if (!SegmentArchive.IsValid())
+    {
+        return;
+    }
+
+    SegmentArchive->Close();
+    SegmentArchive.Reset();
+
+    // Persist the index so the next Open does not have to scan this segment
+    FScopeLock IndexLock(&IndexCriticalSection);
+    FSecurityAuditSegmentIndex& Active = Segments.Last();
+    if (Active.NumRecords == 0)
+    {
+        IFileManager::Get().Delete(*Active.Path);
+        Segments.Pop();
+        return;
+    }
+
+    SaveSegmentIndex(Active);
+}
+
+bool FSecurityAuditJournal::ShouldRotate() const
+{
+    FScopeLock IndexLock(&IndexCriticalSection);
+    if (Segments.Num() == 0 || !SegmentArchive.IsValid())
+    {
+        return false;
+    }
+
+    const FSecurityAuditSegmentIndex& Active = Segments.Last();
+    const double AgeHours = FTimespan(FDateTime::Now().GetTicks() - Active.CreatedTicks).GetTotalHours();
+    return Active.Size >= MaxSegmentBytes || (Active.NumRecords > 0 && AgeHours >= MaxSegmentAgeHours);
+}
+
+bool FSecurityAuditJournal::LoadSegmentIndex(const FString& SegmentPath, FSecurityAuditSegmentIndex& OutIndex) const
+{
+    TArray<uint8> IndexBytes;
+    if (!FFileHelper::LoadFileToArray(IndexBytes, *GetIndexPath(SegmentPath), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(IndexBytes);
+    Reader << OutIndex;
+    OutIndex.Path = SegmentPath;
+
+    // A sidecar that does not describe the whole file is stale
+    return !Reader.IsError() && OutIndex.Size == IFileManager::Get().FileSize(*SegmentPath);
+}
+
+bool FSecurityAuditJournal::RebuildSegmentIndex(const FString& SegmentPath, FSecurityAuditSegmentIndex& OutIndex) const
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SegmentPath, FILEREAD_AllowWrite));
+    if (!Reader.IsValid())
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int32 Sequence = 0;
+    *Reader << Magic << Version << Sequence;
+    if (Magic != SegmentMagic || Version != SegmentVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SecurityAuditJournal: Skipping unrecognized segment %s"), *SegmentPath);
+        return false;
+    }
+
+    OutIndex = FSecurityAuditSegmentIndex();
+    OutIndex.Sequence = Sequence;
+    OutIndex.Path = SegmentPath;
+
+    // Stop at the first torn or corrupt record; everything before it is kept
+    int64 Offset = Reader->Tell();
+    FSecurityAuditEvent Event;
+    while (ReadRecord(*Reader, Event))
+    {
+        OutIndex.AddRecord(Event, Offset);
+        Offset = Reader->Tell();
+    }
+    OutIndex.Size = Offset;
+    OutIndex.CreatedTicks = OutIndex.NumRecords > 0 ? OutIndex.MinTicks : 0;
+    return true;
+}
+
+void FSecurityAuditJournal::QueryTimeRange(const FDateTime& StartTime, const FDateTime& EndTime, TArray<FSecurityAuditEvent>& OutEvents, uint32 EventTypeMask)
+{
+    Flush();
+
+    const int64 StartTicks = StartTime.GetTicks();
+    const int64 EndTicks = EndTime.GetTicks();
+
+    // Pick segments and starting offsets under the lock, read files outside it
+    TArray<TPair<FString, int64>> Reads;
+    {
+        FScopeLock IndexLock(&IndexCriticalSection);
+        for (const FSecurityAuditSegmentIndex& Segment : Segments)
+        {
+            if (!Segment.Overlaps(StartTicks, EndTicks) || (Segment.EventTypeMask & EventTypeMask) == 0)
+            {
+                continue;
+            }
+
+            // Start from the last checkpoint at or before StartTime
+            const int32 CheckpointIndex = Algo::UpperBoundBy(Segment.Checkpoints, StartTicks, &FSecurityAuditCheckpoint::Ticks) - 1;
+            const int64 Offset = Segment.Checkpoints.IsValidIndex(CheckpointIndex) ? Segment.Checkpoints[CheckpointIndex].Offset : Segment.Checkpoints[0].Offset;
+            Reads.Emplace(Segment.Path, Offset);
+        }
+    }
+
+    for (const TPair<FString, int64>& Read : Reads)
+    {
+        TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Read.Key, FILEREAD_AllowWrite));
+        if (Reader.IsValid())
+        {
+            ReadRecords(*Reader, Read.Value, StartTicks, EndTicks, EventTypeMask, OutEvents);
+        }
+    }
+}
+
+void FSecurityAuditJournal::QueryUser(const FString& UserId, const FDateTime& StartTime, const FDateTime& EndTime, TArray<FSecurityAuditEvent>& OutEvents)
+{
+    Flush();
+
+    const int64 StartTicks = StartTime.GetTicks();
+    const int64 EndTicks = EndTime.GetTicks();
+
+    TArray<TPair<FString, TArray<int64>>> Reads;
+    {
+        FScopeLock IndexLock(&IndexCriticalSection);
+        for (const FSecurityAuditSegmentIndex& Segment : Segments)
+        {
+            const TArray<int64>* Offsets = Segment.UserOffsets.Find(UserId);
+            if (Offsets && Segment.Overlaps(StartTicks, EndTicks))
+            {
+                Reads.Emplace(Segment.Path, *Offsets);
+            }
+        }
+    }
+
+    for (const TPair<FString, TArray<int64>>& Read : Reads)
+    {
+        TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Read.Key, FILEREAD_AllowWrite));
+        if (!Reader.IsValid())
+        {
+            continue;
+        }
+
+        for (int64 Offset : Read.Value)
+        {
+            ReadRecords(*Reader, Offset, StartTicks, EndTicks, MAX_uint32, OutEvents, 1);
+        }
+    }
+}
+
+int32 FSecurityAuditJournal::DeleteSegmentsBefore(const FDateTime& Cutoff)
+{
+    const int64 CutoffTicks = Cutoff.GetTicks();
+    int32 NumDeleted = 0;
+
+    FScopeLock IndexLock(&IndexCriticalSection);
+
+    // The last segment is the active one and is never deleted here
+    for (int32 Index = Segments.Num() - 2; Index >= 0; Index--)
+    {
+        const FSecurityAuditSegmentIndex& Segment = Segments[Index];
+        if (Segment.MaxTicks < CutoffTicks && IFileManager::Get().Delete(*Segment.Path, false, false, true))
+        {
+            IFileManager::Get().Delete(*GetIndexPath(Segment.Path), false, false, true);
+            Segments.RemoveAt(Index);
+            NumDeleted++;
+        }
+    }
+    return NumDeleted;
+}
+
+void FSecurityAuditJournal::ReadRecords(FArchive& Reader, int64 Offset, int64 StartTicks, int64 EndTicks, uint32 EventTypeMask, TArray<FSecurityAuditEvent>& OutEvents, int32 MaxRecords)
+{
+    Reader.Seek(Offset);
+    FSecurityAuditEvent Event;
+    for (int32 NumRead = 0; NumRead < MaxRecords && ReadRecord(Reader, Event); NumRead++)
+    {
+        const int64 Ticks = Event.Timestamp.GetTicks();
+        if (Ticks > EndTicks)
+        {
+            break;
+        }
+        if (Ticks >= StartTicks && (GetEventTypeBit((uint8)Event.EventType) & EventTypeMask) != 0)
+        {
+            OutEvents.Add(Event);
+        }
+    }
+}
+
+void FSecurityAuditJournal::SerializeRecord(TArray<uint8>& OutBytes, const FSecurityAuditEvent& Event)
+{
+    // Record: uint32 PayloadSize, uint32 PayloadCrc, payload
+    TArray<uint8> Payload;
+    FMemoryWriter Writer(Payload);
+    int64 Ticks = Event.Timestamp.GetTicks();
+    uint8 EventType = (uint8)Event.EventType;
+    uint8 Severity = (uint8)Event.Severity;
+    FString UserId = Event.UserId;
+    FString Description = Event.Description;
+    FString IPAddress = Event.IPAddress;
+    Writer << Ticks << EventType << Severity << UserId << Description << IPAddress;
+
+    uint32 PayloadSize = (uint32)Payload.Num();
+    uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+    FMemoryWriter RecordWriter(OutBytes, false, true);
+    RecordWriter << PayloadSize << PayloadCrc;
+    OutBytes.Append(Payload);
+}
+
+bool FSecurityAuditJournal::ReadRecord(FArchive& Reader, FSecurityAuditEvent& OutEvent)
+{
+    if (Reader.Tell() + (int64)(sizeof(uint32) * 2) > Reader.TotalSize())
+    {
+        return false;
+    }
+
+    uint32 PayloadSize = 0;
+    uint32 PayloadCrc = 0;
+    Reader << PayloadSize << PayloadCrc;
+    if (Reader.IsError() || Reader.Tell() + (int64)PayloadSize > Reader.TotalSize())
+    {
+        return false;
+    }
+
+    TArray<uint8> Payload;
+    Payload.SetNumUninitialized(PayloadSize);
+    Reader.Serialize(Payload.GetData(), PayloadSize);
+    if (Reader.IsError() || FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != PayloadCrc)
+    {
+        return false;
+    }
+
+    FMemoryReader PayloadReader(Payload);
+    int64 Ticks = 0;
+    uint8 EventType = 0;
+    uint8 Severity = 0;
+    PayloadReader << Ticks << EventType << Severity << OutEvent.UserId << OutEvent.Description << OutEvent.IPAddress;
+    OutEvent.Timestamp = FDateTime(Ticks);
+    OutEvent.EventType = (ESecurityEventType)EventType;
+    OutEvent.Severity = (ESecuritySeverity)Severity;
+    return !PayloadReader.IsError();
+}
@@ -4,6 +4,7 @@
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "TimerManager.h"
+#include "Misc/Paths.h"
 
 USecurityAuditSubsystem::USecurityAuditSubsystem()
 {
@@ -13,7 +14,7 @@ void USecurityAuditSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     LoadEventsFromFile();
-    UE_LOG(LogTemp, Log, TEXT("SecurityAuditSubsystem: Initialized - Enterprise Security Audit Active. Loaded %d events from log."), SecurityEvents.Num());
+    UE_LOG(LogTemp, Log, TEXT("SecurityAuditSubsystem: Initialized - Enterprise Security Audit Active. Loaded %d recent events from journal."), RecentEvents.Num());
 
     if (UWorld* World = GetWorld())
     {
@@ -29,6 +30,7 @@ void USecurityAuditSubsystem::Deinitialize()
         World->GetTimerManager().ClearTimer(ProcessEventsTimer);
         World->GetTimerManager().ClearTimer(CleanupTimer);
     }
+    Journal.Close();
     Super::Deinitialize();
 }
 
@@ -42,12 +44,11 @@ void USecurityAuditSubsystem::LogSecurityEvent(ESecurityEventType EventType, ESe
     Event.IPAddress = IPAddress;
     Event.Timestamp = FDateTime::Now();
 
-    SecurityEvents.Add(Event);
-
-    if (SecurityEvents.Num() > MAX_STORED_EVENTS)
+    if (RecentEvents.Num() >= MAX_STORED_EVENTS)
     {
-        SecurityEvents.RemoveAt(0);
+        RecentEvents.PopFront();
     }
+    RecentEvents.Add(Event);
 
     WriteEventToFile(Event);
 }
@@ -59,55 +60,57 @@ FSecurityMetrics USecurityAuditSubsystem::GetSecurityMetrics() const
 
 TArray<FSecurityAuditEvent> USecurityAuditSubsystem::GetRecentEvents(int32 Hours, ESecuritySeverity MinSeverity)
 {
-    TArray<FSecurityAuditEvent> RecentEvents;
-    FDateTime CutoffTime = FDateTime::Now() - FTimespan::FromHours(Hours);
+    FDateTime Now = FDateTime::Now();
+    FDateTime CutoffTime = Now - FTimespan::FromHours(Hours);
 
-    for (const FSecurityAuditEvent& Event : SecurityEvents)
+    TArray<FSecurityAuditEvent> FoundEvents;
+    CollectEvents(CutoffTime, Now, MAX_uint32, FoundEvents);
+    FoundEvents.RemoveAll([MinSeverity](const FSecurityAuditEvent& Event)
     {
-        if (Event.Timestamp >= CutoffTime && Event.Severity >= MinSeverity)
-        {
-            RecentEvents.Add(Event);
-        }
-    }
+        return Event.Severity < MinSeverity;
+    });
 
-    return RecentEvents;
+    return FoundEvents;
 }
 
 TArray<FSecurityAuditEvent> USecurityAuditSubsystem::SearchSecurityEvents(const FString& SearchTerm, ESecurityEventType EventType)
 {
-    TArray<FSecurityAuditEvent> FoundEvents;
+    return SearchSecurityEventsInTimeRange(SearchTerm, EventType, FDateTime::MinValue(), FDateTime::MaxValue());
+}
+
+TArray<FSecurityAuditEvent> USecurityAuditSubsystem::SearchSecurityEventsInTimeRange(const FString& SearchTerm, ESecurityEventType EventType, const FDateTime& StartTime, const FDateTime& EndTime)
+{
+    // The type filter lets the journal skip whole segments
+    const uint32 EventTypeMask = EventType == ESecurityEventType::None ? MAX_uint32 : FSecurityAuditJournal::GetEventTypeBit((uint8)EventType);
 
-    for (const FSecurityAuditEvent& Event : SecurityEvents)
+    TArray<FSecurityAuditEvent> FoundEvents;
+    CollectEvents(StartTime, EndTime, EventTypeMask, FoundEvents);
+    FoundEvents.RemoveAll([&SearchTerm](const FSecurityAuditEvent& Event)
     {
-        if (EventType == ESecurityEventType::None || Event.EventType == EventType)
-        {
-            if (Event.Description.Contains(SearchTerm) || Event.UserId.Contains(SearchTerm))
-            {
-                FoundEvents.Add(Event);
-            }
-        }
-    }
+        return !Event.Description.Contains(SearchTerm) && !Event.UserId.Contains(SearchTerm);
+    });
 
     return FoundEvents;
 }
 
-TArray<FSecurityAuditEvent> USecurityAuditSubsystem::SearchSecurityEventsInTimeRange(const FString& SearchTerm, ESecurityEventType EventType, const FDateTime& StartTime, const FDateTime& EndTime)
+TArray<FSecurityAuditEvent> USecurityAuditSubsystem::GetUserEvents(const FString& UserId, const FDateTime& StartTime, const FDateTime& EndTime)
 {
     TArray<FSecurityAuditEvent> FoundEvents;
 
-    for (const FSecurityAuditEvent& Event : SecurityEvents)
+    if (StartTime >= GetRecentEventsHorizon())
     {
-        if (Event.Timestamp >= StartTime && Event.Timestamp <= EndTime)
+        for (int32 Index = FindFirstRecentEvent(StartTime); Index < RecentEvents.Num() && RecentEvents[Index].Timestamp <= EndTime; Index++)
         {
-            if (EventType == ESecurityEventType::None || Event.EventType == EventType)
+            if (RecentEvents[Index].UserId == UserId)
             {
-                if (Event.Description.Contains(SearchTerm) || Event.UserId.Contains(SearchTerm))
-                {
-                    FoundEvents.Add(Event);
-                }
+                FoundEvents.Add(RecentEvents[Index]);
             }
         }
     }
+    else
+    {
+        Journal.QueryUser(UserId, StartTime, EndTime, FoundEvents);
+    }
 
     return FoundEvents;
 }
@@ -136,13 +139,14 @@ FString USecurityAuditSubsystem::GenerateSecurityReport(int32 Hours)
 
 bool USecurityAuditSubsystem::ExportAuditLog(const FDateTime& StartTime, const FDateTime& EndTime, const FString& FilePath)
 {
+    TArray<FSecurityAuditEvent> Events;
+    CollectEvents(StartTime, EndTime, MAX_uint32, Events);
+
     TArray<FString> Lines;
-    for (const FSecurityAuditEvent& Event : SecurityEvents)
+    Lines.Reserve(Events.Num());
+    for (const FSecurityAuditEvent& Event : Events)
     {
-        if (Event.Timestamp >= StartTime && Event.Timestamp <= EndTime)
-        {
-            Lines.Add(FormatEventForLog(Event));
-        }
+        Lines.Add(FormatEventForLog(Event));
     }
 
     return FFileHelper::SaveStringArrayToFile(Lines, *FilePath);
@@ -183,12 +187,13 @@ void USecurityAuditSubsystem::CheckAlertThresholds()
     for (auto const& [EventType, Threshold] : AlertThresholds)
     {
         int32 TimeWindow = AlertTimeWindows.Contains(EventType) ? AlertTimeWindows[EventType] : 60;
-        TArray<FSecurityAuditEvent> RecentEvents = GetRecentEvents(TimeWindow / 60, ESecuritySeverity::Info);
+        FDateTime WindowStart = FDateTime::Now() - FTimespan::FromMinutes(TimeWindow);
 
+        // Alert windows are always inside the in-memory cache, so this never touches the journal
         int32 EventCount = 0;
-        for (const FSecurityAuditEvent& Event : RecentEvents)
+        for (int32 Index = FindFirstRecentEvent(WindowStart); Index < RecentEvents.Num(); Index++)
         {
-            if (Event.EventType == EventType)
+            if (RecentEvents[Index].EventType == EventType)
             {
                 EventCount++;
             }
@@ -208,44 +213,92 @@ void USecurityAuditSubsystem::SendSecurityAlert(const FString& AlertMessage, ESe
 
 void USecurityAuditSubsystem::CleanupOldEvents()
 {
+    // Retention is enforced a whole segment at a time
     FDateTime Cutoff = FDateTime::Now() - FTimespan(EVENT_RETENTION_DAYS, 0, 0, 0);
-    SecurityEvents.RemoveAll([&Cutoff](const FSecurityAuditEvent& Event)
+    const int32 DeletedSegments = Journal.DeleteSegmentsBefore(Cutoff);
+    if (DeletedSegments > 0)
     {
-        return Event.Timestamp < Cutoff;
-    });
+        UE_LOG(LogTemp, Log, TEXT("SecurityAuditSubsystem: Removed %d expired journal segments"), DeletedSegments);
+    }
+
+    // Drop cached events that have aged out of the recent window
+    RecentEvents.PopFront(FindFirstRecentEvent(FDateTime::Now() - FTimespan::FromHours(RECENT_EVENT_HOURS)));
 }
 
 bool USecurityAuditSubsystem::WriteEventToFile(const FSecurityAuditEvent& Event)
 {
-    FString LogLine = FormatEventForLog(Event) + TEXT("\n");
-    FString FilePath = FPaths::ProjectLogDir() + TEXT("SecurityAudit.log");
-    return FFileHelper::SaveStringToFile(LogLine, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+    // Committed in batches by the journal's writer thread
+    Journal.Append(Event);
+    return true;
 }
 
 bool USecurityAuditSubsystem::LoadEventsFromFile()
 {
-    FString FilePath = FPaths::ProjectLogDir() + TEXT("SecurityAudit.log");
-    TArray<FString> Lines;
-    if (FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+    if (!Journal.Open(FPaths::ProjectLogDir() / TEXT("SecurityAudit")))
     {
-        for (const FString& Line : Lines)
+        return false;
+    }
+
+    // Only the recent window is brought into memory; older history stays in the journal
+    FDateTime Now = FDateTime::Now();
+    TArray<FSecurityAuditEvent> LoadedEvents;
+    Journal.QueryTimeRange(Now - FTimespan::FromHours(RECENT_EVENT_HOURS), Now, LoadedEvents);
+
+    RecentEvents.Empty();
+    for (int32 Index = FMath::Max(0, LoadedEvents.Num() - MAX_STORED_EVENTS); Index < LoadedEvents.Num(); Index++)
+    {
+        RecentEvents.Add(MoveTemp(LoadedEvents[Index]));
+    }
+    return true;
+}
+
+int32 USecurityAuditSubsystem::FindFirstRecentEvent(const FDateTime& Time) const
+{
+    int32 Low = 0;
+    int32 High = RecentEvents.Num();
+    while (Low < High)
+    {
+        const int32 Mid = Low + (High - Low) / 2;
+        if (RecentEvents[Mid].Timestamp < Time)
         {
-            // This is a simplified parser. A real implementation would be more robust.
-            TArray<FString> Parts;
-            Line.ParseIntoArray(Parts, TEXT("] ["), true);
-            if (Parts.Num() >= 4)
-            {
-                FSecurityAuditEvent Event;
-                FDateTime::Parse(Parts[0].RightChop(1), Event.Timestamp);
-                Event.EventType = static_cast<ESecurityEventType>(FCString::Atoi(*(FindObject<UEnum>(nullptr, TEXT("ESecurityEventType"), true)->GetNameStringByValue(FCString::Atoi(*Parts[1])))));
-                Event.Severity = static_cast<ESecuritySeverity>(FCString::Atoi(*(FindObject<UEnum>(nullptr, TEXT("ESecuritySeverity"), true)->GetNameStringByValue(FCString::Atoi(*Parts[2])))));
-                Event.Description = Parts[3].LeftChop(1);
-                SecurityEvents.Add(Event);
-            }
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return Low;
+}
+
+FDateTime USecurityAuditSubsystem::GetRecentEventsHorizon() const
+{
+    FDateTime WindowStart = FDateTime::Now() - FTimespan::FromHours(RECENT_EVENT_HOURS);
+
+    // A full cache may have dropped events inside the window
+    if (RecentEvents.Num() >= MAX_STORED_EVENTS)
+    {
+        return FMath::Max(WindowStart, RecentEvents.First().Timestamp);
+    }
+    return WindowStart;
+}
+
+void USecurityAuditSubsystem::CollectEvents(const FDateTime& StartTime, const FDateTime& EndTime, uint32 EventTypeMask, TArray<FSecurityAuditEvent>& OutEvents)
+{
+    if (StartTime < GetRecentEventsHorizon())
+    {
+        Journal.QueryTimeRange(StartTime, EndTime, OutEvents, EventTypeMask);
+        return;
+    }
+
+    for (int32 Index = FindFirstRecentEvent(StartTime); Index < RecentEvents.Num() && RecentEvents[Index].Timestamp <= EndTime; Index++)
+    {
+        const FSecurityAuditEvent& Event = RecentEvents[Index];
+        if ((FSecurityAuditJournal::GetEventTypeBit((uint8)Event.EventType) & EventTypeMask) != 0)
+        {
+            OutEvents.Add(Event);
         }
-        return true;
     }
-    return false;
 }
 
 FString USecurityAuditSubsystem::GenerateEventId()
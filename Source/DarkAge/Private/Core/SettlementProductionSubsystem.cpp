@@ -0,0 +1,254 @@
+#include "Core/SettlementProductionSubsystem.h"
+#include "Core/EconomySubsystem.h"
+#include "Core/CraftingRecipeDatabase.h"
+#include "Core/AdvancedResourceChainSubsystem.h"
+
+void USettlementProductionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    BindEconomy(Collection.InitializeDependency<UEconomySubsystem>());
+    CraftingRecipes = Collection.InitializeDependency<UCraftingRecipeDatabase>();
+    ResourceChains = Collection.InitializeDependency<UAdvancedResourceChainSubsystem>();
+
+    CompileResourceChainRecipes();
+    for (const FSettlementExtractionRecipe& Recipe : ExtractionRecipes)
+    {
+        AddExtractionRecipe(Recipe);
+    }
+
+    if (CraftingRecipes)
+    {
+        // The table may already be resident, in which case it is built before RequestLoad returns
+        CraftingRecipes->RequestLoad(CraftingRecipesTable);
+        if (CraftingRecipes->IsLoaded())
+        {
+            CompileCraftingRecipes();
+        }
+        else
+        {
+            CraftingRecipes->OnRecipesLoaded.AddDynamic(this, &USettlementProductionSubsystem::HandleCraftingRecipesLoaded);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SettlementProductionSubsystem initialized with %d production recipes"), Production.NumRecipes());
+}
+
+void USettlementProductionSubsystem::Deinitialize()
+{
+    if (CraftingRecipes)
+    {
+        CraftingRecipes->OnRecipesLoaded.RemoveDynamic(this, &USettlementProductionSubsystem::HandleCraftingRecipesLoaded);
+    }
+
+    Production.Reset();
+    PendingWorkers.Empty();
+    StockChanges.Empty();
+
+    Super::Deinitialize();
+}
+
+void USettlementProductionSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceLastStep += DeltaTime;
+    if (TimeSinceLastStep >= SimulationInterval)
+    {
+        SimulateStep(TimeSinceLastStep);
+        TimeSinceLastStep = 0.0f;
+    }
+}
+
+void USettlementProductionSubsystem::RegisterSettlement(FName SettlementID, FName RegionID)
+{
+    if (SettlementID == NAME_None)
+    {
+        return;
+    }
+
+    Production.AddSettlement(SettlementID, RegionID);
+}
+
+bool USettlementProductionSubsystem::SetRecipeWorkers(FName SettlementID, FName RecipeID, int32 Workers)
+{
+    const int32 Settlement = Production.FindSettlement(SettlementID);
+    if (Settlement == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SetRecipeWorkers: Settlement '%s' is not registered."), *SettlementID.ToString());
+        return false;
+    }
+
+    const int32 Recipe = Production.FindRecipe(RecipeID);
+    if (Recipe == INDEX_NONE)
+    {
+        if (CraftingRecipes && CraftingRecipes->IsLoading())
+        {
+            // May be a crafting recipe that hasn't streamed in yet
+            PendingWorkers.Add({ SettlementID, RecipeID, Workers });
+            return true;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("SetRecipeWorkers: Recipe '%s' is not a known production recipe."), *RecipeID.ToString());
+        return false;
+    }
+
+    Production.SetWorkers(Settlement, Recipe, Workers);
+    return true;
+}
+
+void USettlementProductionSubsystem::SetProfessionWorkers(FName SettlementID, const TMap<ENPCProfession, int32>& ProfessionCounts)
+{
+    // Professions sharing a recipe pool their workers, and recipes whose workers all left drop to zero
+    TMap<FName, int32, TInlineSetAllocator<16>> RecipeWorkers;
+    for (const TPair<ENPCProfession, FName>& Entry : ProfessionRecipes)
+    {
+        if (Entry.Value != NAME_None)
+        {
+            RecipeWorkers.FindOrAdd(Entry.Value) += ProfessionCounts.FindRef(Entry.Key);
+        }
+    }
+
+    for (const TPair<FName, int32>& Entry : RecipeWorkers)
+    {
+        SetRecipeWorkers(SettlementID, Entry.Key, Entry.Value);
+    }
+}
+
+bool USettlementProductionSubsystem::AddExtractionRecipe(const FSettlementExtractionRecipe& Recipe)
+{
+    if (Recipe.RecipeID == NAME_None || Recipe.OutputItemID == NAME_None)
+    {
+        return false;
+    }
+
+    if (Production.AddRecipe(Recipe.RecipeID, {}, Recipe.OutputItemID, Recipe.OutputQuantity, Recipe.CycleSeconds) == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SettlementProductionSubsystem: Extraction recipe '%s' shares its ID with another production recipe and is skipped."), *Recipe.RecipeID.ToString());
+        return false;
+    }
+    return true;
+}
+
+void USettlementProductionSubsystem::BindEconomy(UEconomySubsystem* InEconomy)
+{
+    Economy = InEconomy;
+}
+
+void USettlementProductionSubsystem::AddSettlementStock(FName SettlementID, FName ItemID, int32 Quantity)
+{
+    const int32 Settlement = Production.FindSettlement(SettlementID);
+    if (Settlement == INDEX_NONE || ItemID == NAME_None)
+    {
+        return;
+    }
+
+    Production.AddStock(Settlement, Production.FindOrAddItem(ItemID), Quantity);
+}
+
+int32 USettlementProductionSubsystem::GetSettlementStock(FName SettlementID, FName ItemID) const
+{
+    const int32 Settlement = Production.FindSettlement(SettlementID);
+    const int32 Item = Production.FindItem(ItemID);
+    return (Settlement != INDEX_NONE && Item != INDEX_NONE) ? Production.GetStock(Settlement, Item) : 0;
+}
+
+void USettlementProductionSubsystem::SimulateStep(float DeltaSeconds)
+{
+    Production.Step(DeltaSeconds);
+
+    if (!Economy)
+    {
+        return;
+    }
+
+    // Whatever a settlement's workers made or used up changes its region's market supply
+    Production.GetStockChanges(StockChanges);
+    for (const FDAProductionBatch::FStockChange& Change : StockChanges)
+    {
+        const FName RegionID = Production.GetSettlementRegion(Change.Settlement);
+        if (RegionID != NAME_None)
+        {
+            Economy->UpdateSupply(RegionID, Production.GetItemID(Change.Item), static_cast<float>(Change.Delta));
+        }
+    }
+}
+
+void USettlementProductionSubsystem::HandleCraftingRecipesLoaded()
+{
+    CraftingRecipes->OnRecipesLoaded.RemoveDynamic(this, &USettlementProductionSubsystem::HandleCraftingRecipesLoaded);
+    CompileCraftingRecipes();
+    ApplyPendingWorkers();
+
+    // Anything still pending names a recipe that doesn't exist
+    for (const FPendingWorkers& Pending : PendingWorkers)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SettlementProductionSubsystem: Dropping workers for unknown recipe '%s' in '%s'."), *Pending.RecipeID.ToString(), *Pending.SettlementID.ToString());
+    }
+    PendingWorkers.Empty();
+}
+
+void USettlementProductionSubsystem::CompileResourceChainRecipes()
+{
+    if (!ResourceChains)
+    {
+        return;
+    }
+
+    TArray<TPair<FName, int32>, TInlineAllocator<8>> Inputs;
+    for (const TPair<FString, FProductionRecipe>& Entry : ResourceChains->GetProductionRecipes())
+    {
+        const FProductionRecipe& Recipe = Entry.Value;
+
+        Inputs.Reset();
+        for (const FResourceRequirement& Requirement : Recipe.InputRequirements)
+        {
+            if (!Requirement.bIsOptional)
+            {
+                Inputs.Emplace(FName(*Requirement.ResourceID), Requirement.Quantity);
+            }
+        }
+
+        Production.AddRecipe(FName(*Entry.Key), Inputs, FName(*Recipe.OutputResourceID), Recipe.OutputQuantity, Recipe.ProductionTime, Recipe.SuccessRate);
+    }
+}
+
+void USettlementProductionSubsystem::CompileCraftingRecipes()
+{
+    TArray<TPair<FName, int32>, TInlineAllocator<8>> Inputs;
+    for (int32 RecipeIndex = 0; RecipeIndex < CraftingRecipes->GetNumRecipes(); ++RecipeIndex)
+    {
+        const FCraftingRecipe& Recipe = CraftingRecipes->GetRecipe(RecipeIndex);
+
+        Inputs.Reset();
+        for (const FCraftingIngredient& Ingredient : CraftingRecipes->GetIngredients(RecipeIndex))
+        {
+            Inputs.Emplace(Ingredient.ItemID, Ingredient.Quantity);
+        }
+
+        const FName RecipeID = CraftingRecipes->GetRecipeID(RecipeIndex);
+        if (Production.AddRecipe(RecipeID, Inputs, Recipe.OutputItemID, Recipe.OutputQuantity, CraftingCycleSeconds) == INDEX_NONE
+            && Production.FindRecipe(RecipeID) != INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SettlementProductionSubsystem: Crafting recipe '%s' shares its ID with another production recipe and is skipped."), *RecipeID.ToString());
+        }
+    }
+}
+
+void USettlementProductionSubsystem::ApplyPendingWorkers()
+{
+    // In request order, so a later assignment to the same recipe wins
+    for (int32 i = 0; i < PendingWorkers.Num();)
+    {
+        const FPendingWorkers& Pending = PendingWorkers[i];
+        const int32 Settlement = Production.FindSettlement(Pending.SettlementID);
+        const int32 Recipe = Production.FindRecipe(Pending.RecipeID);
+        if (Settlement != INDEX_NONE && Recipe != INDEX_NONE)
+        {
+            Production.SetWorkers(Settlement, Recipe, Pending.Workers);
+            PendingWorkers.RemoveAt(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
@@ -3,6 +3,14 @@
 #include "AI/DAAIBaseCharacter.h"
 #include "Engine/World.h"
 
+namespace
+{
+    // Influence a relationship lends each side: friends (strength >= 0) count one point plus normalized strength
+    float GetInfluenceContribution(float RelationshipStrength)
+    {
+        return RelationshipStrength >= 0.0f ? 1.0f + RelationshipStrength / 100.0f : 0.0f;
+    }
+}
 
 USocialSimulationSubsystem::USocialSimulationSubsystem()
 {
@@ -51,10 +59,10 @@ void USocialSimulationSubsystem::OnSystemTick(float DeltaTime)
     }
     float CurrentTime = World->GetTimeSeconds();
     
-    // Process relationship decay
+    // Decay is evaluated on read; a background pass folds it into stored strengths a batch at a time
     if (CurrentTime - LastRelationshipDecayTime >= 60.0f) // Every minute
     {
-        ProcessRelationshipDecay(DeltaTime);
+        CompactRelationshipDecay();
         LastRelationshipDecayTime = CurrentTime;
     }
     
@@ -110,33 +118,39 @@ void USocialSimulationSubsystem::UpdateRelationship(const FString& Character1ID,
         return;
     }
     
-    FString RelationshipKey = GetRelationshipKey(Character1ID, Character2ID);
+    const int32 CharacterIndex1 = InternCharacter(Character1ID);
+    const int32 CharacterIndex2 = InternCharacter(Character2ID);
+    const uint64 RelationshipKey = GetRelationshipKey(CharacterIndex1, CharacterIndex2);
     FSocialRelationship* Relationship = CharacterRelationships.Find(RelationshipKey);
+    const float CurrentTime = GetCurrentTime();
     
     if (!Relationship)
     {
         // Create new relationship
         FSocialRelationship NewRelationship;
         NewRelationship.RelationshipType = NewType;
-        NewRelationship.RelationshipStrength = StrengthChange;
-        if (UWorld* World = GetWorld())
-        {
-            NewRelationship.LastInteractionTime = World->GetTimeSeconds();
-        }
+        NewRelationship.LastInteractionTime = CurrentTime;
+        NewRelationship.LastDecayTime = CurrentTime;
         NewRelationship.InteractionCount = 1;
         
-        CharacterRelationships.Add(RelationshipKey, NewRelationship);
-        Relationship = &CharacterRelationships[RelationshipKey];
+        Relationship = &CharacterRelationships.Add(RelationshipKey, NewRelationship);
+        CharacterNeighbours[CharacterIndex1].Add(CharacterIndex2);
+        CharacterNeighbours[CharacterIndex2].Add(CharacterIndex1);
+
+        // A zero-strength relationship already counts as a friend for influence
+        const float InitialContribution = GetInfluenceContribution(0.0f);
+        CharacterRelationshipInfluence[CharacterIndex1] += InitialContribution;
+        CharacterRelationshipInfluence[CharacterIndex2] += InitialContribution;
+        SetRelationshipStrength(CharacterIndex1, CharacterIndex2, *Relationship, StrengthChange);
     }
     else
     {
-        // Update existing relationship
+        // Update existing relationship, materializing any pending decay first
         Relationship->RelationshipType = NewType;
-        Relationship->RelationshipStrength = FMath::Clamp(Relationship->RelationshipStrength + StrengthChange, -100.0f, 100.0f);
-        if (UWorld* World = GetWorld())
-        {
-            Relationship->LastInteractionTime = World->GetTimeSeconds();
-        }
+        SetRelationshipStrength(CharacterIndex1, CharacterIndex2, *Relationship,
+            FMath::Clamp(GetDecayedStrength(*Relationship, CurrentTime) + StrengthChange, -100.0f, 100.0f));
+        Relationship->LastInteractionTime = CurrentTime;
+        Relationship->LastDecayTime = CurrentTime;
         Relationship->InteractionCount++;
     }
     
@@ -149,12 +163,13 @@ void USocialSimulationSubsystem::UpdateRelationship(const FString& Character1ID,
 
 FSocialRelationship USocialSimulationSubsystem::GetRelationship(const FString& Character1ID, const FString& Character2ID) const
 {
-    FString RelationshipKey = GetRelationshipKey(Character1ID, Character2ID);
-    const FSocialRelationship* Relationship = CharacterRelationships.Find(RelationshipKey);
+    const FSocialRelationship* Relationship = FindRelationship(FindCharacterIndex(Character1ID), FindCharacterIndex(Character2ID));
     
     if (Relationship)
     {
-        return *Relationship;
+        FSocialRelationship Result = *Relationship;
+        Result.RelationshipStrength = GetDecayedStrength(*Relationship, GetCurrentTime());
+        return Result;
     }
     
     // Return default relationship
@@ -208,26 +223,19 @@ TArray<FString> USocialSimulationSubsystem::GetCharacterFriends(const FString& C
 {
     TArray<FString> Friends;
     
-    for (const auto& RelationshipPair : CharacterRelationships)
+    const int32 CharacterIndex = FindCharacterIndex(CharacterID);
+    if (CharacterIndex == INDEX_NONE)
     {
-        const FString& Key = RelationshipPair.Key;
-        const FSocialRelationship& Relationship = RelationshipPair.Value;
-        
-        if (Relationship.RelationshipStrength >= MinRelationshipStrength)
+        return Friends;
+    }
+    
+    const float CurrentTime = GetCurrentTime();
+    for (const int32 OtherIndex : CharacterNeighbours[CharacterIndex])
+    {
+        const FSocialRelationship* Relationship = FindRelationship(CharacterIndex, OtherIndex);
+        if (Relationship && GetDecayedStrength(*Relationship, CurrentTime) >= MinRelationshipStrength)
         {
-            // Extract character IDs from the relationship key
-            FString Character1, Character2;
-            if (Key.Split(TEXT("_"), &Character1, &Character2))
-            {
-                if (Character1 == CharacterID)
-                {
-                    Friends.AddUnique(Character2);
-                }
-                else if (Character2 == CharacterID)
-                {
-                    Friends.AddUnique(Character1);
-                }
-            }
+            Friends.Add(CharacterIDs[OtherIndex]);
         }
     }
     
@@ -238,26 +246,19 @@ TArray<FString> USocialSimulationSubsystem::GetCharacterEnemies(const FString& C
 {
     TArray<FString> Enemies;
     
-    for (const auto& RelationshipPair : CharacterRelationships)
+    const int32 CharacterIndex = FindCharacterIndex(CharacterID);
+    if (CharacterIndex == INDEX_NONE)
     {
-        const FString& Key = RelationshipPair.Key;
-        const FSocialRelationship& Relationship = RelationshipPair.Value;
-        
-        if (Relationship.RelationshipStrength <= MinRelationshipStrength)
+        return Enemies;
+    }
+    
+    const float CurrentTime = GetCurrentTime();
+    for (const int32 OtherIndex : CharacterNeighbours[CharacterIndex])
+    {
+        const FSocialRelationship* Relationship = FindRelationship(CharacterIndex, OtherIndex);
+        if (Relationship && GetDecayedStrength(*Relationship, CurrentTime) <= MinRelationshipStrength)
         {
-            // Extract character IDs from the relationship key
-            FString Character1, Character2;
-            if (Key.Split(TEXT("_"), &Character1, &Character2))
-            {
-                if (Character1 == CharacterID)
-                {
-                    Enemies.AddUnique(Character2);
-                }
-                else if (Character2 == CharacterID)
-                {
-                    Enemies.AddUnique(Character1);
-                }
-            }
+            Enemies.Add(CharacterIDs[OtherIndex]);
         }
     }
     
@@ -424,22 +425,22 @@ TArray<FSocialEvent> USocialSimulationSubsystem::GetRecentSocialEvents(float Tim
 
 float USocialSimulationSubsystem::GetAverageSocialStanding(const FString& CharacterID) const
 {
+    const int32 CharacterIndex = FindCharacterIndex(CharacterID);
+    if (CharacterIndex == INDEX_NONE)
+    {
+        return 0.0f;
+    }
+    
     float TotalRelationshipStrength = 0.0f;
     int32 RelationshipCount = 0;
     
-    for (const auto& RelationshipPair : CharacterRelationships)
+    const float CurrentTime = GetCurrentTime();
+    for (const int32 OtherIndex : CharacterNeighbours[CharacterIndex])
     {
-        const FString& Key = RelationshipPair.Key;
-        const FSocialRelationship& Relationship = RelationshipPair.Value;
-        
-        FString Character1, Character2;
-        if (Key.Split(TEXT("_"), &Character1, &Character2))
+        if (const FSocialRelationship* Relationship = FindRelationship(CharacterIndex, OtherIndex))
         {
-            if (Character1 == CharacterID || Character2 == CharacterID)
-            {
-                TotalRelationshipStrength += Relationship.RelationshipStrength;
-                RelationshipCount++;
-            }
+            TotalRelationshipStrength += GetDecayedStrength(*Relationship, CurrentTime);
+            RelationshipCount++;
         }
     }
     
@@ -448,53 +449,56 @@ float USocialSimulationSubsystem::GetAverageSocialStanding(const FString& Charac
 
 TArray<FString> USocialSimulationSubsystem::GetMostInfluentialCharacters(int32 Count) const
 {
-    TMap<FString, float> CharacterInfluence;
-
-    // Get all unique characters
-    TSet<FString> AllCharacters;
-    for (const auto& RelationshipPair : CharacterRelationships)
+    TArray<FString> Result;
+    if (Count <= 0)
     {
-        FString C1, C2;
-        RelationshipPair.Key.Split(TEXT("_"), &C1, &C2);
-        AllCharacters.Add(C1);
-        AllCharacters.Add(C2);
+        return Result;
     }
 
-    // Calculate influence score for each character
-    for (const FString& CharacterID : AllCharacters)
+    // Keep the top Count characters in a min-heap keyed on influence
+    TArray<TPair<float, int32>> TopCharacters;
+    TopCharacters.Reserve(Count + 1);
+    const auto HeapPredicate = [](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; };
+
+    for (int32 CharacterIndex = 0; CharacterIndex < CharacterIDs.Num(); ++CharacterIndex)
     {
-        float Influence = 0.0f;
-        // Add influence from relationships
-        TArray<FString> Friends = GetCharacterFriends(CharacterID, 0.0f);
-        Influence += Friends.Num() * 1.0f; // 1 point per friend
-        for(const FString& FriendID : Friends)
+        if (CharacterNeighbours[CharacterIndex].Num() == 0)
         {
-            Influence += GetRelationship(CharacterID, FriendID).RelationshipStrength / 100.0f; // Add normalized relationship strength
+            continue;
         }
 
-        // Add influence from faction power
-        TArray<FName> FactionsOfChar = GetCharacterFactions(CharacterID);
-        for (const FName& FactionID : FactionsOfChar)
+        // Relationship influence is maintained incrementally; faction power is looked up per membership
+        float Influence = CharacterRelationshipInfluence[CharacterIndex];
+        if (const FFNameArrayWrapper* CharacterFactions = CharacterFactionMemberships.Find(CharacterIDs[CharacterIndex]))
         {
-            Influence += GetFactionData(FactionID).PowerLevel * 0.1f; // Add 10% of faction power
+            for (const FName& FactionID : CharacterFactions->FactionIDs)
+            {
+                if (const FFactionData* FactionData = Factions.Find(FactionID))
+                {
+                    Influence += FactionData->PowerLevel * 0.1f; // Add 10% of faction power
+                }
+            }
+        }
+
+        if (TopCharacters.Num() < Count)
+        {
+            TopCharacters.HeapPush(TPair<float, int32>(Influence, CharacterIndex), HeapPredicate);
+        }
+        else if (Influence > TopCharacters.HeapTop().Key)
+        {
+            TopCharacters.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+            TopCharacters.HeapPush(TPair<float, int32>(Influence, CharacterIndex), HeapPredicate);
         }
-        
-        CharacterInfluence.Add(CharacterID, Influence);
     }
 
     // Sort characters by influence
-    CharacterInfluence.ValueSort([](const float A, const float B) {
-        return A > B;
+    TopCharacters.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) {
+        return A.Key > B.Key;
     });
 
-    TArray<FString> Result;
-    for (const auto& InfluencePair : CharacterInfluence)
+    for (const TPair<float, int32>& Entry : TopCharacters)
     {
-        if (Result.Num() >= Count)
-        {
-            break;
-        }
-        Result.Add(InfluencePair.Key);
+        Result.Add(CharacterIDs[Entry.Value]);
     }
 
     return Result;
@@ -523,45 +527,115 @@ TArray<FName> USocialSimulationSubsystem::GetMostPowerfulFactions(int32 Count) c
     return Result;
 }
 
-FString USocialSimulationSubsystem::GetRelationshipKey(const FString& Character1ID, const FString& Character2ID) const
+int32 USocialSimulationSubsystem::InternCharacter(const FString& CharacterID)
+{
+    if (const int32* ExistingIndex = CharacterIndexByID.Find(CharacterID))
+    {
+        return *ExistingIndex;
+    }
+
+    const int32 NewIndex = CharacterIDs.Add(CharacterID);
+    CharacterIndexByID.Add(CharacterID, NewIndex);
+    CharacterNeighbours.AddDefaulted();
+    CharacterRelationshipInfluence.Add(0.0f);
+    return NewIndex;
+}
+
+int32 USocialSimulationSubsystem::FindCharacterIndex(const FString& CharacterID) const
+{
+    const int32* Index = CharacterIndexByID.Find(CharacterID);
+    return Index ? *Index : INDEX_NONE;
+}
+
+const FSocialRelationship* USocialSimulationSubsystem::FindRelationship(int32 CharacterIndex1, int32 CharacterIndex2) const
+{
+    if (CharacterIndex1 == INDEX_NONE || CharacterIndex2 == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    return CharacterRelationships.Find(GetRelationshipKey(CharacterIndex1, CharacterIndex2));
+}
+
+void USocialSimulationSubsystem::SetRelationshipStrength(int32 CharacterIndex1, int32 CharacterIndex2, FSocialRelationship& Relationship, float NewStrength)
+{
+    const float InfluenceDelta = GetInfluenceContribution(NewStrength) - GetInfluenceContribution(Relationship.RelationshipStrength);
+    CharacterRelationshipInfluence[CharacterIndex1] += InfluenceDelta;
+    CharacterRelationshipInfluence[CharacterIndex2] += InfluenceDelta;
+    Relationship.RelationshipStrength = NewStrength;
+}
+
+uint64 USocialSimulationSubsystem::GetRelationshipKey(int32 CharacterIndex1, int32 CharacterIndex2)
 {
     // Ensure consistent key ordering
-    if (Character1ID.Compare(Character2ID) < 0)
+    const uint32 LowIndex = static_cast<uint32>(FMath::Min(CharacterIndex1, CharacterIndex2));
+    const uint32 HighIndex = static_cast<uint32>(FMath::Max(CharacterIndex1, CharacterIndex2));
+    return (static_cast<uint64>(LowIndex) << 32) | HighIndex;
+}
+
+float USocialSimulationSubsystem::GetCurrentTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+float USocialSimulationSubsystem::GetDecayedStrength(const FSocialRelationship& Relationship, float CurrentTime) const
+{
+    // Relationships start decaying once they have gone a grace period without interaction
+    const float DecayStartTime = FMath::Max(Relationship.LastDecayTime, Relationship.LastInteractionTime + RelationshipDecayGracePeriod);
+    const float DecayDuration = CurrentTime - DecayStartTime;
+    if (DecayDuration <= 0.0f)
     {
-        return FString::Printf(TEXT("%s_%s"), *Character1ID, *Character2ID);
+        return Relationship.RelationshipStrength;
     }
-    else
+
+    const float DecayAmount = RelationshipDecayRate * (DecayDuration / 86400.0f);
+    if (Relationship.RelationshipStrength > 0.0f)
+    {
+        return FMath::Max(0.0f, Relationship.RelationshipStrength - DecayAmount);
+    }
+    else if (Relationship.RelationshipStrength < 0.0f)
     {
-        return FString::Printf(TEXT("%s_%s"), *Character2ID, *Character1ID);
+        return FMath::Min(0.0f, Relationship.RelationshipStrength + DecayAmount);
     }
+    return 0.0f;
 }
 
-void USocialSimulationSubsystem::ProcessRelationshipDecay(float DeltaTime)
+void USocialSimulationSubsystem::CompactRelationshipDecay()
 {
-    UWorld* World = GetWorld();
-    if (!World)
+    // Low-priority background pass: folds pending decay into stored strengths for a batch of
+    // characters so cached influence stays close to current. Reads never depend on this running.
+    if (CharacterIDs.Num() == 0)
     {
         return;
     }
-    float CurrentTime = World->GetTimeSeconds();
-    
-    for (auto& RelationshipPair : CharacterRelationships)
+
+    const float CurrentTime = GetCurrentTime();
+    const int32 NumToVisit = FMath::Min(DecayCompactionBatchSize, CharacterIDs.Num());
+    for (int32 Visited = 0; Visited < NumToVisit; ++Visited)
     {
-        FSocialRelationship& Relationship = RelationshipPair.Value;
-        
-        // Decay relationships that haven't been updated recently
-        float TimeSinceLastInteraction = CurrentTime - Relationship.LastInteractionTime;
-        if (TimeSinceLastInteraction > 86400.0f) // 24 hours
+        DecayCompactionCursor = (DecayCompactionCursor + 1) % CharacterIDs.Num();
+        const int32 CharacterIndex = DecayCompactionCursor;
+
+        for (const int32 OtherIndex : CharacterNeighbours[CharacterIndex])
         {
-            float DecayAmount = RelationshipDecayRate * (TimeSinceLastInteraction / 86400.0f);
-            
-            if (Relationship.RelationshipStrength > 0.0f)
+            // Visit each pair once, from its lower index
+            if (OtherIndex < CharacterIndex)
             {
-                Relationship.RelationshipStrength = FMath::Max(0.0f, Relationship.RelationshipStrength - DecayAmount);
+                continue;
             }
-            else if (Relationship.RelationshipStrength < 0.0f)
+
+            FSocialRelationship* Relationship = CharacterRelationships.Find(GetRelationshipKey(CharacterIndex, OtherIndex));
+            if (!Relationship)
+            {
+                continue;
+            }
+
+            const float DecayedStrength = GetDecayedStrength(*Relationship, CurrentTime);
+            if (DecayedStrength != Relationship->RelationshipStrength)
             {
-                Relationship.RelationshipStrength = FMath::Min(0.0f, Relationship.RelationshipStrength + DecayAmount);
+                SetRelationshipStrength(CharacterIndex, OtherIndex, *Relationship, DecayedStrength);
+                Relationship->LastDecayTime = CurrentTime;
             }
         }
     }
@@ -47,7 +47,7 @@ void USurvivalIntegrationHelper::UpdateHunger(const UObject* /*WorldContextObjec
         UStatlineComponent* Statline = Character->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            Statline->UpdateStat(FName("Hunger"), Delta);
+            Statline->ModifyHunger(Delta);
         }
     }
 }
@@ -59,7 +59,7 @@ void USurvivalIntegrationHelper::UpdateThirst(const UObject* /*WorldContextObjec
         UStatlineComponent* Statline = Character->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            Statline->UpdateStat(FName("Thirst"), Delta);
+            Statline->ModifyThirst(Delta);
         }
     }
 }
@@ -94,7 +94,7 @@ float USurvivalIntegrationHelper::GetCurrentHunger(const UObject* /*WorldContext
         UStatlineComponent* Statline = Character->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            return Statline->GetCurrentStatValue(FName("Hunger"));
+            return Statline->GetCurrentHunger();
         }
     }
     return 0.0f;
@@ -107,7 +107,7 @@ float USurvivalIntegrationHelper::GetCurrentThirst(const UObject* /*WorldContext
         UStatlineComponent* Statline = Character->FindComponentByClass<UStatlineComponent>();
         if (Statline)
         {
-            return Statline->GetCurrentStatValue(FName("Thirst"));
+            return Statline->GetCurrentThirst();
         }
     }
     return 0.0f;
@@ -1,10 +1,12 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Core/TimeSystem.h"
+#include "Algo/BinarySearch.h"
 
 UTimeSystem::UTimeSystem()
 	: TimeScale(1.0f)
 	, AccumulatedTime(0.0f)
+	, NextEventIndex(0)
 {
 }
 
@@ -30,6 +32,7 @@ void UTimeSystem::Deinitialize()
 	
 	// Clean up any resources
 	CalendarEvents.Empty();
+	NextEventIndex = 0;
 }
 
 void UTimeSystem::UpdateTime(float DeltaTime)
@@ -198,62 +201,52 @@ void UTimeSystem::SetTimeScale(float NewTimeScale)
 void UTimeSystem::SetCurrentDateTime(const FGameDateTime& NewDateTime)
 {
 	CurrentDateTime = NewDateTime;
+	
+	// Events skipped over are dropped at the next check without firing; fired events are already gone, so going back doesn't replay them
+	NextEventIndex = UpperBoundEvent(CurrentDateTime.GetTotalMinutes());
+	
 	OnTimeChanged.Broadcast(CurrentDateTime);
 }
 
 void UTimeSystem::AddCalendarEvent(const FGameDateTime& EventTime, FName EventType, const FString& EventDescription)
 {
-	// Create a unique key for this event
-	FString EventKey = DateTimeToString(EventTime) + "_" + EventType.ToString();
+	const int32 Timestamp = EventTime.GetTotalMinutes();
+	const int32 RangeEnd = UpperBoundEvent(Timestamp);
 	
-	// Store the event
-	CalendarEvents.Add(EventKey, TPair<FGameDateTime, FString>(EventTime, EventDescription));
+	// One event per type at a given time; re-adding replaces the description
+	for (int32 Index = LowerBoundEvent(Timestamp); Index < RangeEnd; ++Index)
+	{
+		if (CalendarEvents[Index].EventType == EventType)
+		{
+			CalendarEvents[Index].Description = EventDescription;
+			return;
+		}
+	}
+	
+	CalendarEvents.Insert(FCalendarEntry{ Timestamp, EventType, EventTime, EventDescription }, RangeEnd);
+	
+	// Keep the cursor on the same pending event; an event added at or before the current minute counts as passed
+	if (RangeEnd < NextEventIndex || (RangeEnd == NextEventIndex && Timestamp <= CurrentDateTime.GetTotalMinutes()))
+	{
+		++NextEventIndex;
+	}
 }
 
 TArray<FString> UTimeSystem::GetUpcomingEvents(int32 DaysAhead) const
 {
 	TArray<FString> UpcomingEvents;
 	
-	// Calculate the end date for our search
-	FGameDateTime EndDate = CurrentDateTime;
-	EndDate.Day += DaysAhead;
+	// Whole days from the start of today through the end of the last day in range
+	const int32 MinutesPerDay = 24 * 60;
+	const int32 RangeStart = CurrentDateTime.GetTotalDays() * MinutesPerDay;
+	const int32 RangeEnd = (CurrentDateTime.GetTotalDays() + DaysAhead + 1) * MinutesPerDay;
 	
-	// Handle month/year overflow
-	if (EndDate.Day > 30)
+	for (int32 Index = LowerBoundEvent(RangeStart); Index < CalendarEvents.Num() && CalendarEvents[Index].Timestamp < RangeEnd; ++Index)
 	{
-		EndDate.Month += EndDate.Day / 30;
-		EndDate.Day = (EndDate.Day % 30 == 0) ? 30 : EndDate.Day % 30;
-		
-		if (EndDate.Month > 12)
-		{
-			EndDate.Year += EndDate.Month / 12;
-			EndDate.Month = (EndDate.Month % 12 == 0) ? 12 : EndDate.Month % 12;
-		}
-	}
-	
-	// Check all events
-	for (const auto& EventPair : CalendarEvents)
-	{
-		const FGameDateTime& EventTime = EventPair.Value.Key;
-		const FString& EventDesc = EventPair.Value.Value;
-		
-		// Check if event is within our time range
-		if (EventTime.Year > CurrentDateTime.Year || 
-			(EventTime.Year == CurrentDateTime.Year && EventTime.Month > CurrentDateTime.Month) ||
-			(EventTime.Year == CurrentDateTime.Year && EventTime.Month == CurrentDateTime.Month && EventTime.Day >= CurrentDateTime.Day))
-		{
-			if (EventTime.Year < EndDate.Year ||
-				(EventTime.Year == EndDate.Year && EventTime.Month < EndDate.Month) ||
-				(EventTime.Year == EndDate.Year && EventTime.Month == EndDate.Month && EventTime.Day <= EndDate.Day))
-			{
-				// Event is within range, add to list
-				FString EventString = FString::Printf(TEXT("Year %d, Month %d, Day %d at %02d:%02d - %s"),
-					EventTime.Year, EventTime.Month, EventTime.Day, EventTime.Hour, EventTime.Minute,
-					*EventDesc);
-				
-				UpcomingEvents.Add(EventString);
-			}
-		}
+		const FCalendarEntry& Entry = CalendarEvents[Index];
+		UpcomingEvents.Add(FString::Printf(TEXT("Year %d, Month %d, Day %d at %02d:%02d - %s"),
+			Entry.EventTime.Year, Entry.EventTime.Month, Entry.EventTime.Day, Entry.EventTime.Hour, Entry.EventTime.Minute,
+			*Entry.Description));
 	}
 	
 	return UpcomingEvents;
@@ -267,33 +260,31 @@ void UTimeSystem::UpdateSeason()
 
 void UTimeSystem::CheckCalendarEvents()
 {
-	// Check if any events are happening at the current time
-	FString CurrentTimeKey = DateTimeToString(CurrentDateTime);
-	
-	// Look for events that match the current time
-	for (const auto& EventPair : CalendarEvents)
+	// Fire every event the clock has reached, including any skipped when several minutes pass in one update
+	const int32 Now = CurrentDateTime.GetTotalMinutes();
+	while (NextEventIndex < CalendarEvents.Num() && CalendarEvents[NextEventIndex].Timestamp <= Now)
 	{
-		const FGameDateTime& EventTime = EventPair.Value.Key;
-		const FString& EventDesc = EventPair.Value.Value;
+		// Copy out; listeners may add events and reallocate the array
+		const FCalendarEntry Entry = CalendarEvents[NextEventIndex++];
 		
-		// Check if event matches current date and time
-		if (EventTime.Year == CurrentDateTime.Year &&
-			EventTime.Month == CurrentDateTime.Month &&
-			EventTime.Day == CurrentDateTime.Day &&
-			EventTime.Hour == CurrentDateTime.Hour &&
-			EventTime.Minute == CurrentDateTime.Minute)
-		{
-			// Event is happening now - trigger notification or event
-			// This would integrate with a notification system
-			UE_LOG(LogTemp, Display, TEXT("Calendar Event: %s"), *EventDesc);
-			
-			// Additional event handling would go here
-		}
+		UE_LOG(LogTemp, Display, TEXT("Calendar Event: %s"), *Entry.Description);
+		OnCalendarEvent.Broadcast(Entry.EventType, Entry.Description);
+	}
+	
+	// Nothing before the cursor fires again; drop it so the array, and the cost of inserting into it, only covers pending events
+	if (NextEventIndex > 0)
+	{
+		CalendarEvents.RemoveAt(0, NextEventIndex, EAllowShrinking::No);
+		NextEventIndex = 0;
 	}
 }
 
-FString UTimeSystem::DateTimeToString(const FGameDateTime& DateTime) const
+int32 UTimeSystem::LowerBoundEvent(int32 Timestamp) const
 {
-	return FString::Printf(TEXT("%04d_%02d_%02d_%02d_%02d"),
-		DateTime.Year, DateTime.Month, DateTime.Day, DateTime.Hour, DateTime.Minute);
-}
\ No newline at end of file
+	return Algo::LowerBoundBy(CalendarEvents, Timestamp, &FCalendarEntry::Timestamp);
+}
+
+int32 UTimeSystem::UpperBoundEvent(int32 Timestamp) const
+{
+	return Algo::UpperBoundBy(CalendarEvents, Timestamp, &FCalendarEntry::Timestamp);
+}
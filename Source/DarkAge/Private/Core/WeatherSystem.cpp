@@ -1,4 +1,5 @@
 #include "Core/WeatherSystem.h"
+#include "Core/EnvironmentalFieldSubsystem.h"
 #include "TimerManager.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
@@ -8,8 +9,10 @@
 void UWeatherSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+    Collection.InitializeDependency<UEnvironmentalFieldSubsystem>();
     CurrentWeather = EWeatherType::Clear;
-    CurrentTemperature = 70.0f;
+    CurrentTemperature = DefaultTemperature;
+    PublishEnvironmentalFactors();
 
     // Start weather updates
     if (UWorld* World = GetWorld())
@@ -46,7 +49,34 @@ float UWeatherSystem::GetCurrentTemperature() const
 
 void UWeatherSystem::SetWeather(EWeatherType NewWeather)
 {
+    if (CurrentWeather == NewWeather)
+    {
+        return;
+    }
+
     CurrentWeather = NewWeather;
+    PublishEnvironmentalFactors();
+}
+
+void UWeatherSystem::SetTemperature(float NewTemperature)
+{
+    CurrentTemperature = NewTemperature;
+    PublishEnvironmentalFactors();
+}
+
+void UWeatherSystem::PublishEnvironmentalFactors()
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    UEnvironmentalFieldSubsystem* FieldSubsystem = GameInstance ? GameInstance->GetSubsystem<UEnvironmentalFieldSubsystem>() : nullptr;
+    if (!FieldSubsystem)
+    {
+        return;
+    }
+
+    FEnvironmentalFactors Factors;
+    Factors.AirTemperature = CurrentTemperature;
+    Factors.Weather = CurrentWeather;
+    FieldSubsystem->PublishGlobalFactors(Factors);
 }
 
 void UWeatherSystem::UpdateWeather()
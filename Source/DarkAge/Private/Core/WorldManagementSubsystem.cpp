@@ -159,26 +159,31 @@ TArray<FName> UWorldManagementSubsystem::GetAllRegionIDs() const
 }
 
 FRegionData UWorldManagementSubsystem::GetRegionData(const FString& RegionID) const
+{
+    const FRegionData* Row = FindRegionData(RegionID);
+    return Row ? *Row : FRegionData();
+}
+
+const FRegionData* UWorldManagementSubsystem::FindRegionData(const FString& RegionID) const
 {
     if (!RegionDataTable)
     {
-        return FRegionData();
+        return nullptr;
     }
 
-    FRegionData* Row = RegionDataTable->FindRow<FRegionData>(FName(*RegionID), TEXT(""));
-    return Row ? *Row : FRegionData();
+    return RegionDataTable->FindRow<FRegionData>(FName(*RegionID), TEXT(""), false);
 }
 
 TMap<FName, FVector> UWorldManagementSubsystem::GetPointsOfInterest(const FString& RegionID) const
 {
-    FRegionData RegionData = GetRegionData(RegionID);
-    return RegionData.PointsOfInterest;
+    const FRegionData* RegionData = FindRegionData(RegionID);
+    return RegionData ? RegionData->PointsOfInterest : TMap<FName, FVector>();
 }
 
 float UWorldManagementSubsystem::GetPoliticalStability(const FString& RegionID) const
 {
-    FRegionData RegionData = GetRegionData(RegionID);
-    return RegionData.PoliticalStability;
+    const FRegionData* RegionData = FindRegionData(RegionID);
+    return RegionData ? RegionData->PoliticalStability : 0.0f;
 }
 
 void UWorldManagementSubsystem::SetTimeScale(float NewTimeScale)
@@ -16,6 +16,64 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonReader.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    // Game time represented by one persistence update cycle (5 real seconds)
+    constexpr float GameMinutesPerUpdate = 15.0f;
+    constexpr int32 MaxRegionEvents = 20;
+
+    // Limit the number of stored actions to prevent memory bloat
+    constexpr int32 MaxStoredActions = 1000;
+
+    // Recent player impact halves every game day
+    constexpr float ImpactHalfLifeMinutes = 24.0f * 60.0f;
+
+    float GetImpactDecayFactor(int32 ElapsedMinutes)
+    {
+        return FMath::Exp2(-FMath::Max(ElapsedMinutes, 0) / ImpactHalfLifeMinutes);
+    }
+
+    // Fast-forward integrates one game day of cycles per step and spends at most this long per frame
+    constexpr int32 CatchUpCyclesPerStep = 96;
+    constexpr double CatchUpFrameBudgetSeconds = 0.004;
+
+    // Downtime is converted at UTimeSystem's normal rate of one game minute per real second
+    constexpr double RealSecondsPerGameMinute = 1.0;
+
+    // Per cycle a region rolls an event in UpdateRegion (2.5%) and in the evolution loop (50%)
+    constexpr float EventChancePerCycle = 0.525f;
+
+    void GetCandidateEventTypes(float CrimeHeatLevel, TArray<FName>& OutEvents)
+    {
+        // Crime events
+        if (CrimeHeatLevel > 0.6f)
+        {
+            OutEvents.Add(FName("BanditRaid"));
+            OutEvents.Add(FName("CriminalTakeover"));
+        }
+        else if (CrimeHeatLevel < 0.3f)
+        {
+            OutEvents.Add(FName("GuardPatrols"));
+            OutEvents.Add(FName("CriminalArrest"));
+        }
+
+        // Always add some generic events
+        OutEvents.Add(FName("TravelersArrival"));
+        OutEvents.Add(FName("WeatherEvent"));
+        OutEvents.Add(FName("LocalCelebration"));
+    }
+
+    float SampleStandardNormal(FRandomStream& Stream)
+    {
+        // Box-Muller transform
+        const float U1 = FMath::Max(Stream.GetFraction(), UE_KINDA_SMALL_NUMBER);
+        const float U2 = Stream.GetFraction();
+        return FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(2.0f * PI * U2);
+    }
+}
 
 UWorldPersistenceSystem::UWorldPersistenceSystem()
     : WorldStateLock(nullptr)
@@ -80,14 +138,25 @@ void UWorldPersistenceSystem::Initialize(FSubsystemCollectionBase& Collection)
         IFileManager::Get().Delete(*ResetFlagPath);
     }
 
-    // Load world state from disk
-    LoadWorldState();
+    // Load world state from disk, then fast-forward over the time the server was down
+    if (LoadWorldState() && LastSavedUtc.GetTicks() > 0)
+    {
+        const double OfflineSeconds = (FDateTime::UtcNow() - LastSavedUtc).GetTotalSeconds();
+        const int32 OfflineGameMinutes = static_cast<int32>(FMath::Min(OfflineSeconds / RealSecondsPerGameMinute, static_cast<double>(MAX_int32)));
+        BeginWorldCatchUp(OfflineGameMinutes, static_cast<int32>(GetTypeHash(LastSavedUtc)));
+    }
     
     UE_LOG(LogTemp, Log, TEXT("World Persistence System initialized with %d regions"), RegionStates.Num());
 }
 
 void UWorldPersistenceSystem::Deinitialize()
 {
+    // Commit whatever part of a catch-up has already been simulated
+    if (bCatchUpInProgress)
+    {
+        FinishWorldCatchUp(true);
+    }
+
     // Release any active locks
     if (WorldStateLock && !CurrentSaveLockID.IsValid() == false)
     {
@@ -172,8 +241,8 @@ void UWorldPersistenceSystem::RecordPlayerAction(EWorldActionType ActionType, FV
         NewAction.Timestamp = TimeSystem->GetCurrentDateTime();
     }
     
-    // Add to action list
-    PlayerActions.Add(NewAction);
+    // Add to action list and regional aggregates
+    AddPlayerAction(NewAction);
     
     // Apply immediate effects for high-magnitude actions
     if (Magnitude > 0.7f)
@@ -207,8 +276,7 @@ void UWorldPersistenceSystem::SimulateWorldEvolution(int32 GameMinutes)
     
     // Calculate how many update cycles this represents
     // Assuming we update every 5 seconds of real time, which might represent longer in game time
-    const float GameTimePerUpdate = 15.0f; // 15 minutes of game time per update
-    const int32 UpdateCycles = FMath::CeilToInt(GameMinutes / GameTimePerUpdate);
+    const int32 UpdateCycles = FMath::CeilToInt(GameMinutes / GameMinutesPerUpdate);
     
     UE_LOG(LogTemp, Log, TEXT("Simulating world evolution for %d game minutes (%d update cycles)"), 
         GameMinutes, UpdateCycles);
@@ -248,6 +316,183 @@ void UWorldPersistenceSystem::SimulateWorldEvolution(int32 GameMinutes)
     SaveWorldState();
 }
 
+bool UWorldPersistenceSystem::BeginWorldCatchUp(int32 GameMinutes, int32 Seed)
+{
+    if (bCatchUpInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WorldPersistenceSystem: Catch-up already in progress"));
+        return false;
+    }
+
+    if (GameMinutes <= 0)
+    {
+        return false;
+    }
+
+    // Apply anything recorded before going offline; no new actions arrive during catch-up
+    ProcessPlayerActions();
+
+    CatchUpRegions.Reset(RegionStates.Num());
+    for (const auto& RegionPair : RegionStates)
+    {
+        FRegionCatchUpState& State = CatchUpRegions.AddDefaulted_GetRef();
+        State.RegionID = RegionPair.Key;
+        State.CrimeHeatLevel = RegionPair.Value.CrimeHeatLevel;
+        // FName hashes depend on name table order; the region string hashes the same in every run
+        State.RandomStream.Initialize(static_cast<int32>(HashCombine(GetTypeHash(Seed), GetTypeHash(RegionPair.Key.ToString()))));
+        State.RecentEventTypes.Reserve(MaxRegionEvents);
+        State.PlayerImpact = GetPlayerRegionalImpact(RegionPair.Key);
+    }
+
+    CatchUpTotalCycles = FMath::CeilToInt(GameMinutes / GameMinutesPerUpdate);
+    CatchUpCompletedCycles = 0;
+    bCatchUpCancelRequested = false;
+    bCatchUpInProgress = true;
+
+    UE_LOG(LogTemp, Log, TEXT("WorldPersistenceSystem: Catching up %d game minutes (%d update cycles) across %d regions"),
+        GameMinutes, CatchUpTotalCycles, CatchUpRegions.Num());
+
+    return true;
+}
+
+void UWorldPersistenceSystem::CancelWorldCatchUp()
+{
+    bCatchUpCancelRequested = true;
+}
+
+float UWorldPersistenceSystem::GetWorldCatchUpProgress() const
+{
+    return (CatchUpTotalCycles > 0) ? static_cast<float>(CatchUpCompletedCycles) / CatchUpTotalCycles : 0.0f;
+}
+
+void UWorldPersistenceSystem::Tick(float DeltaTime)
+{
+    if (!bCatchUpInProgress)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    while (CatchUpCompletedCycles < CatchUpTotalCycles && !bCatchUpCancelRequested)
+    {
+        const int32 CyclesInStep = FMath::Min(CatchUpCyclesPerStep, CatchUpTotalCycles - CatchUpCompletedCycles);
+        AdvanceCatchUpStep(CyclesInStep);
+        CatchUpCompletedCycles += CyclesInStep;
+
+        if (FPlatformTime::Seconds() - StartTime >= CatchUpFrameBudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    // Listeners may cancel from the progress callback
+    OnWorldCatchUpProgress.Broadcast(GetWorldCatchUpProgress());
+
+    if (bCatchUpCancelRequested)
+    {
+        FinishWorldCatchUp(true);
+    }
+    else if (CatchUpCompletedCycles >= CatchUpTotalCycles)
+    {
+        FinishWorldCatchUp(false);
+    }
+}
+
+void UWorldPersistenceSystem::AdvanceCatchUpStep(int32 CyclesInStep)
+{
+    static const FName BanditRaidEvent(TEXT("BanditRaid"));
+    static const FName GuardPatrolsEvent(TEXT("GuardPatrols"));
+
+    ParallelFor(CatchUpRegions.Num(), [this, CyclesInStep](int32 Index)
+    {
+        FRegionCatchUpState& State = CatchUpRegions[Index];
+
+        // Expected change per cycle from UpdateRegion (-0.005 * impact) and SimulateNPCActions
+        // (+0.01 with p = heat * 0.1, otherwise -0.005) is linear in heat: A + B * heat.
+        // K cycles of h' = (1 + B) h + A solve to h_K = (h_0 + A / B)(1 + B)^K - A / B.
+        // The fixed point lies above the clamp range, so clamping once at the end is equivalent.
+        const float A = -0.005f * (1.0f + State.PlayerImpact);
+        const float B = 0.0015f;
+        const float StartHeat = State.CrimeHeatLevel;
+        float Heat = (StartHeat + A / B) * FMath::Pow(1.0f + B, static_cast<float>(CyclesInStep)) - A / B;
+
+        // Event count for the step, using a normal approximation of Binomial(K, p)
+        const float Mean = CyclesInStep * EventChancePerCycle;
+        const float StdDev = FMath::Sqrt(Mean * (1.0f - EventChancePerCycle));
+        const int32 NumEvents = FMath::Clamp(
+            FMath::RoundToInt(Mean + StdDev * SampleStandardNormal(State.RandomStream)), 0, CyclesInStep * 2);
+
+        TArray<FName> PossibleEvents;
+        GetCandidateEventTypes(StartHeat, PossibleEvents);
+
+        for (int32 i = 0; i < NumEvents; ++i)
+        {
+            const FName EventType = PossibleEvents[State.RandomStream.RandRange(0, PossibleEvents.Num() - 1)];
+            if (EventType == BanditRaidEvent)
+            {
+                Heat += 0.1f;
+            }
+            else if (EventType == GuardPatrolsEvent)
+            {
+                Heat -= 0.1f;
+            }
+
+            if (State.RecentEventTypes.Num() < MaxRegionEvents)
+            {
+                State.RecentEventTypes.Add(EventType);
+            }
+            else
+            {
+                State.RecentEventTypes[State.TotalEvents % MaxRegionEvents] = EventType;
+            }
+            ++State.TotalEvents;
+        }
+
+        State.CrimeHeatLevel = FMath::Clamp(Heat, 0.05f, 0.95f);
+    });
+}
+
+void UWorldPersistenceSystem::FinishWorldCatchUp(bool bWasCancelled)
+{
+    for (const FRegionCatchUpState& State : CatchUpRegions)
+    {
+        FRegionState* Region = RegionStates.Find(State.RegionID);
+        if (!Region)
+        {
+            continue;
+        }
+
+        Region->CrimeHeatLevel = State.CrimeHeatLevel;
+
+        // Only the events a region would still be holding are materialized, oldest first
+        const int32 NumRetained = State.RecentEventTypes.Num();
+        const int32 FirstIndex = (State.TotalEvents > NumRetained) ? (State.TotalEvents % NumRetained) : 0;
+        for (int32 i = 0; i < NumRetained; ++i)
+        {
+            const FName EventType = State.RecentEventTypes[(FirstIndex + i) % NumRetained];
+
+            TMap<FString, FString> Parameters;
+            Parameters.Add("RegionName", State.RegionID.ToString());
+            Parameters.Add("CrimeHeat", FString::Printf(TEXT("%.2f"), Region->CrimeHeatLevel));
+            RecordRegionEvent(State.RegionID, EventType, GenerateEventDescription(EventType, State.RegionID, Parameters));
+        }
+
+        OnWorldStateChanged.Broadcast(State.RegionID, *Region);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("WorldPersistenceSystem: Catch-up %s after %d of %d update cycles"),
+        bWasCancelled ? TEXT("cancelled") : TEXT("completed"), CatchUpCompletedCycles, CatchUpTotalCycles);
+
+    CatchUpRegions.Empty();
+    bCatchUpInProgress = false;
+    bCatchUpCancelRequested = false;
+
+    // Save state after simulation
+    SaveWorldState();
+
+    OnWorldCatchUpFinished.Broadcast(bWasCancelled);
+}
+
 TArray<FString> UWorldPersistenceSystem::GetRecentRegionalEvents(FName RegionID, int32 Count) const
 {
     TArray<FString> Events;
@@ -269,21 +514,90 @@ TArray<FString> UWorldPersistenceSystem::GetRecentRegionalEvents(FName RegionID,
 
 float UWorldPersistenceSystem::GetPlayerRegionalImpact(FName RegionID) const
 {
-    float TotalImpact = 0.0f;
-    int32 ActionCount = 0;
-    
-    // Calculate impact based on player actions in this region
-    for (const FWorldAction& Action : PlayerActions)
+    // Return average impact, or 0 if no actions
+    const FRegionImpactAggregate* Aggregate = RegionImpact.Find(RegionID);
+    return (Aggregate && Aggregate->ActionCount > 0) ? (Aggregate->TotalMagnitude / Aggregate->ActionCount) : 0.0f;
+}
+
+float UWorldPersistenceSystem::GetRecentPlayerRegionalImpact(FName RegionID) const
+{
+    const FRegionImpactAggregate* Aggregate = RegionImpact.Find(RegionID);
+    if (!Aggregate)
     {
-        if (Action.RegionID == RegionID)
+        return 0.0f;
+    }
+
+    return Aggregate->DecayedImpact * GetImpactDecayFactor(GetCurrentGameMinute() - Aggregate->LastDecayMinute);
+}
+
+int32 UWorldPersistenceSystem::GetPlayerActionCount(FName RegionID) const
+{
+    const FRegionImpactAggregate* Aggregate = RegionImpact.Find(RegionID);
+    return Aggregate ? Aggregate->ActionCount : 0;
+}
+
+void UWorldPersistenceSystem::AddPlayerAction(const FWorldAction& Action)
+{
+    if (PlayerActions.Num() >= MaxStoredActions)
+    {
+        EvictOldestPlayerAction();
+    }
+
+    PlayerActions.Add(Action);
+
+    // Keep the pending range contiguous at the back of the buffer
+    if (!Action.bProcessed || NumPendingPlayerActions > 0)
+    {
+        ++NumPendingPlayerActions;
+    }
+
+    const int32 Now = GetCurrentGameMinute();
+    FRegionImpactAggregate& Aggregate = RegionImpact.FindOrAdd(Action.RegionID);
+    Aggregate.ActionCount++;
+    Aggregate.TotalMagnitude += Action.Magnitude;
+    Aggregate.DecayedImpact = Aggregate.DecayedImpact * GetImpactDecayFactor(Now - Aggregate.LastDecayMinute)
+        + Action.Magnitude * GetImpactDecayFactor(Now - Action.Timestamp.GetTotalMinutes());
+    Aggregate.LastDecayMinute = Now;
+}
+
+void UWorldPersistenceSystem::EvictOldestPlayerAction()
+{
+    if (PlayerActions.IsEmpty())
+    {
+        return;
+    }
+
+    const FWorldAction& Oldest = PlayerActions.First();
+
+    // Never drop an action without applying it
+    if (!Oldest.bProcessed)
+    {
+        ApplyActionEffects(Oldest);
+    }
+
+    if (FRegionImpactAggregate* Aggregate = RegionImpact.Find(Oldest.RegionID))
+    {
+        const int32 Now = GetCurrentGameMinute();
+        Aggregate->ActionCount--;
+        Aggregate->TotalMagnitude -= Oldest.Magnitude;
+        Aggregate->DecayedImpact = FMath::Max(0.0f,
+            Aggregate->DecayedImpact * GetImpactDecayFactor(Now - Aggregate->LastDecayMinute)
+            - Oldest.Magnitude * GetImpactDecayFactor(Now - Oldest.Timestamp.GetTotalMinutes()));
+        Aggregate->LastDecayMinute = Now;
+
+        if (Aggregate->ActionCount <= 0)
         {
-            TotalImpact += Action.Magnitude;
-            ActionCount++;
+            RegionImpact.Remove(Oldest.RegionID);
         }
     }
-    
-    // Return average impact, or 0 if no actions
-    return (ActionCount > 0) ? (TotalImpact / ActionCount) : 0.0f;
+
+    NumPendingPlayerActions = FMath::Min(NumPendingPlayerActions, PlayerActions.Num() - 1);
+    PlayerActions.PopFront();
+}
+
+int32 UWorldPersistenceSystem::GetCurrentGameMinute() const
+{
+    return TimeSystem ? TimeSystem->GetCurrentDateTime().GetTotalMinutes() : 0;
 }
 
 bool UWorldPersistenceSystem::SaveWorldState()
@@ -314,6 +628,10 @@ bool UWorldPersistenceSystem::SaveWorldState()
     }
     // Create a JSON object to store all data
     TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+
+    // The next load catches up on the time since this save
+    LastSavedUtc = FDateTime::UtcNow();
+    RootObject->SetStringField(TEXT("SavedAtUtc"), LastSavedUtc.ToIso8601());
     
     // Save region states
     TArray<TSharedPtr<FJsonValue>> RegionsArray;
@@ -465,9 +783,19 @@ bool UWorldPersistenceSystem::LoadWorldState()
         return false;
     }
     
+    // Saves from before catch-up support have no timestamp and are not caught up
+    FString SavedAtUtc;
+    LastSavedUtc = FDateTime(0);
+    if (RootObject->TryGetStringField(TEXT("SavedAtUtc"), SavedAtUtc))
+    {
+        FDateTime::ParseIso8601(*SavedAtUtc, LastSavedUtc);
+    }
+
     // Clear existing data
     RegionStates.Empty();
     PlayerActions.Empty();
+    RegionImpact.Empty();
+    NumPendingPlayerActions = 0;
     
     // Load region states
     const TArray<TSharedPtr<FJsonValue>>* RegionsArray;
@@ -517,6 +845,9 @@ bool UWorldPersistenceSystem::LoadWorldState()
     const TArray<TSharedPtr<FJsonValue>>* ActionsArray;
     if (RootObject->TryGetArrayField(TEXT("PlayerActions"), ActionsArray))
     {
+        TArray<FWorldAction> LoadedActions;
+        LoadedActions.Reserve(ActionsArray->Num());
+
         for (const TSharedPtr<FJsonValue>& ActionValue : *ActionsArray)
         {
             const TSharedPtr<FJsonObject>* ActionObject;
@@ -581,9 +912,20 @@ bool UWorldPersistenceSystem::LoadWorldState()
                     FGuid::Parse(ActionIDStr, Action.ActionID);
                 }
                 
-                PlayerActions.Add(Action);
+                LoadedActions.Add(Action);
             }
         }
+
+        // Older saves are not guaranteed to be in time order
+        LoadedActions.StableSort([](const FWorldAction& A, const FWorldAction& B)
+        {
+            return A.Timestamp.GetTotalMinutes() < B.Timestamp.GetTotalMinutes();
+        });
+
+        for (const FWorldAction& Action : LoadedActions)
+        {
+            AddPlayerAction(Action);
+        }
     }
     
     // Release the load lock
@@ -614,46 +956,19 @@ bool UWorldPersistenceSystem::LoadWorldState()
 
 void UWorldPersistenceSystem::ProcessPlayerActions()
 {
-    // Process unprocessed actions
-    for (FWorldAction& Action : PlayerActions)
+    // Only the pending tail of the buffer can hold unprocessed actions; the buffer
+    // itself is bounded in AddPlayerAction, so no sorting or trimming is needed here
+    for (int32 Index = PlayerActions.Num() - NumPendingPlayerActions; Index < PlayerActions.Num(); ++Index)
     {
+        FWorldAction& Action = PlayerActions[Index];
         if (!Action.bProcessed)
         {
             ApplyActionEffects(Action);
             Action.bProcessed = true;
         }
     }
-    
-    // Limit the number of stored actions to prevent memory bloat
-    const int32 MaxStoredActions = 1000;
-    if (PlayerActions.Num() > MaxStoredActions)
-    {
-        // Sort by timestamp (oldest first)
-        PlayerActions.Sort([](const FWorldAction& A, const FWorldAction& B) {
-            // Compare years
-            if (A.Timestamp.Year != B.Timestamp.Year)
-                return A.Timestamp.Year < B.Timestamp.Year;
-            
-            // Compare months
-            if (A.Timestamp.Month != B.Timestamp.Month)
-                return A.Timestamp.Month < B.Timestamp.Month;
-            
-            // Compare days
-            if (A.Timestamp.Day != B.Timestamp.Day)
-                return A.Timestamp.Day < B.Timestamp.Day;
-            
-            // Compare hours
-            if (A.Timestamp.Hour != B.Timestamp.Hour)
-                return A.Timestamp.Hour < B.Timestamp.Hour;
-            
-            // Compare minutes
-            return A.Timestamp.Minute < B.Timestamp.Minute;
-        });
-        
-        // Remove oldest actions
-        const int32 NumToRemove = PlayerActions.Num() - MaxStoredActions;
-        PlayerActions.RemoveAt(0, NumToRemove);
-    }
+
+    NumPendingPlayerActions = 0;
 }
 
 void UWorldPersistenceSystem::UpdateRegion(FName RegionID, float DeltaTime)
@@ -693,24 +1008,7 @@ void UWorldPersistenceSystem::GenerateRandomEvent(FName RegionID)
     
     // Define possible event types based on region state
     TArray<FName> PossibleEvents;
-    
-    // Economic events
-    // Crime events
-    if (Region.CrimeHeatLevel > 0.6f)
-    {
-        PossibleEvents.Add(FName("BanditRaid"));
-        PossibleEvents.Add(FName("CriminalTakeover"));
-    }
-    else if (Region.CrimeHeatLevel < 0.3f)
-    {
-        PossibleEvents.Add(FName("GuardPatrols"));
-        PossibleEvents.Add(FName("CriminalArrest"));
-    }
-    
-    // Always add some generic events
-    PossibleEvents.Add(FName("TravelersArrival"));
-    PossibleEvents.Add(FName("WeatherEvent"));
-    PossibleEvents.Add(FName("LocalCelebration"));
+    GetCandidateEventTypes(Region.CrimeHeatLevel, PossibleEvents);
     
     // Select a random event
     if (PossibleEvents.Num() > 0)
@@ -725,16 +1023,6 @@ void UWorldPersistenceSystem::GenerateRandomEvent(FName RegionID)
         // Generate event description
         FString EventDescription = GenerateEventDescription(EventType, RegionID, Parameters);
 
-        // Add to region's current events
-        Region.CurrentEvents.Add(FName(*EventDescription));
-
-        // Limit the number of stored events
-        const int32 MaxEvents = 20;
-        if (Region.CurrentEvents.Num() > MaxEvents)
-        {
-            Region.CurrentEvents.RemoveAt(0, Region.CurrentEvents.Num() - MaxEvents);
-        }
-
         // Apply event effects
         if (EventType == FName("BanditRaid"))
         {
@@ -748,27 +1036,47 @@ void UWorldPersistenceSystem::GenerateRandomEvent(FName RegionID)
         // Clamp values
         Region.CrimeHeatLevel = FMath::Clamp(Region.CrimeHeatLevel, 0.05f, 0.95f);
         
-        // Notify listeners
-        OnWorldEvent.Broadcast(EventType, RegionID, EventDescription);
-        
-        // Log the event
-        FWorldEventLogEntry LogEntry;
-        LogEntry.EventType = EventType;
-        LogEntry.RegionID = RegionID;
-        LogEntry.Description = EventDescription;
-        LogEntry.Timestamp = (TimeSystem ? TimeSystem->GetCurrentDateTime() : FGameDateTime());
-        GlobalEventLog.Add(LogEntry);
-
-        // Limit log size
-        if (GlobalEventLog.Num() > 1000)
-        {
-            GlobalEventLog.RemoveAt(0, GlobalEventLog.Num() - 1000);
-        }
+        RecordRegionEvent(RegionID, EventType, EventDescription);
 
         UE_LOG(LogTemp, Log, TEXT("Generated random event in %s: %s"), *RegionID.ToString(), *EventDescription);
     }
 }
 
+void UWorldPersistenceSystem::RecordRegionEvent(FName RegionID, FName EventType, const FString& EventDescription)
+{
+    FRegionState* Region = RegionStates.Find(RegionID);
+    if (!Region)
+    {
+        return;
+    }
+
+    // Add to region's current events
+    Region->CurrentEvents.Add(FName(*EventDescription));
+
+    // Limit the number of stored events
+    if (Region->CurrentEvents.Num() > MaxRegionEvents)
+    {
+        Region->CurrentEvents.RemoveAt(0, Region->CurrentEvents.Num() - MaxRegionEvents);
+    }
+
+    // Notify listeners
+    OnWorldEvent.Broadcast(EventType, RegionID, EventDescription);
+    
+    // Log the event
+    FWorldEventLogEntry LogEntry;
+    LogEntry.EventType = EventType;
+    LogEntry.RegionID = RegionID;
+    LogEntry.Description = EventDescription;
+    LogEntry.Timestamp = (TimeSystem ? TimeSystem->GetCurrentDateTime() : FGameDateTime());
+    GlobalEventLog.Add(LogEntry);
+
+    // Limit log size
+    if (GlobalEventLog.Num() > 1000)
+    {
+        GlobalEventLog.RemoveAt(0, GlobalEventLog.Num() - 1000);
+    }
+}
+
 void UWorldPersistenceSystem::ApplyActionEffects(const FWorldAction& Action)
 {
     if (!RegionStates.Contains(Action.RegionID))
@@ -2,15 +2,20 @@
 
 #include "Survival/DiseaseSystem.h"
 #include "Components/StatlineComponent.h"
+#include "Components/DiseaseManagementComponent.h"
+#include "GameFramework/Actor.h"
 
 UDiseaseSystem::UDiseaseSystem()
 	: TimeSinceLastUpdate(0.0f)
+	, TimeSinceContagionPass(0.0f)
 {
 }
 
 void UDiseaseSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	
+	ContagionRandomStream.GenerateNewSeed();
 }
 
 void UDiseaseSystem::Deinitialize()
@@ -21,6 +26,36 @@ void UDiseaseSystem::Deinitialize()
 	Diseases.Empty();
 	CharacterDiseases.Empty();
 	RegionalOutbreaks.Empty();
+	ContagionHosts.Empty();
+}
+
+void UDiseaseSystem::Tick(float DeltaTime)
+{
+	TimeSinceContagionPass += DeltaTime;
+	
+	if (TimeSinceContagionPass >= CONTAGION_INTERVAL)
+	{
+		CheckDiseaseTransmission(TimeSinceContagionPass);
+		TimeSinceContagionPass = 0.0f;
+	}
+}
+
+void UDiseaseSystem::RegisterContagionHost(UDiseaseManagementComponent* Host)
+{
+	if (Host)
+	{
+		ContagionHosts.AddUnique(Host);
+	}
+}
+
+void UDiseaseSystem::UnregisterContagionHost(UDiseaseManagementComponent* Host)
+{
+	ContagionHosts.Remove(Host);
+}
+
+void UDiseaseSystem::SetContagionSeed(int32 Seed)
+{
+	ContagionRandomStream.Initialize(Seed);
 }
 
 void UDiseaseSystem::UpdateDiseases(float DeltaTime)
@@ -50,8 +85,7 @@ void UDiseaseSystem::UpdateDiseases(float DeltaTime)
 			}
 		}
 		
-		// Check for disease transmission between characters
-		CheckDiseaseTransmission(TimeSinceLastUpdate);
+		// Transmission between characters runs from Tick on its own, shorter interval
 		
 		// Update regional outbreaks
 		UpdateRegionalOutbreaks(TimeSinceLastUpdate);
@@ -447,17 +481,155 @@ void UDiseaseSystem::ApplyDiseaseEffects(AActor* Character, const FDiseaseData&
 
 void UDiseaseSystem::CheckDiseaseTransmission(float DeltaTime)
 {
-	// This would be a complex system that checks for disease transmission between characters
-	// based on proximity, interactions, and transmission types
+	struct FContagionHost
+	{
+		UDiseaseManagementComponent* Component;
+		FVector Location;
+	};
+	
+	struct FContagionSource
+	{
+		int32 HostIndex;
+		FName DiseaseID;
+		float RadiusSquared;
+		float Chance;
+	};
+	
+	TArray<FContagionHost> Hosts;
+	TArray<FContagionSource> Sources;
+	Hosts.Reserve(ContagionHosts.Num());
+	float CellSize = 0.0f;
+	
+	for (int32 i = ContagionHosts.Num() - 1; i >= 0; --i)
+	{
+		if (!ContagionHosts[i].IsValid())
+		{
+			ContagionHosts.RemoveAt(i);
+		}
+	}
+	
+	for (const TWeakObjectPtr<UDiseaseManagementComponent>& HostPtr : ContagionHosts)
+	{
+		UDiseaseManagementComponent* Host = HostPtr.Get();
+		AActor* Owner = Host->GetOwner();
+		
+		// Infections replicate from the server; clients never roll
+		if (!Owner || !Owner->HasAuthority())
+		{
+			continue;
+		}
+		
+		const int32 HostIndex = Hosts.Add({ Host, Owner->GetActorLocation() });
+		
+		for (const FActiveDiseaseInstance& Disease : Host->GetActiveDiseases())
+		{
+			if (!Disease.bIsActive || !Disease.bIsContagious)
+			{
+				continue;
+			}
+			
+			const FDiseaseData* DiseaseData = Disease.DiseaseData;
+			if (!DiseaseData || DiseaseData->TransmissionRadius <= 0.0f)
+			{
+				continue;
+			}
+			
+			float Rate = DiseaseData->BaseTransmissionRate;
+			if (!Disease.bIsIncubating && DiseaseData->Stages.IsValidIndex(Disease.CurrentStage))
+			{
+				Rate *= DiseaseData->Stages[Disease.CurrentStage].TransmissionRateModifier;
+			}
+			
+			// BaseTransmissionRate is a chance per second of exposure; convert it to a chance for this pass
+			const float Chance = 1.0f - FMath::Pow(1.0f - FMath::Clamp(Rate, 0.0f, 1.0f), DeltaTime);
+			if (Chance <= 0.0f)
+			{
+				continue;
+			}
+			
+			Sources.Add({ HostIndex, Disease.DiseaseID, FMath::Square(DiseaseData->TransmissionRadius), Chance });
+			CellSize = FMath::Max(CellSize, DiseaseData->TransmissionRadius);
+		}
+	}
+	
+	if (Sources.Num() == 0)
+	{
+		return;
+	}
 	
-	// For now, this is just a placeholder
+	// Cells are as wide as the largest radius, so every host in range of a source lies in the 3x3x3 block around it
+	const float InvCellSize = 1.0f / CellSize;
+	auto GetCell = [InvCellSize](const FVector& Location)
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Location.X * InvCellSize),
+			FMath::FloorToInt32(Location.Y * InvCellSize),
+			FMath::FloorToInt32(Location.Z * InvCellSize));
+	};
 	
-	// Get all characters with diseases
-	TArray<TWeakObjectPtr<AActor>> InfectedCharacters;
-	CharacterDiseases.GetKeys(InfectedCharacters);
+	TMap<FIntVector, TArray<int32>> Grid;
+	Grid.Reserve(Hosts.Num());
+	for (int32 HostIndex = 0; HostIndex < Hosts.Num(); ++HostIndex)
+	{
+		Grid.FindOrAdd(GetCell(Hosts[HostIndex].Location)).Add(HostIndex);
+	}
+	
+	// Set of (host, disease) so a host reached by several carriers is only infected once
+	TSet<TPair<UDiseaseManagementComponent*, FName>> PendingInfections;
 	
-	// For each infected character, check for potential transmission to nearby characters
-	// This would integrate with a spatial query system or similar
+	for (const FContagionSource& Source : Sources)
+	{
+		const FContagionHost& Carrier = Hosts[Source.HostIndex];
+		const FIntVector CarrierCell = GetCell(Carrier.Location);
+		
+		for (int32 Z = -1; Z <= 1; ++Z)
+		{
+			for (int32 Y = -1; Y <= 1; ++Y)
+			{
+				for (int32 X = -1; X <= 1; ++X)
+				{
+					const TArray<int32>* CellHosts = Grid.Find(CarrierCell + FIntVector(X, Y, Z));
+					if (!CellHosts)
+					{
+						continue;
+					}
+					
+					for (const int32 TargetIndex : *CellHosts)
+					{
+						if (TargetIndex == Source.HostIndex)
+						{
+							continue;
+						}
+						
+						const FContagionHost& Target = Hosts[TargetIndex];
+						if (FVector::DistSquared(Carrier.Location, Target.Location) > Source.RadiusSquared)
+						{
+							continue;
+						}
+						
+						const TPair<UDiseaseManagementComponent*, FName> Infection(Target.Component, Source.DiseaseID);
+						if (PendingInfections.Contains(Infection)
+							|| Target.Component->IsInfectedWith(Source.DiseaseID)
+							|| Target.Component->HasImmunity(Source.DiseaseID))
+						{
+							continue;
+						}
+						
+						if (ContagionRandomStream.FRand() < Source.Chance)
+						{
+							PendingInfections.Add(Infection);
+						}
+					}
+				}
+			}
+		}
+	}
+	
+	// Apply after the pass so hosts infected this round don't become carriers until the next one
+	for (const TPair<UDiseaseManagementComponent*, FName>& Infection : PendingInfections)
+	{
+		Infection.Key->Infect(Infection.Value);
+	}
 }
 
 void UDiseaseSystem::UpdateRegionalOutbreaks(float DeltaTime)
@@ -2,6 +2,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/DATickElision.h"
 
 #include "AICombatBehaviorComponent.generated.h"
 
@@ -43,12 +44,16 @@ public:
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Called every frame
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+    // Idle NPCs only scan for threats a couple of times a second
+    FDATickElision TickElision;
+
     void HandleCombatState(float DeltaTime);
     void HandleIdleState(float DeltaTime);
     void HandlePatrolState(float DeltaTime);
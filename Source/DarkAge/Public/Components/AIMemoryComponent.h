@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Core/GlobalEventBus.h"
+#include "Core/DATimerWheelSubsystem.h"
 #include "AIMemoryComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -32,6 +33,7 @@ struct FAIMemory
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI Memory")
     float EmotionalImpact = 0.0f; // Positive or negative value
    
+    // Strength at StrengthTime when stored; copies returned by queries hold the decayed current strength
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI Memory")
     float MemoryStrength = 0.0f;
    
@@ -40,6 +42,9 @@ struct FAIMemory
    
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI Memory")
     EMemoryType MemoryType = EMemoryType::Generic;
+
+    // World time in seconds at which MemoryStrength was last set
+    double StrengthTime = 0.0;
 };
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
@@ -63,8 +68,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Memory")
     void UpdateMemoryStrength(const FString& MemoryId, float StrengthChange);
 
+    // All memories that are still remembered, with their current strength
+    UFUNCTION(BlueprintPure, Category = "AI Memory")
+    TArray<FAIMemory> GetMemories() const;
+
     UFUNCTION(BlueprintPure, Category = "AI Memory")
-    const TArray<FAIMemory>& GetMemories() const;
+    float GetMemoryStrength(const FString& MemoryId) const;
         
     // Query memories by type
     UFUNCTION(BlueprintPure, Category = "AI Memory")
@@ -134,18 +143,39 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
     // Handle global events
     UFUNCTION(BlueprintImplementableEvent, Category = "Global Events")
     void OnGlobalEventReceived(const FGlobalEvent& Event);
 
 private:
+    // Strength lost per second; decay is evaluated when a memory is read rather than every frame
+    UPROPERTY(EditAnywhere, Category = "AI Memory")
+    float MemoryDecayRate;
+
+    // Seconds between sweeps that drop forgotten memories
+    UPROPERTY(EditAnywhere, Category = "AI Memory", meta = (ClampMin = "1.0"))
+    float PruneInterval = 15.0f;
+
     UPROPERTY()
     TArray<FAIMemory> Memories;
 
-    UPROPERTY(EditAnywhere, Category = "AI Memory")
-    float MemoryDecayRate;
+    // Index into Memories by MemoryId, and the indices of each memory type; rebuilt when memories are pruned
+    TMap<FString, int32> MemoryIndexById;
+    TMap<EMemoryType, TArray<int32>> MemoryIndicesByType;
+
+    FDATimerHandle PruneTimer;
+
+    double GetMemoryTime() const;
+    float GetCurrentStrength(const FAIMemory& Memory, double Now) const;
+
+    // Copy of a memory with its strength evaluated at Now
+    FAIMemory MakeMemorySnapshot(const FAIMemory& Memory, double Now) const;
+
+    const FAIMemory* FindMemory(const FString& MemoryId) const;
+
+    // Drop memories whose strength has decayed to zero and rebuild the indices
+    void PruneForgottenMemories();
+    void RebuildMemoryIndices();
     
     // References to other subsystems
     UPROPERTY()
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Data/ClimateData.h"
+#include "Core/DATickElision.h"
 #include "ClimateAdaptationComponent.generated.h"
 
 USTRUCT(BlueprintType)
@@ -27,6 +28,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -68,6 +70,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Climate Adaptation")
     EClimateType GetCurrentClimate() const { return CurrentClimate; }
 
+    UFUNCTION(BlueprintCallable, Category = "Climate Adaptation")
+    void SetCurrentClimate(EClimateType NewClimate);
+
     // Replication
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+    // Idle once fully adapted to the current climate; a climate change wakes it
+    FDATickElision TickElision;
 };
\ No newline at end of file
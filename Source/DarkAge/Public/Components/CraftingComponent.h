@@ -9,12 +9,16 @@
 class UInventoryComponent;
 class UDAGameInstance;
 class UPlayerSkillsComponent;
+class UCraftingRecipeDatabase;
 struct FItemData;
 struct FCraftingRecipe;
 
 // Optional: Delegate for UI updates or other systems to react to successful crafting
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRecipeCraftedSuccessfully, FName, RecipeID);
 
+// Broadcast when inventory or skill changes make recipes craftable or uncraftable
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftableRecipesChanged);
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class DARKAGE_API UCraftingComponent : public UActorComponent
 {
@@ -25,6 +29,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // Pointer to the player's inventory component
     UPROPERTY()
@@ -42,9 +47,9 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Crafting")
     TSoftObjectPtr<UDataTable> CraftingRecipesDataTablePtr;
 
-    // Loaded version of the crafting recipes Data Table
+    // Shared recipe store; the table above is streamed into it once per game instance
     UPROPERTY()
-    TObjectPtr<UDataTable> LoadedCraftingRecipesDataTable;
+    TObjectPtr<UCraftingRecipeDatabase> RecipeDatabase;
 
 public:
     /**
@@ -67,11 +72,49 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Crafting")
     bool CraftItem(FName RecipeID);
 
+    /**
+     * Recipes the owner can craft right now. Kept up to date as the inventory and skills
+     * change, so this does not re-evaluate any recipe.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Crafting")
+    TArray<FName> GetCraftableRecipes() const;
+
     // Optional: Delegate to broadcast when a recipe is successfully crafted
     UPROPERTY(BlueprintAssignable, Category = "Crafting")
     FOnRecipeCraftedSuccessfully OnRecipeCrafted;
 
+    UPROPERTY(BlueprintAssignable, Category = "Crafting")
+    FOnCraftableRecipesChanged OnCraftableRecipesChanged;
+
 private:
-    // Helper function to get recipe data
-    bool GetRecipeData(FName RecipeID, FCraftingRecipe& OutRecipeData) const;
+    // Helper function to get recipe data; the row stays owned by the recipe database
+    const FCraftingRecipe* GetRecipeData(FName RecipeID) const;
+
+    // Skill and ingredient checks for one recipe
+    bool MeetsRecipeRequirements(int32 RecipeIndex) const;
+
+    UFUNCTION()
+    void HandleRecipesLoaded();
+
+    UFUNCTION()
+    void HandleInventoryUpdated();
+
+    UFUNCTION()
+    void HandleSkillLeveledUp(FName SkillID, int32 NewLevel, int32 OldLevel);
+
+    // Re-evaluate the recipes set in DirtyRecipes and clear them; broadcasts if anything changed
+    void RefreshDirtyRecipes();
+    void RefreshAllRecipes();
+    void GatherIngredientQuantities(TMap<FName, int32>& OutQuantities) const;
+
+    // True once the bit arrays have been sized for the loaded database
+    bool HasRecipeState() const;
+
+    // One bit per recipe database index
+    TBitArray<> CraftableRecipes;
+    TBitArray<> DirtyRecipes;
+
+    // Largest stack of every recipe ingredient, as of the last inventory update
+    TMap<FName, int32> IngredientQuantities;
+    TMap<FName, int32> ScratchQuantities;
 };
\ No newline at end of file
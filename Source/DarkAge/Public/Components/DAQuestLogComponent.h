@@ -81,7 +81,8 @@ public:
     UFUNCTION(BlueprintPure, Category = "Quest Log")
     TArray<FQuestLogEntry> GetActiveQuests() const;
 
-    // Sets the entire quest log, used for loading from a save game.
+    // Sets the entire quest log, used for loading from a save game. Broadcasts the state of every
+    // quest in the new log, and QS_NotStarted for quests that are no longer in it.
     UFUNCTION(BlueprintCallable, Category = "Quest Log")
     void SetQuestLog(const TArray<FQuestLogEntry>& InQuestLog);
 
@@ -98,7 +99,9 @@ protected:
 
     // RepNotify for QuestLog
     UFUNCTION()
-    void OnRep_QuestLog();
+    void OnRep_QuestLog(const TArray<FQuestLogEntry>& OldQuestLog);
+
+    void BroadcastQuestLogReplaced(const TArray<FQuestLogEntry>& OldQuestLog);
 
 public:
     // Server RPCs for quest log actions
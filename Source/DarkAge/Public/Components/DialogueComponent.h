@@ -2,64 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Data/DialogueData.h"
+#include "Core/DialogueTreeRegistry.h"
 #include "DialogueComponent.generated.h"
 
-UENUM(BlueprintType)
-enum class EDialogueMood : uint8
-{
-    Neutral     UMETA(DisplayName = "Neutral"),
-    Friendly    UMETA(DisplayName = "Friendly"),
-    Angry       UMETA(DisplayName = "Angry"),
-    Suspicious  UMETA(DisplayName = "Suspicious"),
-    Fearful     UMETA(DisplayName = "Fearful"),
-    Excited     UMETA(DisplayName = "Excited")
-};
-
-USTRUCT(BlueprintType)
-struct FDialogueLine
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    FString SpeakerName;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    FString Text;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    EDialogueMood Mood;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    TArray<FString> Responses;
-
-    FDialogueLine()
-    {
-        SpeakerName = TEXT("");
-        Text = TEXT("");
-        Mood = EDialogueMood::Neutral;
-    }
-};
-
-USTRUCT(BlueprintType)
-struct FDialogueTree
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    FString TreeID;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    TArray<FDialogueLine> Lines;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
-    TMap<FString, FString> Conditions; // Key: Condition, Value: NextTreeID
-
-    FDialogueTree()
-    {
-        TreeID = TEXT("");
-    }
-};
-
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class DARKAGE_API UDialogueComponent : public UActorComponent
 {
@@ -136,22 +82,36 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dialogue")
     int32 CurrentLineIndex;
 
-    // Dialogue trees
+    // Trees authored on this NPC; compiled into the shared registry at BeginPlay and then released
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
     TMap<FString, FDialogueTree> DialogueTrees;
 
+    // This NPC's own trees by ID; anything else is looked up in the registry's shared trees
+    TMap<FName, FDialogueTreeHandle> LocalTrees;
+
+    // Tree the cursor (CurrentLineIndex) is in
+    FDialogueTreeHandle CurrentTree;
+
+    // Partner state for branch conditions, bound when the dialogue starts
+    FDAConditionContext PartnerConditions;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
     FString DefaultTreeID;
 
     // Dialogue functions
     void SetCurrentLine(const FDialogueLine& Line);
-    FDialogueTree* GetCurrentTree();
-    bool CheckConditions(const TMap<FString, FString>& Conditions) const;
-    FString GetNextTreeID(const TMap<FString, FString>& Conditions) const;
-    void InitializeDefaultTrees();
+    bool EnterTree(const FString& TreeID);
+    void ShowCurrentTreeLine();
+    FDialogueTreeHandle FindTree(FName TreeID) const;
+    UDialogueTreeRegistry* GetRegistry() const;
+    FName GetNextTreeID(TConstArrayView<FDialogueBranch> Branches) const;
+    void RegisterAuthoredTrees();
+
+    // Fill Line in place so the live line's storage is reused
+    void BuildGreeting(AActor* Speaker, FDialogueLine& Line) const;
 
     // Personality-based dialogue
-    FString GetPersonalityGreeting() const;
+    const FString& GetPersonalityGreeting() const;
     FString GetPersonalityResponse(EDialogueMood Mood) const;
     EDialogueMood GetPersonalityMood() const;
 };
\ No newline at end of file
@@ -20,7 +20,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	UFUNCTION(BlueprintCallable, Category = "Disease")
@@ -42,13 +42,24 @@ public:
 	int32 GetCurrentStage(FName DiseaseID) const;
 
 
-	void UpdateDiseaseProgression(FActiveDiseaseInstance& Disease, float DeltaTime);
 	void ApplyDiseaseEffects(const FDiseaseData* DiseaseData, FActiveDiseaseInstance& ActiveDisease);
 	void RemoveDiseaseEffects(const FDiseaseData* DiseaseData, FActiveDiseaseInstance& ActiveDisease);
 	void AttemptToDetectDisease(FActiveDiseaseInstance& Disease);
-	void TransmitDisease(const FActiveDiseaseInstance& Disease);
 	void AddImmunity(FName DiseaseID, float Duration, bool bIsPermanent);
 
+	// Timer wheel callbacks: end of incubation or of the current stage, and repeated detection rolls
+	void HandleStageTimer(FDATimerHandle Timer);
+	void HandleDetectionTimer(FDATimerHandle Timer);
+
+	// Schedule the transition out of the current stage and start or stop detection rolls
+	void EnterStage(FActiveDiseaseInstance& Disease);
+	void UpdateDetection(FActiveDiseaseInstance& Disease);
+	void RemoveDiseaseAt(int32 Index);
+	UDATimerWheelSubsystem* GetTimerWheel() const;
+
+	// Seconds between detection rolls while a detectable disease goes unnoticed
+	static constexpr float DETECTION_INTERVAL = 1.0f;
+
 	// Replicated diseases
 	UPROPERTY(VisibleAnywhere, Category = "Disease", ReplicatedUsing=OnRep_ActiveDiseases)
 	TArray<FActiveDiseaseInstance> ActiveDiseases;
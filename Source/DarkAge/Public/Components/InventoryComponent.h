@@ -71,4 +71,7 @@ public:
 
 	UFUNCTION()
 	void OnRep_Items();
+
+private:
+	void ReportItemCollected(FName ItemID, int32 Quantity) const;
 };
\ No newline at end of file
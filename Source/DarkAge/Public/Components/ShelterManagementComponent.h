@@ -18,8 +18,4 @@ public:
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
-
-public:
-    // Called every frame
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Data/StatusEffectData.h"
+#include "Core/DAStatLayout.h"
 #include "StatlineComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatChanged, FName, StatName, float, NewValue);
@@ -59,9 +60,9 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     UFUNCTION(BlueprintCallable, Category = "Stats")
     void UpdateStat(FName StatName, float Delta);
@@ -78,6 +79,29 @@ public:
     UFUNCTION(BlueprintPure, Category = "Stats")
     float GetStatPercentage(FName StatName) const;
 
+    /**
+     * Index-based access. Indices come from FDAStatLayout and can be cached by callers;
+     * reads and writes are O(1) with no name lookups.
+     */
+    void UpdateStatByIndex(int32 StatIndex, float Delta);
+    float GetCurrentStatValueByIndex(int32 StatIndex) const;
+    float GetBaseStatValueByIndex(int32 StatIndex) const;
+    bool HasStat(int32 StatIndex) const { return FindStatEntry(StatIndex) != nullptr; }
+
+    // Incremented on every stat change on this component
+    uint32 GetStatVersion() const { return StatVersion; }
+
+    // Stat version at which the stat last changed, 0 if it never has
+    uint32 GetStatChangeVersion(int32 StatIndex) const;
+
+    // Layout indices of stats that changed after SinceVersion, for consumers that poll by version
+    void GetStatsChangedSince(uint32 SinceVersion, TArray<int32>& OutStatIndices) const;
+
+    // Layout indices of stats changed since the last call; clears the dirty bits
+    void ConsumeDirtyStats(TArray<int32>& OutStatIndices);
+
+    bool IsStatDirty(int32 StatIndex) const { return DirtyStats.IsValidIndex(StatIndex) && DirtyStats[StatIndex]; }
+
     UFUNCTION(BlueprintCallable, Category = "Status Effects")
     void ApplyStatusEffect(const FDataTableRowHandle& EffectDataRowHandle, UObject* Instigator);
 
@@ -102,10 +126,12 @@ public:
 
 
     void RecalculateStat(FName StatName);
-    void ProcessStatusEffects(float DeltaTime);
 
+    // The stat table is rebuilt lazily when the number of entries changes; call RebuildStatTable after renaming or reordering them
     TArray<FStatEntry>& GetMutableStats() { return Stats; }
 
+    void RebuildStatTable() const;
+
     UPROPERTY(EditAnywhere, Category = "UI")
     TSubclassOf<class UDADamageTextWidget> DamageTextWidgetClass;
 
@@ -165,4 +191,37 @@ public:
 
     UPROPERTY(VisibleAnywhere, Category = "Status Effects")
     TArray<FActiveStatusEffect> ActiveStatusEffects;
+
+private:
+    // Timer wheel callbacks for ActiveStatusEffects
+    void HandleStatusEffectExpired(FDATimerHandle Timer);
+    void HandleStatusEffectTick(FDATimerHandle Timer);
+    void CancelStatusEffectTimers(FActiveStatusEffect& Effect);
+
+    struct FStatSlot
+    {
+        // Position of the stat in Stats, INDEX_NONE if this component doesn't have it
+        int32 Slot = INDEX_NONE;
+        uint32 ChangeVersion = 0;
+        float LastNotifiedValue = 0.0f;
+    };
+
+    void EnsureStatTable() const { if (MappedStatCount != Stats.Num()) { RebuildStatTable(); } }
+    int32 ResolveStatIndex(FName StatName) const;
+
+    FStatEntry* FindStatEntry(int32 StatIndex);
+    const FStatEntry* FindStatEntry(int32 StatIndex) const;
+
+    // Bump the version, set the dirty bit and broadcast OnStatChanged
+    void MarkStatChanged(int32 StatIndex, float NewValue);
+
+    // Tell the global event bus that a non-player owner has died
+    void BroadcastNPCDeath() const;
+
+    // Stat table indexed by FDAStatLayout index; a cache over Stats, so it may be rebuilt from const accessors
+    mutable TArray<FStatSlot> StatSlots;
+    mutable int32 MappedStatCount = INDEX_NONE;
+
+    TBitArray<> DirtyStats;
+    uint32 StatVersion = 0;
 };
\ No newline at end of file
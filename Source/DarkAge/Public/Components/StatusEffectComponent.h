@@ -17,9 +17,9 @@ public:
     UStatusEffectComponent();
 
     //~ Begin UActorComponent Interface
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     //~ End UActorComponent Interface
 
 public:
@@ -35,6 +35,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Status Effects")
     const TArray<FActiveStatusEffect>& GetActiveEffects() const { return ActiveEffects; }
 
+    // Seconds until the effect expires, or -1 if it isn't active or doesn't expire
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    float GetEffectTimeRemaining(FName EffectID) const;
+
     UPROPERTY(BlueprintAssignable, Category = "Status Effects")
     FOnStatusEffectChanged OnStatusEffectAdded;
 
@@ -45,8 +49,13 @@ public:
     FOnStatusEffectTick OnStatusEffectTicked;
 
 private:
-    void HandleEffectTick(FActiveStatusEffect& Effect, float DeltaTime);
+    // Timer wheel callbacks
+    void HandleEffectExpired(FDATimerHandle Timer);
+    void HandleEffectTick(FDATimerHandle Timer);
+
+    void RemoveEffectAt(int32 Index, bool bRevertModifiers = true);
     void ApplyStatModifiers(const FStatusEffectData* EffectData, bool bIsApplying);
+    UDATimerWheelSubsystem* GetTimerWheel() const;
 
     UPROPERTY(VisibleAnywhere, Category = "Status Effects")
     TArray<FActiveStatusEffect> ActiveEffects;
@@ -23,9 +23,6 @@ public:
 
     // Called when the game starts
     virtual void BeginPlay() override;
-    
-    // Called every frame
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     // Record a combat action (attacking, defending, etc.)
     UFUNCTION(BlueprintCallable, Category = "World Interaction")
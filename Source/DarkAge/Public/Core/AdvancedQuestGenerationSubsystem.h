@@ -5,6 +5,7 @@
 #include "Engine/Engine.h"
 #include "Data/QuestData.h"
 #include "Core/DynamicQuestSubsystem.h"
+#include "Core/QuestRuntimeSubsystem.h"
 #include "AdvancedQuestGenerationSubsystem.generated.h"
 
 UENUM(BlueprintType)
@@ -121,8 +122,9 @@ public:
 
     // USubsystem interface
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
 
-    // FTickableGameObject interface
+    // FTickableGameObject interface (quest generation only; active quests are event driven)
     virtual void Tick(float DeltaTime) override;
     virtual bool IsTickable() const override { return true; }
     virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UAdvancedQuestGenerationSubsystem, STATGROUP_Tickables); }
@@ -167,11 +169,11 @@ protected:
     UPROPERTY()
     TMap<FString, FQuestTemplate> QuestTemplates;
 
-    UPROPERTY()
-    TArray<FDynamicQuest> AvailableQuests;
+    // Generated quests waiting to be accepted, oldest first; the quests themselves live in the quest runtime
+    TArray<FQuestRuntimeHandle> AvailableQuests;
 
     UPROPERTY()
-    TArray<FDynamicQuest> ActiveQuests;
+    TObjectPtr<UQuestRuntimeSubsystem> QuestRuntime;
 
     // Quest parameters
     UPROPERTY()
@@ -196,6 +198,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quest Configuration")
     int32 MaxAvailableQuests = 10;
 
+    // Seconds a completed or expired quest stays in the active list before it is dropped
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quest Configuration")
+    float FinishedQuestRetention = 300.0f;
+
     // Internal state
     float QuestGenerationTimer = 0.0f;
     int32 NextQuestID = 1;
@@ -216,10 +222,13 @@ protected:
     // Quest management functions
     FDynamicQuest CreateQuestFromTemplate(const FQuestTemplate& Template);
     void AddQuestToPool(const FDynamicQuest& Quest);
-    void UpdateActiveQuests(float DeltaTime);
-    void UpdateQuestObjectives(FDynamicQuest& Quest);
-    void CompleteQuest(FDynamicQuest& Quest);
-    void CleanupExpiredQuests();
+    void CompleteQuest(FQuestRuntimeHandle Handle);
+
+    // Accepted quests are tracked by the quest runtime, which reports objective completions,
+    // expiry and removal here
+    void HandleRuntimeEvent(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex);
+    FQuestRuntimeHandle FindQuestHandle(int32 QuestID) const;
+    static bool IsAcceptedQuest(const FDynamicQuest& Quest);
 
     // Missing delegate declarations
     UPROPERTY(BlueprintAssignable, Category = "Quest Events")
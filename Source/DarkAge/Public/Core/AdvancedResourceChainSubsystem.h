@@ -363,6 +363,10 @@ public:
     FOnNewRecipeDiscovered OnNewRecipeDiscovered;
 
     // Public Interface Functions
+
+    // Every known recipe, keyed by RecipeID
+    const TMap<FString, FProductionRecipe>& GetProductionRecipes() const { return ProductionRecipes; }
+
     UFUNCTION(BlueprintCallable, Category = "Resource Chain")
     FString StartProduction(const FString& RecipeID, const FString& FacilityID, const FString& WorkerID, int32 Quantity);
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/DataTable.h"
+#include "Data/CraftingData.h"
+#include "CraftingRecipeDatabase.generated.h"
+
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCraftingRecipesLoaded);
+
+/**
+ * Game-wide store for crafting recipes.
+ *
+ * The recipe table is streamed in once per game instance, however many crafters ask for it,
+ * and copied into dense arrays addressed by recipe index. Ingredients are flattened into one
+ * array, and reverse indices map each ingredient and each required skill to the recipes that
+ * use it, so a change to one item or skill only needs those recipes rechecked.
+ */
+UCLASS()
+class DARKAGE_API UCraftingRecipeDatabase : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // Start streaming the table unless it is already loaded or loading. Only one table is used per game instance.
+    void RequestLoad(const TSoftObjectPtr<UDataTable>& RecipeTable);
+
+    // Rebuild every array and index from Table
+    void BuildFromTable(const UDataTable* Table);
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    bool IsLoaded() const { return bLoaded; }
+
+    // True while the table is streaming in; OnRecipesLoaded follows
+    bool IsLoading() const { return LoadHandle.IsValid(); }
+
+    UPROPERTY(BlueprintAssignable, Category = "Crafting")
+    FOnCraftingRecipesLoaded OnRecipesLoaded;
+
+    UFUNCTION(BlueprintPure, Category = "Crafting")
+    int32 GetNumRecipes() const { return Recipes.Num(); }
+
+    // Index of RecipeID, or INDEX_NONE
+    int32 FindRecipe(FName RecipeID) const;
+
+    FName GetRecipeID(int32 RecipeIndex) const { return RecipeIDs[RecipeIndex]; }
+    const FCraftingRecipe& GetRecipe(int32 RecipeIndex) const { return Recipes[RecipeIndex]; }
+    TConstArrayView<FCraftingIngredient> GetIngredients(int32 RecipeIndex) const;
+
+    // Recipes with RequiredSkillID set to SkillID
+    TConstArrayView<int32> GetRecipesForSkill(FName SkillID) const;
+
+    // Recipes that consume ItemID
+    TConstArrayView<int32> GetRecipesUsingIngredient(FName ItemID) const;
+    bool IsIngredient(FName ItemID) const { return RecipesByIngredient.Contains(ItemID); }
+
+private:
+    void OnRecipeTableLoaded();
+
+    struct FRecipeRequirements
+    {
+        int32 FirstIngredient = 0;
+        int32 NumIngredients = 0;
+    };
+
+    TArray<FName> RecipeIDs;
+    TArray<FCraftingRecipe> Recipes;
+    TArray<FRecipeRequirements> Requirements;
+    TArray<FCraftingIngredient> Ingredients;
+
+    TMap<FName, int32> RecipeIndices;
+    TMap<FName, TArray<int32>> RecipesByIngredient;
+    TMap<FName, TArray<int32>> RecipesBySkill;
+
+    TSoftObjectPtr<UDataTable> RequestedTable;
+    TSharedPtr<FStreamableHandle> LoadHandle;
+    bool bLoaded = false;
+};
@@ -0,0 +1,195 @@
+// Copyright (c) 2025 RaioCore
+// Compact binary log records for DarkAge
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+enum class EDALogLevel : uint8;
+enum class EDALogCategory : uint8;
+
+/**
+ * Binary log layout
+ *
+ * File:   Header, then blocks of { uint8 BlockType, uint32 ByteCount, bytes }
+ * Format: uint32 FormatId, int32 Line, Format and Function as uint32 length + UTF-8
+ * Record: uint16 RecordSize, uint32 FormatId, uint64 Cycles, uint8 Level, uint8 Category, args
+ * Arg:    uint8 EArgType tag followed by the raw value; strings are uint16 length + UTF-8
+ */
+namespace DABinaryLog
+{
+    constexpr uint32 FileMagic = 0x424C4144; // "DALB"
+    constexpr uint32 FileVersion = 1;
+
+    constexpr uint8 FormatBlock = 0;
+    constexpr uint8 RecordBlock = 1;
+
+    constexpr int32 RecordHeaderSize = sizeof(uint16) + sizeof(uint32) + sizeof(uint64) + 2 * sizeof(uint8);
+
+    // Longer string arguments are truncated so a record always fits in a thread buffer
+    constexpr int32 MaxStringArgBytes = 1024;
+
+    enum class EArgType : uint8
+    {
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Double,
+        String,
+        Pointer
+    };
+
+    template <typename AllocatorType, typename ValueType>
+    void AppendRaw(TArray<uint8, AllocatorType>& Out, const ValueType& Value)
+    {
+        Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(ValueType));
+    }
+
+    template <typename AllocatorType>
+    void AppendString(TArray<uint8, AllocatorType>& Out, const TCHAR* Value)
+    {
+        FTCHARToUTF8 Converted(Value ? Value : TEXT("(null)"));
+        const uint16 Length = (uint16)FMath::Min(Converted.Length(), MaxStringArgBytes);
+        Out.Add((uint8)EArgType::String);
+        AppendRaw(Out, Length);
+        Out.Append(reinterpret_cast<const uint8*>(Converted.Get()), Length);
+    }
+
+    template <typename AllocatorType>
+    void BeginRecord(TArray<uint8, AllocatorType>& Out, uint32 FormatId, EDALogLevel Level, EDALogCategory Category)
+    {
+        AppendRaw(Out, (uint16)0); // Patched by FinishRecord
+        AppendRaw(Out, FormatId);
+        AppendRaw(Out, FPlatformTime::Cycles64());
+        Out.Add((uint8)Level);
+        Out.Add((uint8)Category);
+    }
+
+    template <typename AllocatorType>
+    bool FinishRecord(TArray<uint8, AllocatorType>& Out)
+    {
+        if (Out.Num() > MAX_uint16)
+        {
+            return false;
+        }
+        const uint16 RecordSize = (uint16)Out.Num();
+        FMemory::Memcpy(Out.GetData(), &RecordSize, sizeof(RecordSize));
+        return true;
+    }
+
+    /**
+     * Encode one printf argument with its type tag. Covers the types DA_LOG call sites pass:
+     * integers, enums, floating point, TCHAR/ANSI strings and pointers.
+     */
+    template <typename AllocatorType, typename ArgType>
+    void EncodeArg(TArray<uint8, AllocatorType>& Out, const ArgType& Value)
+    {
+        using FDecayed = std::decay_t<ArgType>;
+
+        if constexpr (std::is_same_v<FDecayed, TCHAR*> || std::is_same_v<FDecayed, const TCHAR*>)
+        {
+            AppendString(Out, Value);
+        }
+        else if constexpr (std::is_same_v<FDecayed, ANSICHAR*> || std::is_same_v<FDecayed, const ANSICHAR*>)
+        {
+            AppendString(Out, Value ? *FString(Value) : nullptr);
+        }
+        else if constexpr (std::is_enum_v<FDecayed>)
+        {
+            EncodeArg(Out, static_cast<std::underlying_type_t<FDecayed>>(Value));
+        }
+        else if constexpr (std::is_floating_point_v<FDecayed>)
+        {
+            Out.Add((uint8)EArgType::Double);
+            AppendRaw(Out, (double)Value);
+        }
+        else if constexpr (std::is_integral_v<FDecayed> && sizeof(FDecayed) <= sizeof(int32))
+        {
+            if constexpr (std::is_signed_v<FDecayed>)
+            {
+                Out.Add((uint8)EArgType::Int32);
+                AppendRaw(Out, (int32)Value);
+            }
+            else
+            {
+                Out.Add((uint8)EArgType::UInt32);
+                AppendRaw(Out, (uint32)Value);
+            }
+        }
+        else if constexpr (std::is_integral_v<FDecayed>)
+        {
+            if constexpr (std::is_signed_v<FDecayed>)
+            {
+                Out.Add((uint8)EArgType::Int64);
+                AppendRaw(Out, (int64)Value);
+            }
+            else
+            {
+                Out.Add((uint8)EArgType::UInt64);
+                AppendRaw(Out, (uint64)Value);
+            }
+        }
+        else if constexpr (std::is_pointer_v<FDecayed>)
+        {
+            Out.Add((uint8)EArgType::Pointer);
+            AppendRaw(Out, (uint64)(UPTRINT)Value);
+        }
+        else
+        {
+            static_assert(sizeof(ArgType) == 0, "Unsupported argument type for binary logging");
+        }
+    }
+}
+
+/**
+ * A registered log call site
+ */
+struct FDABinaryLogFormat
+{
+    FString Format;
+    FString Function;
+    int32 Line = 0;
+};
+
+/**
+ * Process-wide table of log format strings. Each DA_LOG call site registers once
+ * and from then on records only carry its ID.
+ */
+class DARKAGE_API FDABinaryLogFormatRegistry
+{
+public:
+    static FDABinaryLogFormatRegistry& Get();
+
+    uint32 Register(const TCHAR* Format, const TCHAR* Function, int32 Line);
+
+    bool Find(uint32 FormatId, FDABinaryLogFormat& OutFormat) const;
+
+    int32 Num() const;
+
+    // Copy formats [FirstId, Num()) for writing to a log file
+    void CopyFormats(int32 FirstId, TArray<FDABinaryLogFormat>& OutFormats) const;
+
+private:
+    mutable FCriticalSection RegistryCriticalSection;
+    TArray<FDABinaryLogFormat> Formats;
+};
+
+/**
+ * Turns binary log records back into text. Used offline by UDALogDecodeCommandlet
+ * and at runtime for records that must also reach the console.
+ */
+class DARKAGE_API FDABinaryLogDecoder
+{
+public:
+    /**
+     * Decode a binary log file into the same text format as the regular file log
+     */
+    static bool DecodeFile(const FString& InputPath, const FString& OutputPath, int32& OutRecordCount);
+
+    /**
+     * Substitute encoded arguments into a printf-style format string
+     */
+    static FString FormatMessage(const FString& Format, const uint8* Args, int32 ArgsSize);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/QuestData.h"
+
+class AActor;
+class UInventoryComponent;
+class UStatlineComponent;
+class UDAQuestLogComponent;
+
+/**
+ * Player state a condition program reads from. Bind it once per subject and keep it; the
+ * component lookups happen in Bind, not per evaluation.
+ */
+struct DARKAGE_API FDAConditionContext
+{
+    // Resolves a controller to its pawn; the quest log is looked for on the pawn, then its controller
+    void Bind(const AActor* InSubject);
+    void Reset() { *this = FDAConditionContext(); }
+
+    bool IsBoundTo(const AActor* InSubject) const { return InSubject && Subject.Get() == InSubject; }
+    bool HasSubject() const { return Subject.IsValid(); }
+
+    TWeakObjectPtr<const AActor> Subject;
+    TWeakObjectPtr<const UInventoryComponent> Inventory;
+    TWeakObjectPtr<const UStatlineComponent> Statline;
+    TWeakObjectPtr<const UDAQuestLogComponent> QuestLog;
+};
+
+/**
+ * Authored conditions compiled into flat instruction ranges.
+ *
+ * Each clause is a run of instructions that must all pass. Names are resolved when the
+ * clause is compiled: stats become FDAStatLayout indices and string condition keys become
+ * opcodes. Evaluating a clause does no allocation and no string comparison.
+ */
+class DARKAGE_API FDAConditionProgram
+{
+public:
+    // All conditions must hold; an empty list compiles to a clause that always passes
+    int32 CompileClause(TConstArrayView<FQuestCondition> Conditions);
+
+    // Dialogue branch keys such as "HasQuest" or "FactionReputation"
+    int32 CompileDialogueCondition(const FString& ConditionKey);
+
+    bool Evaluate(int32 ClauseIndex, const FDAConditionContext& Context) const;
+
+    void Reset();
+
+    int32 NumClauses() const { return Clauses.Num(); }
+    int32 NumInstructions() const { return Instructions.Num(); }
+
+private:
+    enum class EOp : uint8
+    {
+        Always,
+        Never, // Unknown condition types
+        ItemCount,
+        StatValue,
+        FactionReputation,
+        QuestCompleted
+    };
+
+    struct FInstruction
+    {
+        EOp Op = EOp::Always;
+        EComparisonOperator Compare = EComparisonOperator::CO_EqualTo;
+        int32 Operand = INDEX_NONE; // Stat layout index for StatValue
+        int32 Value = 0;
+        FName Target;
+    };
+
+    struct FClause
+    {
+        int32 FirstInstruction = 0;
+        int32 NumInstructions = 0;
+    };
+
+    int32 ReadValue(const FInstruction& Instruction, const FDAConditionContext& Context) const;
+    static bool Compare(int32 Lhs, EComparisonOperator Operator, int32 Rhs);
+
+    TArray<FInstruction> Instructions;
+    TArray<FClause> Clauses;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Content-addressed store for procedural generation output.
+ *
+ * Entries are opaque serialized payloads keyed by a 64-bit digest of everything that
+ * determines the output (generator, version, seed and parameters), so a key never needs
+ * invalidating: changing any input changes the key. The store is one append-only file of
+ * [Key][Size][Payload] records, and the in-memory buffer is an exact image of that file.
+ * Opening it is a single read with no per-entry allocation, and Flush only appends the
+ * records added since the last flush.
+ */
+class DARKAGE_API FDAGenerationCache
+{
+public:
+    // Hash of a serialized key; callers write every input that affects the output into KeyBytes
+    static uint64 MakeKey(TConstArrayView<uint8> KeyBytes);
+
+    /**
+     * Load the store at InPath, creating it on the next Flush if it doesn't exist. A store
+     * written by another format version, or larger than InMaxBytes, is discarded. A truncated
+     * final record, e.g. from a crash mid-append, is dropped. The store never grows past
+     * InMaxBytes.
+     */
+    void Open(const FString& InPath, int64 InMaxBytes = MAX_int64);
+
+    // Payload stored under Key, or an empty view. The view is invalidated by Add.
+    TConstArrayView<uint8> Find(uint64 Key) const;
+
+    /**
+     * Store Payload under Key unless Key is already present. If the record would take the
+     * store past its size limit, every entry is dropped and the store starts over; the next
+     * Flush rewrites the file. Returns false if Payload alone is over the limit.
+     */
+    bool Add(uint64 Key, TConstArrayView<uint8> Payload);
+
+    // Append every record added since the last flush to the file
+    bool Flush();
+
+    void Reset();
+
+    int32 Num() const { return Entries.Num(); }
+    int64 GetNumBytes() const { return Image.Num(); }
+    int64 GetNumPendingBytes() const { return Image.Num() - FlushedBytes; }
+
+private:
+    static constexpr uint32 Magic = 0x47504144; // "DAPG"
+    static constexpr uint32 FormatVersion = 1;
+    static constexpr int32 HeaderSize = sizeof(uint32) * 2;
+    static constexpr int32 RecordHeaderSize = sizeof(uint64) + sizeof(int32);
+
+    struct FEntry
+    {
+        int32 Offset = 0; // Payload start in Image
+        int32 Size = 0;
+    };
+
+    void WriteHeader();
+
+    FString Path;
+    int64 MaxBytes = MAX_int64;
+    TArray<uint8> Image;
+    TMap<uint64, FEntry> Entries;
+    int64 FlushedBytes = 0;
+
+    // The file on disk can't be appended to as-is and is rewritten from Image on Flush
+    bool bRewrite = false;
+};
@@ -0,0 +1,24 @@
+// Copyright (c) 2025 RaioCore
+// Offline decoder for DarkAge binary logs
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DALogDecodeCommandlet.generated.h"
+
+/**
+ * Converts a binary .dalog file written by UDALoggingSubsystem into a text log.
+ *
+ * Usage: UnrealEditor-Cmd DarkAge.uproject -run=DALogDecode -Input=<file.dalog> [-Output=<file.log>]
+ */
+UCLASS()
+class DARKAGE_API UDALogDecodeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDALogDecodeCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
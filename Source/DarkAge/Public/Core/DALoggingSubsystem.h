@@ -8,8 +8,15 @@
 #include "Engine/Engine.h"
 #include "HAL/FileManager.h"
 #include "Misc/DateTime.h"
+#include "HAL/Runnable.h"
+#include "Containers/RingBuffer.h"
+#include "Core/DABinaryLog.h"
+#include <atomic>
 #include "DALoggingSubsystem.generated.h"
 
+class FRunnableThread;
+class FEvent;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogDarkAge, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogDarkAgeEconomy, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogDarkAgeNPC, Log, All);
@@ -108,12 +115,47 @@ struct DARKAGE_API FDALogEntry
     {}
 };
 
+/**
+ * Single-producer/single-consumer rings of pending log entries and binary records.
+ * Each logging thread owns one; only the writer drains it, so neither side takes a lock.
+ */
+struct FDALogThreadBuffer
+{
+    static constexpr uint32 Capacity = 1024;
+    static constexpr uint32 BinaryCapacity = 64 * 1024;
+
+    FDALogThreadBuffer();
+
+    // Producer side; returns false if the ring is full
+    bool TryPush(FDALogEntry&& Entry);
+
+    // Consumer side; moves all published entries into OutEntries
+    void Drain(TArray<FDALogEntry>& OutEntries);
+
+    uint32 Num() const;
+
+    // Binary records are copied in as raw bytes and drained straight into the binary file
+    bool TryPushBytes(const uint8* Data, uint32 Size);
+    void DrainBytes(TArray<uint8>& OutBytes);
+
+    TArray<FDALogEntry> Slots;
+    TArray<uint8> BinarySlots;
+
+    // Set when the owning subsystem shuts down so threads drop their cached reference
+    std::atomic<bool> bRetired{false};
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Head{0};
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Tail{0};
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> BinaryHead{0};
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> BinaryTail{0};
+};
+
 /**
  * Centralized logging subsystem for DarkAge
  * Provides structured logging, file output, and performance monitoring
  */
 UCLASS()
-class DARKAGE_API UDALoggingSubsystem : public UGameInstanceSubsystem
+class DARKAGE_API UDALoggingSubsystem : public UGameInstanceSubsystem, public FRunnable
 {
     GENERATED_BODY()
 
@@ -122,6 +164,10 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
+    // FRunnable interface (background writer)
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
     /**
      * Log a message with specified level and category
      */
@@ -133,6 +179,36 @@ public:
      */
     void LogMessageWithSource(EDALogLevel Level, EDALogCategory Category, const FString& Message, const FString& Context = TEXT(""), const FString& Function = TEXT(""), int32 Line = 0);
 
+    /**
+     * Log a pre-registered format with raw arguments to the binary log (used by DA_LOG in binary mode).
+     * Formatting is deferred to FDABinaryLogDecoder; errors wake the writer, which formats them for the console.
+     */
+    template <typename... ArgTypes>
+    void LogBinary(uint32 FormatId, EDALogLevel Level, EDALogCategory Category, const ArgTypes&... Args)
+    {
+        if (Level < FileLogLevel)
+        {
+            return;
+        }
+
+        TArray<uint8, TInlineAllocator<256>> Record;
+        DABinaryLog::BeginRecord(Record, FormatId, Level, Category);
+        (DABinaryLog::EncodeArg(Record, Args), ...);
+        if (DABinaryLog::FinishRecord(Record))
+        {
+            SubmitBinaryRecord(Record.GetData(), Record.Num(), Level, Category);
+        }
+    }
+
+    /**
+     * Enable/disable the binary structured log. While enabled, DA_LOG writes compact records to a .dalog file
+     * instead of formatting text; decode it with the DALogDecode commandlet.
+     */
+    UFUNCTION(BlueprintCallable, Category = "DarkAge|Logging")
+    void SetBinaryLoggingEnabled(bool bEnabled);
+
+    bool IsBinaryLoggingEnabled() const { return bBinaryLoggingEnabled.load(std::memory_order_relaxed); }
+
     /**
      * Get recent log entries for debugging
      */
@@ -183,10 +259,40 @@ public:
 
 protected:
     /**
-     * Write log entry to file
+     * Append a formatted log entry to the pending file write batch
      */
     void WriteToFile(const FDALogEntry& LogEntry);
 
+    /**
+     * Move entries from every thread buffer into history and the file batch, then write the batch
+     */
+    void DrainPendingLogs();
+
+    /**
+     * Get (registering on first use) the calling thread's log buffer
+     */
+    FDALogThreadBuffer* GetThreadBuffer();
+
+    /**
+     * Open a new timestamped log file
+     */
+    void OpenLogFile();
+
+    /**
+     * Open a new timestamped binary log file and write its header
+     */
+    void OpenBinaryLogFile();
+
+    /**
+     * Queue an encoded binary record on the calling thread's buffer
+     */
+    void SubmitBinaryRecord(const uint8* Data, int32 Size, EDALogLevel Level, EDALogCategory Category);
+
+    /**
+     * Format the error records in a drained binary block for the console (writer side only)
+     */
+    bool EmitBinaryErrors(TConstArrayView<uint8> Records);
+
     /**
      * Get the appropriate UE log category for our category
      */
@@ -203,9 +309,8 @@ protected:
     FString FormatLogEntry(const FDALogEntry& LogEntry) const;
 
 private:
-    /** All log entries (circular buffer) */
-    UPROPERTY()
-    TArray<FDALogEntry> LogHistory;
+    /** Most recent log entries (circular buffer, oldest first) */
+    TRingBuffer<FDALogEntry> LogHistory;
 
     /** Maximum number of log entries to keep in memory */
     UPROPERTY()
@@ -229,28 +334,63 @@ private:
     UPROPERTY()
     EDALogLevel FileLogLevel = EDALogLevel::Debug;
 
-    /** Statistics */
-    UPROPERTY()
+    /** Statistics (updated by the writer as entries are drained) */
     int32 TotalLogCount = 0;
-
-    UPROPERTY()
     int32 ErrorLogCount = 0;
-
-    UPROPERTY()
     int32 WarningLogCount = 0;
 
-    /** Critical section for thread safety */
+    /** Entries dropped because a thread buffer was full, reported on the next drain */
+    std::atomic<int32> DroppedLogCount{0};
+
+    /** Per-thread buffers, shared with each thread's cache; registration is the only place producers lock */
+    TArray<TSharedPtr<FDALogThreadBuffer, ESPMode::ThreadSafe>> ThreadBuffers;
+    FCriticalSection ThreadBuffersCriticalSection;
+
+    /** Keys this instance in each thread's buffer cache; zero while the subsystem is not accepting logs */
+    std::atomic<uint32> InstanceId{0};
+
+    /** Guards draining, history, statistics and the log file (never taken on the logging path) */
     mutable FCriticalSection LogCriticalSection;
+
+    /** Binary log file, its path, and how many registered formats it already contains */
+    TUniquePtr<FArchive> BinaryLogArchive;
+    FString BinaryLogFilePath;
+    int32 BinaryFormatsWritten = 0;
+    std::atomic<bool> bBinaryLoggingEnabled{false};
+
+    /** UTF-8 text waiting to be written in one call */
+    TArray<ANSICHAR> PendingFileWrite;
+
+    /** Binary records waiting to be written as one block */
+    TArray<uint8> PendingBinaryWrite;
+    bool bPendingFileFlush = false;
+    double LastFileFlushTime = 0.0;
+
+    /** Background writer */
+    FRunnableThread* WriterThread = nullptr;
+    FEvent* WriterWakeEvent = nullptr;
+    std::atomic<bool> bWriterStopRequested{false};
 };
 
 /**
  * Convenience macros for logging
  */
 #define DA_LOG(Level, Category, Format, ...) \
-    if (UDALoggingSubsystem* LogSubsystem = GEngine && GEngine->GetGameInstance() ? GEngine->GetGameInstance()->GetSubsystem<UDALoggingSubsystem>() : nullptr) \
+    do \
     { \
-        LogSubsystem->LogMessageWithSource(Level, Category, FString::Printf(Format, ##__VA_ARGS__), TEXT(""), TEXT(__FUNCTION__), __LINE__); \
-    }
+        if (UDALoggingSubsystem* LogSubsystem = GEngine && GEngine->GetGameInstance() ? GEngine->GetGameInstance()->GetSubsystem<UDALoggingSubsystem>() : nullptr) \
+        { \
+            if (LogSubsystem->IsBinaryLoggingEnabled()) \
+            { \
+                static const uint32 DALogFormatId = FDABinaryLogFormatRegistry::Get().Register(Format, TEXT(__FUNCTION__), __LINE__); \
+                LogSubsystem->LogBinary(DALogFormatId, Level, Category, ##__VA_ARGS__); \
+            } \
+            else \
+            { \
+                LogSubsystem->LogMessageWithSource(Level, Category, FString::Printf(Format, ##__VA_ARGS__), TEXT(""), TEXT(__FUNCTION__), __LINE__); \
+            } \
+        } \
+    } while (0)
 
 #define DA_LOG_TRACE(Category, Format, ...) DA_LOG(EDALogLevel::Trace, Category, Format, ##__VA_ARGS__)
 #define DA_LOG_DEBUG(Category, Format, ...) DA_LOG(EDALogLevel::Debug, Category, Format, ##__VA_ARGS__)
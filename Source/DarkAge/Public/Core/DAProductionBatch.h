@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Off-screen production for whole settlements at once.
+ *
+ * Nothing is tracked per worker. A settlement assigns a worker count to each recipe, and a
+ * step runs each recipe across every settlement in one pass, turning workers * rate * time
+ * into whole production runs. Runs are capped by the settlement's integer stock of each
+ * input. Stock, worker counts and progress are stored as one column per item or recipe,
+ * indexed by settlement, so a step walks contiguous integer arrays. A settlement with
+ * hundreds of workers costs no more than one with a single worker.
+ *
+ * Recipes run in registration order, so a chain's later steps can use what earlier steps
+ * produced in the same step.
+ */
+class DARKAGE_API FDAProductionBatch
+{
+public:
+    struct FInput
+    {
+        int32 Item = INDEX_NONE;
+        int32 Quantity = 1;
+    };
+
+    // Net stock change of one item in one settlement during the last Step
+    struct FStockChange
+    {
+        int32 Settlement = INDEX_NONE;
+        int32 Item = INDEX_NONE;
+        int32 Delta = 0;
+    };
+
+    int32 FindOrAddItem(FName ItemID);
+    int32 FindItem(FName ItemID) const;
+    FName GetItemID(int32 Item) const { return ItemIDs[Item]; }
+
+    /**
+     * Register a recipe. CycleSeconds is how long one worker takes for one run; YieldRate is
+     * the fraction of runs that produce output (inputs are consumed either way).
+     * Returns INDEX_NONE if RecipeID is already registered.
+     */
+    int32 AddRecipe(FName RecipeID, TConstArrayView<TPair<FName, int32>> RecipeInputs, FName OutputItemID, int32 OutputQuantity, float CycleSeconds, float YieldRate = 1.0f);
+    int32 FindRecipe(FName RecipeID) const;
+
+    int32 AddSettlement(FName SettlementID, FName RegionID);
+    int32 FindSettlement(FName SettlementID) const;
+    FName GetSettlementRegion(int32 Settlement) const { return SettlementRegions[Settlement]; }
+
+    void SetWorkers(int32 Settlement, int32 Recipe, int32 NumWorkers);
+    int32 GetWorkers(int32 Settlement, int32 Recipe) const { return Workers[Recipe * Stride + Settlement]; }
+
+    void AddStock(int32 Settlement, int32 Item, int32 Quantity);
+    int32 GetStock(int32 Settlement, int32 Item) const { return Stock[Item * Stride + Settlement]; }
+
+    // Advance every settlement by DeltaSeconds
+    void Step(float DeltaSeconds);
+
+    // Nonzero net stock changes from the last Step
+    void GetStockChanges(TArray<FStockChange>& OutChanges) const;
+
+    void Reset();
+
+    int32 NumItems() const { return ItemIDs.Num(); }
+    int32 NumRecipes() const { return Recipes.Num(); }
+    int32 NumSettlements() const { return SettlementIDs.Num(); }
+
+private:
+    // Yield is tracked in parts per YieldScale so partial output carries over between steps
+    static constexpr int32 YieldScale = 1000;
+
+    struct FRecipe
+    {
+        FName RecipeID;
+        int32 FirstInput = 0;
+        int32 NumInputs = 0;
+        int32 OutputItem = INDEX_NONE;
+        int32 OutputQuantity = 1;
+        float RunsPerWorkerSecond = 0.0f;
+        int32 Yield = YieldScale;
+    };
+
+    // Widen every per-settlement column to hold at least MinSettlements
+    void Reserve(int32 MinSettlements);
+
+    TArray<FName> ItemIDs;
+    TMap<FName, int32> ItemIndices;
+
+    TArray<FRecipe> Recipes;
+    TArray<FInput> Inputs;
+    TMap<FName, int32> RecipeIndices;
+
+    TArray<FName> SettlementIDs;
+    TArray<FName> SettlementRegions;
+    TMap<FName, int32> SettlementIndices;
+
+    // Column stride: settlement capacity, grown by doubling
+    int32 Stride = 0;
+
+    // [Item * Stride + Settlement]
+    TArray<int32> Stock;
+    TArray<int32> StepDeltas;
+
+    // [Recipe * Stride + Settlement]
+    TArray<int32> Workers;
+    TArray<float> Progress;
+    TArray<int32> YieldCarry;
+};
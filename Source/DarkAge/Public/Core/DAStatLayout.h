@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Process-wide stat layout.
+ *
+ * Every stat name is given a fixed index the first time it is registered, so callers can
+ * resolve a name once and use the index from then on. The common stats are registered up
+ * front, which makes their indices constants. Indices are local to the process; anything
+ * sent over the network should still use stat names. Game thread only.
+ */
+class DARKAGE_API FDAStatLayout
+{
+public:
+    static constexpr int32 Health = 0;
+    static constexpr int32 Stamina = 1;
+    static constexpr int32 Mana = 2;
+    static constexpr int32 Hunger = 3;
+    static constexpr int32 Thirst = 4;
+
+    static FDAStatLayout& Get();
+
+    // Returns the stat's index, assigning the next free one if the name is new
+    int32 RegisterStat(FName StatName);
+
+    // Returns INDEX_NONE for names that were never registered
+    int32 FindStatIndex(FName StatName) const;
+
+    FName GetStatName(int32 StatIndex) const;
+
+    int32 Num() const { return StatNames.Num(); }
+
+private:
+    FDAStatLayout();
+
+    TMap<FName, int32> IndexByName;
+    TArray<FName> StatNames;
+};
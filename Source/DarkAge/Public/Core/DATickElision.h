@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UActorComponent;
+
+/**
+ * Per-component tick elision.
+ *
+ * A component embeds one of these, declares when it has nothing to do by calling Sleep()
+ * (usually at the end of TickComponent) and calls Wake() from whatever event can give it
+ * work again. While idle the component's tick is disabled, or slowed to IdleTickInterval,
+ * and the time spent idle is credited to its class in FDATickAccounting.
+ */
+struct DARKAGE_API FDATickElision
+{
+    // Tick interval while the component has work (0 = every frame)
+    float ActiveTickInterval = 0.0f;
+
+    // Tick interval while idle; a negative value disables the tick until Wake()
+    float IdleTickInterval = -1.0f;
+
+    // Call from BeginPlay
+    void Initialize(UActorComponent* InComponent, bool bStartIdle = false);
+
+    // Call from EndPlay so an open idle period is accounted
+    void Shutdown();
+
+    void Sleep();
+    void Wake();
+    void SetIdle(bool bIdle) { bIdle ? Sleep() : Wake(); }
+    bool IsIdle() const { return bIdle; }
+
+private:
+    void ApplyTickState() const;
+
+    // Frame ticks avoided per second of idle time
+    double GetElidedTicksPerSecond() const;
+
+    TWeakObjectPtr<UActorComponent> Component;
+    FName ClassName;
+    double IdleStartTime = 0.0;
+    double IdleElisionRate = 0.0;
+    bool bIdle = false;
+    bool bInitialized = false;
+};
+
+/**
+ * Tick cost and elision totals per component class. Game thread only.
+ * "DA.TickReport" logs the table, "DA.TickReport reset" clears it.
+ */
+class DARKAGE_API FDATickAccounting
+{
+public:
+    struct FClassStats
+    {
+        int32 NumComponents = 0;
+        int32 NumIdle = 0;
+        int64 TicksRun = 0;
+        uint64 TickCycles = 0;
+
+        // Ticks avoided by idle periods that have ended
+        double ElidedTicks = 0.0;
+
+        // Open idle periods: sum of rates and sum of rate * start time
+        double OpenElisionRate = 0.0;
+        double OpenElisionRateTime = 0.0;
+    };
+
+    static FDATickAccounting& Get();
+
+    void RecordTick(FName ClassName, uint64 Cycles);
+    void RecordRegistered(FName ClassName);
+    void RecordUnregistered(FName ClassName);
+    void RecordIdleStart(FName ClassName, double Rate, double StartTime);
+    void RecordIdleEnd(FName ClassName, double Rate, double StartTime, double EndTime);
+
+    void LogReport() const;
+    void Reset();
+
+private:
+    TMap<FName, FClassStats> Stats;
+};
+
+/**
+ * Times one TickComponent call for FDATickAccounting
+ */
+class DARKAGE_API FDAScopedTickAccounting
+{
+public:
+    explicit FDAScopedTickAccounting(const UActorComponent* Component);
+    ~FDAScopedTickAccounting();
+
+private:
+    FName ClassName;
+    uint64 StartCycles;
+};
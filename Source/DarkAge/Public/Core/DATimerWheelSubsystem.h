@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "DATimerWheelSubsystem.generated.h"
+
+/**
+ * Handle to a timer scheduled on UDATimerWheelSubsystem. Zero is never a valid timer.
+ */
+struct FDATimerHandle
+{
+    uint64 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+    void Invalidate() { Id = 0; }
+
+    bool operator==(const FDATimerHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FDATimerHandle& Other) const { return Id != Other.Id; }
+};
+
+/**
+ * Timer callback; receives the handle of the timer that fired so owners with several
+ * timers can tell them apart
+ */
+using FDATimerCallback = TFunction<void(FDATimerHandle)>;
+
+/**
+ * Shared hierarchical timer wheel for gameplay timers that fire at second-scale
+ * granularity (effect expiry, periodic effect ticks, disease stages).
+ *
+ * Timers live in four wheels of 64 slots. Level 0 covers the next 64 steps of
+ * TIMER_RESOLUTION seconds, each level above covers 64 times the span of the one
+ * below, and anything further out waits in an overflow list. Scheduling and
+ * cancelling are O(1); a step only touches the slot that is due, plus a cascade
+ * of one higher slot every 64 steps. Components that schedule their work here
+ * don't need to tick at all.
+ */
+UCLASS()
+class DARKAGE_API UDATimerWheelSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface (only ticks while timers are pending)
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return Timers.Num() > 0; }
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDATimerWheelSubsystem, STATGROUP_Tickables); }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+    /**
+     * Schedule Callback to run after Delay seconds. If Interval > 0 the timer repeats
+     * every Interval seconds afterwards and the handle stays valid until cancelled.
+     * The timer is dropped without firing once Owner has been destroyed.
+     */
+    FDATimerHandle Schedule(UObject* Owner, float Delay, FDATimerCallback Callback, float Interval = 0.0f);
+
+    // Cancel a pending timer and invalidate the handle; safe to call from inside a callback
+    void Cancel(FDATimerHandle& Handle);
+
+    bool IsScheduled(const FDATimerHandle& Handle) const { return Timers.Contains(Handle.Id); }
+
+    // Seconds until the timer next fires, or -1 if it isn't scheduled
+    float GetTimeRemaining(const FDATimerHandle& Handle) const;
+
+    int32 GetNumTimers() const { return Timers.Num(); }
+
+    // Seconds per wheel step
+    static constexpr float TIMER_RESOLUTION = 0.1f;
+
+private:
+    static constexpr int32 LEVEL_BITS = 6;
+    static constexpr int32 SLOTS_PER_LEVEL = 1 << LEVEL_BITS;
+    static constexpr int32 NUM_LEVELS = 4;
+
+    struct FTimer
+    {
+        uint64 DueStep = 0;
+        uint64 IntervalSteps = 0;
+        TWeakObjectPtr<UObject> Owner;
+        FDATimerCallback Callback;
+    };
+
+    // Place a timer in the slot for its due step relative to CurrentStep
+    void InsertTimer(uint64 TimerId, uint64 DueStep);
+
+    // Advance one step: cascade higher levels when level 0 wraps, then fire the due slot
+    void Step();
+
+    void FireTimer(uint64 TimerId);
+
+    static uint64 SecondsToSteps(float Seconds);
+
+    TMap<uint64, FTimer> Timers;
+
+    // Timer ids per slot; cancelled ids are left behind and skipped when their slot comes up
+    TArray<uint64> Wheels[NUM_LEVELS][SLOTS_PER_LEVEL];
+    TArray<uint64> Overflow;
+
+    uint64 CurrentStep = 0;
+    uint64 NextTimerId = 1;
+    float StepAccumulator = 0.0f;
+};
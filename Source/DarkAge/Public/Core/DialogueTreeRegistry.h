@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Data/DialogueData.h"
+#include "Core/DAConditionProgram.h"
+#include "DialogueTreeRegistry.generated.h"
+
+/**
+ * Handle to a compiled tree in UDialogueTreeRegistry. Handles stay valid for the lifetime of
+ * the game instance.
+ */
+struct FDialogueTreeHandle
+{
+    int32 Index = INDEX_NONE;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FDialogueTreeHandle& Other) const { return Index == Other.Index; }
+    bool operator!=(const FDialogueTreeHandle& Other) const { return Index != Other.Index; }
+};
+
+// A tree's exit: if Condition holds once its lines run out, continue with NextTreeID
+struct FDialogueBranch
+{
+    int32 Condition = INDEX_NONE; // Clause in the registry's condition program
+    FName NextTreeID;
+
+    bool operator==(const FDialogueBranch& Other) const { return Condition == Other.Condition && NextTreeID == Other.NextTreeID; }
+};
+
+/**
+ * Shared, read-only storage for dialogue trees.
+ *
+ * Trees are compiled into flat line, response and branch arrays, and all of their text is
+ * interned in one string pool. Registering a tree whose content matches one already compiled
+ * returns the existing handle. NPCs therefore hold handles and a line cursor rather than
+ * their own copies, and dialogue memory grows with unique content rather than NPC count.
+ *
+ * Lines with an empty speaker name are spoken by whichever NPC is running the tree.
+ */
+UCLASS()
+class DARKAGE_API UDialogueTreeRegistry : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Compile a tree, or return the handle of an identical tree compiled earlier
+    FDialogueTreeHandle RegisterTree(const FDialogueTree& Tree);
+
+    // Register a tree that every NPC can start by its TreeID
+    FDialogueTreeHandle RegisterSharedTree(const FDialogueTree& Tree);
+    FDialogueTreeHandle FindSharedTree(FName TreeID) const;
+
+    FName GetTreeID(FDialogueTreeHandle Tree) const;
+    int32 GetNumLines(FDialogueTreeHandle Tree) const;
+    int32 GetNumResponses(FDialogueTreeHandle Tree, int32 LineIndex) const;
+    bool DoesResponseEndDialogue(FDialogueTreeHandle Tree, int32 LineIndex, int32 ResponseIndex) const;
+    TConstArrayView<FDialogueBranch> GetBranches(FDialogueTreeHandle Tree) const;
+
+    // Write a line into OutLine, reusing OutLine's string and array storage
+    void GetLine(FDialogueTreeHandle Tree, int32 LineIndex, FDialogueLine& OutLine) const;
+
+    const FString& GetString(int32 StringId) const { return Strings[StringId]; }
+
+    // Evaluate a branch condition compiled at registration
+    bool EvaluateCondition(int32 Clause, const FDAConditionContext& Context) const { return Conditions.Evaluate(Clause, Context); }
+
+    UFUNCTION(BlueprintPure, Category = "Dialogue")
+    int32 GetNumTrees() const { return Trees.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Dialogue")
+    int32 GetNumUniqueStrings() const { return Strings.Num(); }
+
+private:
+    // FString's default hash and equality ignore case; dialogue text and tree IDs must not
+    struct FCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+    using FCaseSensitiveStringMap = TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs>;
+
+    struct FCompiledLine
+    {
+        int32 SpeakerName = INDEX_NONE;
+        int32 Text = INDEX_NONE;
+        int32 FirstResponse = 0;
+        int32 NumResponses = 0;
+        EDialogueMood Mood = EDialogueMood::Neutral;
+
+        bool operator==(const FCompiledLine& Other) const
+        {
+            return SpeakerName == Other.SpeakerName && Text == Other.Text && NumResponses == Other.NumResponses && Mood == Other.Mood;
+        }
+    };
+
+    struct FCompiledTree
+    {
+        FName TreeID;
+        int32 TreeIDString = INDEX_NONE; // Interned TreeID, so duplicates are matched case-sensitively
+        int32 FirstLine = 0;
+        int32 NumLines = 0;
+        int32 FirstBranch = 0;
+        int32 NumBranches = 0;
+    };
+
+    int32 InternString(const FString& String);
+    int32 CompileCondition(const FString& ConditionKey);
+    const FCompiledLine* FindLine(FDialogueTreeHandle Tree, int32 LineIndex) const;
+    void RegisterDefaultTrees();
+
+    TArray<FString> Strings;
+    FCaseSensitiveStringMap StringIds;
+
+    TArray<FCompiledTree> Trees;
+    TArray<FCompiledLine> Lines;
+    TArray<int32> Responses;
+    TBitArray<> ResponseEndsDialogue;
+    TArray<FDialogueBranch> Branches;
+
+    // Each distinct condition key is compiled once and shared by every branch that uses it
+    FDAConditionProgram Conditions;
+    FCaseSensitiveStringMap ClausesByConditionKey;
+
+    TMultiMap<uint32, int32> TreesByContentHash;
+    TMap<FName, int32> SharedTrees;
+};
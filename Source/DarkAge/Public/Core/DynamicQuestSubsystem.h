@@ -4,6 +4,8 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "Data/FactionData.h"
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+#include "Core/QuestEventLog.h"
 #include "DynamicQuestSubsystem.generated.h"
 
 // Forward declaration for FQuestObjective
@@ -63,6 +65,9 @@ struct DARKAGE_API FQuestObjective
 // Forward declarations
 class UWorldManagementSubsystem;
 class UEconomySubsystem;
+class UQuestRuntimeSubsystem;
+struct FQuestRuntimeHandle;
+enum class EQuestRuntimeEvent : uint8;
 
 /**
  * Enumeration for quest types
@@ -105,43 +110,6 @@ enum class EDynamicQuestStatus : uint8
 	Expired       UMETA(DisplayName = "Expired")
 };
 
-/**
- * Enumeration for quest event types
- */
-UENUM(BlueprintType)
-enum class EQuestEventType : uint8
-{
-	Accepted     UMETA(DisplayName = "Accepted"),
-	Completed    UMETA(DisplayName = "Completed"),
-	Failed       UMETA(DisplayName = "Failed"),
-	Expired      UMETA(DisplayName = "Expired"),
-	ChoiceMade   UMETA(DisplayName = "Choice Made")
-};
-
-/**
- * Structure representing a quest event log entry
- */
-USTRUCT(BlueprintType)
-struct FQuestEventLogEntry
-{
-	GENERATED_BODY()
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	FString QuestID = TEXT("");
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	EQuestEventType EventType = EQuestEventType::Accepted;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	FString PlayerID = TEXT("");
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	FString ChoiceOrDetail = TEXT("");
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	float Timestamp = 0.0f;
-};
-
 /**
  * Structure representing a dynamically generated quest
  */
@@ -420,7 +388,7 @@ public:
 	 * Quest Analytics and Event Log
 	 */
 
-	// Query quest events
+	// Query recent quest events, newest first
 	UFUNCTION(BlueprintCallable, Category = "Dynamic Quest System|Analytics")
 	TArray<FQuestEventLogEntry> QueryQuestEvents(const FString& QuestID, EQuestEventType EventType, int32 MaxResults = 50) const;
 
@@ -437,17 +405,19 @@ public:
 	void LogPlayerQuestChoice(const FString& QuestID, const FString& PlayerID, const FString& ChoiceDetail);
 
 protected:
-	// Active quests
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System")
-	TMap<FString, FDynamicQuest> ActiveQuests;
-
 	// Quest templates for generation
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System")
 	TMap<FString, FDynamicQuest> QuestTemplates;
 
-	// Quest event log
+	// Quest event log; recent events stay in memory, older ones are spilled to disk
+	FQuestEventLog QuestEventLog;
+
+	// Spill files kept from earlier sessions, as QuestEvents_1.log (newest) and up
+	static constexpr int32 MaxEventSpillBackups = 3;
+
+	// Running completion totals, kept separately because finished quests are removed
 	UPROPERTY(VisibleAnywhere, Category = "Dynamic Quest System|Analytics")
-	TArray<FQuestEventLogEntry> QuestEventLog;
+	TMap<EDynamicQuestType, int32> CompletionCountByQuestType;
 
 	// Reference to world management subsystem
 	UPROPERTY()
@@ -457,7 +427,11 @@ protected:
 	UPROPERTY()
 	TWeakObjectPtr<UEconomySubsystem> EconomySubsystem;
 
-	// Quest generation settings
+	// Quest storage, tracking and expiry shared with the other quest systems
+	UPROPERTY()
+	TObjectPtr<UQuestRuntimeSubsystem> QuestRuntime;
+
+	// Quest generation settings; finished quests are dropped this long after they end
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System Settings")
 	float QuestUpdateInterval = 60.0f; // 1 minute
 
@@ -467,22 +441,37 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System Settings")
 	float DefaultQuestReward = 100.0f;
 
+	// Open resource shortage quests allowed per region at once
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System Settings")
+	int32 MaxShortageQuestsPerRegion = 3;
+
+	// Seconds before a region/item shortage can produce another quest after the last one closed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dynamic Quest System Settings")
+	float ShortageQuestCooldown = 600.0f;
+
 	// --- Next-level: Quest analytics and event log ---
 	void LogQuestEvent(const FString& QuestID, EQuestEventType EventType, const FString& PlayerID, const FString& ChoiceOrDetail);
 	virtual UWorld* GetWorld() const override { return GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr; }
 
 private:
-	// Timer for quest updates
-	FTimerHandle QuestUpdateTimer;
-
 	// Possible quest types for generation
 	TArray<EDynamicQuestType> PossibleQuestTypes;
 
 	// Initialize default quest templates
 	void InitializeQuestTemplates();
 
-	// Update active quests (handle time limits, etc.)
-	void UpdateActiveQuests();
+	// Quests live in the quest runtime; these look them up by this subsystem's quest IDs
+	FDynamicQuest* FindQuest(const FString& QuestID);
+	const FDynamicQuest* FindQuest(const FString& QuestID) const;
+	FQuestRuntimeHandle FindQuestHandle(const FString& QuestID) const;
+
+	// Objective completions, expiry and removal reported by the quest runtime
+	void HandleRuntimeEvent(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex);
+
+	// Fill in RemainingTime from the quest's pending deadline
+	void RefreshRemainingTime(FDynamicQuest& Quest) const;
+
+	UQuestObjectiveTrackerSubsystem* GetObjectiveTracker() const;
 
 	// Generate specific quest types
 	FDynamicQuest GenerateDeliveryQuest(const FQuestGenerationParams& Params);
@@ -493,8 +482,42 @@ private:
 	FDynamicQuest GenerateProtectionQuest(const FQuestGenerationParams& Params);
 	FDynamicQuest GenerateInvestigationQuest(const FQuestGenerationParams& Params);
 
-	// Generate quests based on economic conditions
-	void GenerateResourceShortageQuests();
+	/**
+	 * Demand-driven generation. The economy reports when an item's supply crosses the low
+	 * threshold; each (region, item, kind) has at most one open quest, regions have a quota,
+	 * and a key that just closed waits out a cooldown. Shortages that can't get a quest yet
+	 * stay pending and are retried when a slot or cooldown frees up.
+	 */
+	struct FDemandQuestKey
+	{
+		FName RegionID;
+		FName ItemID;
+		EDynamicQuestType Kind = EDynamicQuestType::Gathering;
+
+		bool operator==(const FDemandQuestKey& Other) const { return RegionID == Other.RegionID && ItemID == Other.ItemID && Kind == Other.Kind; }
+		friend uint32 GetTypeHash(const FDemandQuestKey& Key) { return HashCombine(HashCombine(GetTypeHash(Key.RegionID), GetTypeHash(Key.ItemID)), ::GetTypeHash(static_cast<uint8>(Key.Kind))); }
+	};
+
+	UFUNCTION()
+	void HandleSupplyThresholdCrossed(FName Region, FName ItemId, bool bLowSupply);
+
+	// Queue quests for shortages that already exist when the subsystem starts
+	void SeedResourceShortageQuests();
+
+	// Returns true if a quest was created; otherwise the key is left pending
+	bool TryGenerateShortageQuest(const FDemandQuestKey& Key);
+	void RetryPendingShortages(FName RegionID);
+	void ReleaseDemandQuest(const FString& QuestID);
+
+	// Rebuild the key, quota slot and serial of a loaded shortage quest
+	void RestoreDemandQuest(const FDynamicQuest& Quest);
+
+	TMap<FDemandQuestKey, FString> OpenDemandQuests;
+	TMap<FString, FDemandQuestKey> DemandQuestKeys;
+	TMap<FName, int32> OpenDemandQuestsPerRegion;
+	TMap<FDemandQuestKey, FQuestTrackingHandle> DemandCooldowns;
+	TSet<FDemandQuestKey> PendingShortages;
+	int32 NextDemandQuestSerial = 1;
 
 	// Helper functions
 	FString GenerateQuestName(EDynamicQuestType QuestType, EDynamicQuestDifficulty Difficulty);
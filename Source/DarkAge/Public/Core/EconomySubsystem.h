@@ -21,6 +21,9 @@ struct FBasicMarketData
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Market Data")
     float CurrentPrice = 10.f;
 
+    // Whether the item is currently past the low supply threshold; derived, not saved
+    bool bLowSupply = false;
+
     friend FArchive& operator<<(FArchive& Ar, FBasicMarketData& Data);
 };
 
@@ -74,6 +77,8 @@ struct FMarketEvent
     float Duration = 0.0f;
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSupplyThresholdCrossed, FName, Region, FName, ItemId, bool, bLowSupply);
+
 UCLASS()
 class DARKAGE_API UEconomySubsystem : public UGameInstanceSubsystem
 {
@@ -94,6 +99,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "Economy")
     float GetItemPrice(const FName& Region, const FName& ItemId) const;
 
+    UFUNCTION(BlueprintPure, Category = "Economy")
+    float GetItemSupply(const FName& Region, const FName& ItemId) const;
+
     UFUNCTION(BlueprintCallable, Category = "Economy")
     bool GetItemData(FName ItemID, FItemData& OutItemData) const;
 
@@ -103,6 +111,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Economy")
     TArray<FName> GetItemsWithLowSupply(const FName& Region) const;
 
+    // Fires when an item's supply drops below half its demand, and again once it has recovered
+    UPROPERTY(BlueprintAssignable, Category = "Economy")
+    FOnSupplyThresholdCrossed OnSupplyThresholdCrossed;
+
+    // Every (region, item) pair currently in low supply, from the tracked threshold state
+    void GetLowSupplyItems(TArray<TPair<FName, FName>>& OutRegionItems) const;
+
     UFUNCTION(BlueprintCallable, Category = "Economy")
     void ProcessTradeRoutes();
 
@@ -134,7 +149,14 @@ public:
     TArray<FName> GetMostProfitableTradeRoutes() const;
 
 private:
+    // Supply below LowSupplyRatio * Demand counts as low; it has to climb back above
+    // RecoveredSupplyRatio * Demand before the shortage is considered over
+    static constexpr float LowSupplyRatio = 0.5f;
+    static constexpr float RecoveredSupplyRatio = 0.6f;
+
     void UpdatePrice(const FName& Region, const FName& ItemId);
+    void UpdateSupplyThreshold(const FName& Region, const FName& ItemId, FBasicMarketData& ItemData, bool bBroadcast = true);
+    void RefreshSupplyThresholds();
     void UpdateMarketEvent(FMarketEvent Event);
     void RegisterDebugCommands();
     void InitializeDefaultEconomy();
@@ -6,13 +6,20 @@
 #include "Engine/World.h"
 #include "Data/EnvironmentalFactorsData.h"
 #include "Components/StatusEffectComponent.h"
-#include "Core/WeatherSystem.h"
 #include "EnvironmentalFactorsComponent.generated.h"
 
 // Forward declarations
 struct FEnvironmentalFactors;
 class UStatusEffectComponent;
-class UWeatherSystem;
+class UEnvironmentalFieldSubsystem;
+
+// Thermal band an actor is currently in; changes only when a threshold plus hysteresis is crossed
+enum class EThermalState : uint8
+{
+    Neutral,
+    Cold,
+    Hot
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class DARKAGE_API UEnvironmentalFactorsComponent : public UActorComponent
@@ -24,20 +31,54 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+    // Pushed by UEnvironmentalFieldSubsystem when the field of this component's region changes
     UFUNCTION(BlueprintCallable, Category = "Environmental Factors")
     void UpdateEnvironmentalFactors(const FEnvironmentalFactors& CurrentFactors);
 
     UFUNCTION(BlueprintPure, Category = "Environmental Factors")
     float GetCurrentTemperature() const;
 
+    // Region used when the owner has no UWorldInteractionComponent to report one
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors")
+    FName DefaultRegion;
+
+    // Thresholds are in °F like UWeatherSystem's temperatures; the defaults match ETemperatureRange's Cold and Hot bands.
+    // Cold applies below ColdThreshold and clears above ColdThreshold + TemperatureHysteresis
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Thresholds")
+    float ColdThreshold = 50.0f;
+
+    // Hot applies above HotThreshold and clears below HotThreshold - TemperatureHysteresis
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Thresholds")
+    float HotThreshold = 90.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Thresholds", meta = (ClampMin = "0.0"))
+    float TemperatureHysteresis = 4.0f;
+
+    EThermalState GetThermalState() const { return ThermalState; }
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Effects")
+    FDataTableRowHandle ColdEffect;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Effects")
+    FDataTableRowHandle HotEffect;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Environmental Factors|Effects")
+    FDataTableRowHandle WetEffect;
+
 private:
+    UFUNCTION()
+    void HandleRegionChanged(FName OldRegion, FName NewRegion);
+
     void UpdateTemperatureEffects(float AirTemperature);
     void UpdateWeatherEffects(EWeatherType WeatherType);
     void UpdateTimeOfDayEffects(float TimeOfDay);
 
+    // Apply or remove an effect row; only called on state transitions
+    void SetEffectActive(const FDataTableRowHandle& EffectHandle, bool bActive);
+
     UPROPERTY(VisibleAnywhere, Category = "Environmental Factors")
     FEnvironmentalFactors LastReceivedFactors;
 
@@ -45,5 +86,8 @@ private:
     TWeakObjectPtr<UStatusEffectComponent> StatusEffectComponent;
 
     UPROPERTY()
-    TWeakObjectPtr<UWeatherSystem> WeatherSystem;
+    TWeakObjectPtr<UEnvironmentalFieldSubsystem> FieldSubsystem;
+
+    EThermalState ThermalState = EThermalState::Neutral;
+    bool bIsWet = false;
 };
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Data/EnvironmentalFactorsData.h"
+#include "EnvironmentalFieldSubsystem.generated.h"
+
+class UEnvironmentalFactorsComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEnvironmentalFieldChanged, FName, Region, const FEnvironmentalFactors&, Factors);
+
+/**
+ * Environmental Field Subsystem
+ * Publish/subscribe service for environmental factors. Weather sources publish the global
+ * field or a regional override; subscribed components are grouped by region and only receive
+ * a push when the field of their region actually changes. Regions without an override follow
+ * the global field. NAME_None is the default region.
+ */
+UCLASS()
+class DARKAGE_API UEnvironmentalFieldSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // Subscribe a component to a region; it is pushed the region's current factors straight away
+    void Subscribe(UEnvironmentalFactorsComponent* Component, FName Region);
+    void Unsubscribe(UEnvironmentalFactorsComponent* Component);
+
+    // Move a subscriber to another region, pushing the new region's factors if they differ
+    void MoveSubscriber(UEnvironmentalFactorsComponent* Component, FName NewRegion);
+
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    void PublishGlobalFactors(const FEnvironmentalFactors& Factors);
+
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    void PublishRegionFactors(FName Region, const FEnvironmentalFactors& Factors);
+
+    // Drop a regional override so the region follows the global field again
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    void ClearRegionFactors(FName Region);
+
+    UFUNCTION(BlueprintPure, Category = "Environment")
+    FEnvironmentalFactors GetFactors(FName Region) const;
+
+    UFUNCTION(BlueprintPure, Category = "Environment")
+    int32 GetNumSubscribers() const { return SubscriberRegions.Num(); }
+
+    UPROPERTY(BlueprintAssignable, Category = "Environment")
+    FOnEnvironmentalFieldChanged OnFieldChanged;
+
+    // Temperature drift smaller than this (since the last push) is not published
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment")
+    float TemperaturePublishStep = 0.5f;
+
+private:
+    bool IsMeaningfulChange(const FEnvironmentalFactors& Current, const FEnvironmentalFactors& Incoming) const;
+    void PushToRegion(FName Region, const FEnvironmentalFactors& Factors);
+
+    FEnvironmentalFactors GlobalFactors;
+    bool bHasGlobalFactors = false;
+
+    TMap<FName, FEnvironmentalFactors> RegionOverrides;
+
+    // Subscribers grouped by region, and the reverse lookup for unsubscribing
+    TMap<FName, TArray<TWeakObjectPtr<UEnvironmentalFactorsComponent>>> RegionSubscribers;
+    TMap<TWeakObjectPtr<UEnvironmentalFactorsComponent>, FName> SubscriberRegions;
+};
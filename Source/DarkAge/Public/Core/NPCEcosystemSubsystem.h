@@ -7,6 +7,8 @@
 #include "NPCEcosystemSubsystem.generated.h"
 
 // Forward declarations
+class USettlementProductionSubsystem;
+
 UENUM(BlueprintType)
 enum class ESettlementType : uint8
 {
@@ -58,9 +60,14 @@ struct FSettlementData
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TArray<ESettlementSpecialization> Specializations;
 
+    // Economy region whose market the settlement's production feeds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FName RegionID;
+
     FSettlementData()
     {
         SettlementName = TEXT("");
+        RegionID = NAME_None;
         Location = FVector::ZeroVector;
         SettlementType = ESettlementType::Village;
         Population = 0;
@@ -71,6 +78,35 @@ struct FSettlementData
     }
 };
 
+/**
+ * Next simulated interaction for one side of an NPC relationship, keyed by social update number.
+ */
+struct FScheduledNPCInteraction
+{
+    int32 DueUpdate = 0;
+    FGuid NPCID;
+    FGuid TargetNPCID;
+
+    bool operator<(const FScheduledNPCInteraction& Other) const
+    {
+        return DueUpdate < Other.DueUpdate;
+    }
+};
+
+/**
+ * Secondary indices over the NPCs currently living in one settlement.
+ * Maintained on spawn, death and migration so per-settlement queries never scan NPCPopulation.
+ */
+struct FSettlementPopulationIndex
+{
+    TArray<FGuid> Residents;
+
+    // Residents without the loyalty penalty in ShouldNPCMigrate
+    TArray<FGuid> MigrationProneResidents;
+
+    TMap<ENPCProfession, int32> ProfessionCounts;
+};
+
 /**
  * Manages the lifecycle and interactions of NPCs in the world.
  */
@@ -93,6 +129,9 @@ public:
 
     void Tick(float DeltaTime);
 
+    // Removes a dead NPC from the population and all settlement indices
+    void RemoveNPC(const FGuid& NPCID);
+
 private:
     // Initialization methods
     void InitializeSettlements();
@@ -100,14 +139,23 @@ private:
     void InitializeSocialNetworks();
 
     // Settlement management
-    void CreateSettlement(const FString& Name, const FVector& Location, ESettlementType Type, int32 InitialPopulation);
+    void CreateSettlement(const FString& Name, const FVector& Location, ESettlementType Type, int32 InitialPopulation, FName RegionID);
     void PopulateSettlement(const FString& SettlementName, int32 PopulationCount);
 
-    // NPC generation and management
-    FNPCData GenerateNPC(const FString& SettlementName, ESettlementType SettlementType);
-    FString GenerateNPCName();
-    ENPCProfession AssignProfession(ESettlementType SettlementType);
-    void GenerateDailySchedule(FNPCData& NPC);
+    // Push the settlement's current profession counts to USettlementProductionSubsystem as workers
+    void UpdateSettlementProduction(const FString& SettlementName);
+
+    // NPC generation and management (stream-driven so bulk generation can run in parallel)
+    FNPCData GenerateNPC(const FString& SettlementName, ESettlementType SettlementType, const FRandomStream& RandomStream) const;
+    FString GenerateNPCName(const FRandomStream& RandomStream) const;
+    ENPCProfession AssignProfession(ESettlementType SettlementType, const FRandomStream& RandomStream) const;
+    void GenerateDailySchedule(FNPCData& NPC, const FRandomStream& RandomStream) const;
+
+    // Population store maintenance
+    void AddNPC(const FNPCData& NPC);
+    void IndexNPC(const FNPCData& NPC);
+    void UnindexNPC(const FNPCData& NPC);
+    static bool IsMigrationProne(const FNPCData& NPC);
 
     // Social system
     void CreateSocialConnections(FNPCData& NPC);
@@ -128,11 +176,14 @@ private:
     void UpdateNPCBehaviors(float DeltaTime);
     
     // Additional helper methods
-    void ProcessLifeEvent(FNPCData& NPC);
+    // Returns true if the NPC died; the caller removes it with RemoveNPC
+    bool ProcessLifeEvent(FNPCData& NPC);
     void UpdateNPCNeeds(FNPCData& NPC);
-    void UpdateNPCRelationships(FNPCData& NPC);
+    void ScheduleNPCInteraction(const FGuid& NPCID, const FGuid& TargetNPCID);
+    float GetEffectiveRelationshipStrength(const FNPCRelationship& Relationship) const;
     void ProcessSocialInteraction(FNPCData& NPC, FNPCRelationship& Relationship);
     bool ShouldNPCMigrate(const FNPCData& NPC);
+    float GetSettlementMigrationPressure(const FSettlementData& Settlement) const;
     void ProcessNPCMigration(const FGuid& NPCID);
     void UpdateNPCActivity(FNPCData& NPC, float DeltaTime);
 
@@ -154,6 +205,12 @@ private:
     float SocialUpdateTimer;
     float MigrationUpdateTimer;
 
+    // Social updates run so far; relationship LastInteractionTime is measured in these
+    int32 SocialUpdateCount = 0;
+
+    // Min-heap of upcoming relationship interactions; idle relationships are never visited
+    TArray<FScheduledNPCInteraction> InteractionQueue;
+
     // Data containers
     UPROPERTY(VisibleAnywhere, Category = "NPC Ecosystem")
     TMap<FGuid, FNPCData> NPCPopulation;
@@ -161,9 +218,18 @@ private:
     UPROPERTY(VisibleAnywhere, Category = "NPC Ecosystem")
     TMap<FString, FSettlementData> Settlements;
 
+    // Settlement name -> residents, profession counts and migration candidates
+    TMap<FString, FSettlementPopulationIndex> SettlementIndex;
+
+    // Random stream for population changes made on the game thread
+    FRandomStream PopulationRandomStream;
+
     UPROPERTY(VisibleAnywhere, Category = "NPC Ecosystem")
     TMap<FString, FString> SocialNetworks;
 
     UPROPERTY(VisibleAnywhere, Category = "NPC Ecosystem")
     TMap<FString, FNPCArchetype> NPCArchetypes;
+
+    UPROPERTY()
+    TObjectPtr<USettlementProductionSubsystem> SettlementProduction;
 };
\ No newline at end of file
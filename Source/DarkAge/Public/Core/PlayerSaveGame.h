@@ -8,6 +8,7 @@
 #include "Data/QuestData.h"
 #include "Data/PlayerSkillData.h"
 #include "Data/InventoryData.h"
+#include "Core/QuestRuntimeSubsystem.h"
 #include "PlayerSaveGame.generated.h"
 
 USTRUCT(BlueprintType)
@@ -61,6 +62,10 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TMap<FName, FQuestLogEntry> QuestLog;
+
+    // Generated and dynamic quests held by UQuestRuntimeSubsystem
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FQuestRuntimeSaveRecord> DynamicQuests;
    
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TMap<FName, FPlayerSkillInstanceData> PlayerSkills;
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Core/DAGenerationCache.h"
 #include "ProceduralContentGenerator.generated.h"
 
 USTRUCT(BlueprintType)
@@ -32,6 +33,8 @@ struct FProceduralLocation
         DangerLevel = 1;
         EconomicValue = 1;
     }
+
+    friend FArchive& operator<<(FArchive& Ar, FProceduralLocation& Location);
 };
 
 USTRUCT(BlueprintType)
@@ -39,6 +42,7 @@ struct FProceduralQuest
 {
     GENERATED_BODY()
 
+    // Unique per generated quest; assigned on every call and not part of the cached result
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest")
     FString QuestID;
 
@@ -74,6 +78,8 @@ struct FProceduralQuest
         Difficulty = 1;
         RewardGold = 0;
     }
+
+    friend FArchive& operator<<(FArchive& Ar, FProceduralQuest& Quest);
 };
 
 USTRUCT(BlueprintType)
@@ -110,8 +116,22 @@ struct FProceduralNPC
         Wealth = 0;
         Influence = 0;
     }
+
+    friend FArchive& operator<<(FArchive& Ar, FProceduralNPC& NPC);
 };
 
+/**
+ * Seeded procedural content.
+ *
+ * Every generator call draws from its own random stream, derived from the seed, the
+ * generator version, the content templates and the call's parameters. The same inputs
+ * therefore always produce the same output, and outputs are kept in an on-disk
+ * FDAGenerationCache under that same key. After a restart or region reload, content is
+ * read back from the cache instead of being generated again. Pass a different Variant to
+ * get another result for the same parameters; set generators also take the ID of the
+ * settlement or region they fill, so two places with the same parameters differ.
+ * Random events are not cached and draw a new result on every call.
+ */
 UCLASS()
 class DARKAGE_API UProceduralContentGenerator : public UGameInstanceSubsystem
 {
@@ -125,24 +145,24 @@ public:
 
     // Location generation
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    FProceduralLocation GenerateLocation(const FVector& BasePosition, const FString& PreferredType = "");
+    FProceduralLocation GenerateLocation(const FVector& BasePosition, const FString& PreferredType = "", int32 Variant = 0);
 
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    TArray<FProceduralLocation> GenerateRegion(int32 LocationCount, const FVector& Center, float Radius);
+    TArray<FProceduralLocation> GenerateRegion(int32 LocationCount, const FVector& Center, float Radius, const FString& RegionID, int32 Variant = 0);
 
     // Quest generation
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    FProceduralQuest GenerateQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation);
+    FProceduralQuest GenerateQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation, int32 Variant = 0);
 
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    TArray<FProceduralQuest> GenerateQuestChain(int32 ChainLength, const FVector& StartLocation);
+    TArray<FProceduralQuest> GenerateQuestChain(int32 ChainLength, const FVector& StartLocation, int32 Variant = 0);
 
     // NPC generation
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    FProceduralNPC GenerateNPC(const FString& NPCType, int32 PowerLevel);
+    FProceduralNPC GenerateNPC(const FString& NPCType, int32 PowerLevel, int32 Variant = 0);
 
     UFUNCTION(BlueprintCallable, Category = "Procedural")
-    TArray<FProceduralNPC> GenerateSettlementNPCs(int32 NPCCount, const FString& SettlementType);
+    TArray<FProceduralNPC> GenerateSettlementNPCs(int32 NPCCount, const FString& SettlementType, const FString& SettlementID, int32 Variant = 0);
 
     // Event generation
     UFUNCTION(BlueprintCallable, Category = "Procedural")
@@ -158,11 +178,65 @@ public:
     UFUNCTION(BlueprintPure, Category = "Procedural")
     int32 GetCurrentSeed() const { return RandomSeed; }
 
+    UFUNCTION(BlueprintPure, Category = "Procedural")
+    int32 GetNumCachedResults() const { return GenerationCache.Num(); }
+
+    // Write newly generated content to disk now rather than at shutdown
+    UFUNCTION(BlueprintCallable, Category = "Procedural")
+    void FlushGenerationCache();
+
+    // A cache file larger than this is discarded at startup and rebuilt; a cache that fills up during play starts over
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural", meta = (ClampMin = "1"))
+    int32 MaxCacheSizeMB = 64;
+
+    // Quests are generated per grid cell of this size around the player, so nearby positions share a cached result
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Procedural", meta = (ClampMin = "100"))
+    float QuestLocationCellSize = 2000.0f;
+
 private:
+    // Bump whenever generation logic changes so stale cached results are no longer found
+    static constexpr uint32 GeneratorVersion = 3;
+
     // Random generation data
     int32 RandomSeed;
     FRandomStream RandomStream;
 
+    // Random events generated since the seed was set; part of each event key so every call differs
+    int32 EventSequence = 0;
+
+    // Persistent results, keyed by MakeGenerationKey
+    FDAGenerationCache GenerationCache;
+    TArray<uint8> KeyScratch;
+    TArray<uint8> PayloadScratch;
+
+    // Hash of the content templates; part of every key so editing a table invalidates its results
+    uint32 TemplateHash = 0;
+
+    // Key for a generator call: seed, version, templates, generator name and every parameter
+    template <typename... ArgTypes>
+    uint64 MakeGenerationKey(const TCHAR* Generator, ArgTypes... Args);
+
+    // Reseed RandomStream for the call identified by Key
+    void BeginGeneration(uint64 Key);
+
+    template <typename ResultType>
+    bool LoadCachedResult(uint64 Key, ResultType& OutResult) const;
+
+    template <typename ResultType>
+    void StoreResult(uint64 Key, ResultType& Result);
+
+    // Grid cell containing Location, and the point quests for that cell are built from
+    FIntVector GetQuestCell(const FVector& Location) const;
+    FVector GetQuestCellCenter(const FIntVector& Cell) const;
+
+    // Uncached builders; they draw from the stream set up by BeginGeneration
+    FProceduralLocation BuildLocation(const FVector& BasePosition, const FString& PreferredType);
+    FProceduralQuest BuildQuest(const FString& QuestType, int32 Difficulty, const FVector& PlayerLocation);
+
+    // Give a generated or cached quest an ID no other call has returned
+    static void AssignQuestID(FProceduralQuest& Quest);
+    FProceduralNPC BuildNPC(const FString& NPCType, int32 PowerLevel);
+
     // Content templates
     TArray<FString> LocationTypes;
     TArray<FString> LocationFeatures;
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/QuestData.h"
+#include "Core/DAConditionProgram.h"
+
+class UDataTable;
+
+/**
+ * Read-only view over the quest DataTable with secondary indices.
+ *
+ * Built once when the table is loaded (and again if it changes). Every quest row gets a
+ * dense index; region, giver, type and tag lookups return precomputed spans of those
+ * indices, and rows are read in place rather than copied. Stage branch conditions are
+ * compiled into a condition program at the same time.
+ */
+class DARKAGE_API FQuestCatalog
+{
+public:
+    // A stage exit: move to NextStageID if the compiled clause passes
+    struct FStageBranch
+    {
+        FName NextStageID;
+        int32 Clause = INDEX_NONE;
+    };
+
+    void Build(const UDataTable* InQuestDataTable);
+    void Reset();
+
+    const UDataTable* GetSourceTable() const { return SourceTable.Get(); }
+    bool IsBuiltFrom(const UDataTable* Table) const { return Table && SourceTable.Get() == Table; }
+
+    int32 Num() const { return QuestIDs.Num(); }
+
+    // Dense index of a quest, or INDEX_NONE
+    int32 FindQuestIndex(FName QuestID) const;
+
+    FName GetQuestID(int32 QuestIndex) const { return QuestIDs[QuestIndex]; }
+    const FQuestData& GetQuestData(int32 QuestIndex) const { return *Rows[QuestIndex]; }
+
+    // True if availability depends on more than quest state (e.g. required items)
+    bool HasPrerequisites(int32 QuestIndex) const { return RequiresPrerequisiteCheck[QuestIndex]; }
+
+    TConstArrayView<int32> GetQuestsInRegion(FName RegionID) const { return FindSpan(QuestsByRegion, RegionID); }
+    TConstArrayView<int32> GetQuestsFromGiver(FName QuestGiver) const { return FindSpan(QuestsByGiver, QuestGiver); }
+    TConstArrayView<int32> GetQuestsByTag(FName Tag) const { return FindSpan(QuestsByTag, Tag); }
+    TConstArrayView<int32> GetQuestsByType(EQuestType QuestType) const { return FindSpan(QuestsByType, QuestType); }
+
+    // Branches of a quest stage in authored order; false if the quest has no such stage
+    bool FindStageBranches(int32 QuestIndex, FName StageID, TConstArrayView<FStageBranch>& OutBranches) const;
+
+    const FDAConditionProgram& GetConditions() const { return Conditions; }
+
+private:
+    template <typename KeyType>
+    static TConstArrayView<int32> FindSpan(const TMap<KeyType, TArray<int32>>& Index, const KeyType& Key)
+    {
+        const TArray<int32>* Quests = Index.Find(Key);
+        return Quests ? TConstArrayView<int32>(*Quests) : TConstArrayView<int32>();
+    }
+
+    TWeakObjectPtr<const UDataTable> SourceTable;
+
+    TArray<FName> QuestIDs;
+    TArray<const FQuestData*> Rows;
+    TBitArray<> RequiresPrerequisiteCheck;
+    TMap<FName, int32> IndexByQuestID;
+
+    TMap<FName, TArray<int32>> QuestsByRegion;
+    TMap<FName, TArray<int32>> QuestsByGiver;
+    TMap<FName, TArray<int32>> QuestsByTag;
+    TMap<EQuestType, TArray<int32>> QuestsByType;
+
+    struct FCompiledStage
+    {
+        FName StageID;
+        int32 FirstBranch = 0;
+        int32 NumBranches = 0;
+    };
+
+    // Stages of quest i are CompiledStages[FirstStageOfQuest[i] .. FirstStageOfQuest[i + 1])
+    TArray<int32> FirstStageOfQuest;
+    TArray<FCompiledStage> CompiledStages;
+    TArray<FStageBranch> StageBranches;
+    FDAConditionProgram Conditions;
+};
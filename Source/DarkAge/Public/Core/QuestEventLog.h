@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuestEventLog.generated.h"
+
+/**
+ * Enumeration for quest event types
+ */
+UENUM(BlueprintType)
+enum class EQuestEventType : uint8
+{
+	Accepted     UMETA(DisplayName = "Accepted"),
+	Completed    UMETA(DisplayName = "Completed"),
+	Failed       UMETA(DisplayName = "Failed"),
+	Expired      UMETA(DisplayName = "Expired"),
+	ChoiceMade   UMETA(DisplayName = "Choice Made")
+};
+
+/**
+ * Structure representing a quest event log entry
+ */
+USTRUCT(BlueprintType)
+struct FQuestEventLogEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString QuestID = TEXT("");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EQuestEventType EventType = EQuestEventType::Accepted;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString PlayerID = TEXT("");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString ChoiceOrDetail = TEXT("");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Timestamp = 0.0f;
+};
+
+/**
+ * Bounded quest event log.
+ *
+ * Entries are kept in a ring of fixed-size segments. Each segment indexes its own entries
+ * by quest and by event type, so queries only visit matching entries. When the ring is
+ * full, the oldest segment is appended to the spill file (if one is set) and its storage
+ * is reused. Counts are running totals that also include spilled entries. Per-quest counts
+ * are kept until ForgetQuest, so they only grow with the quests that are still live.
+ */
+class DARKAGE_API FQuestEventLog
+{
+public:
+    explicit FQuestEventLog(int32 InSegmentSize = 256, int32 InMaxSegments = 16);
+
+    // Evicted segments are appended here; with no path they are dropped
+    void SetSpillPath(const FString& InSpillPath) { SpillPath = InSpillPath; }
+    const FString& GetSpillPath() const { return SpillPath; }
+
+    void Add(FQuestEventLogEntry&& Entry);
+    void Reset();
+
+    // Drop a finished quest's per-quest counts; its events stay in the totals and in the log
+    void ForgetQuest(const FString& QuestID);
+
+    // Newest entries first, from memory only. An empty QuestID matches every quest.
+    void Query(const FString& QuestID, EQuestEventType EventType, int32 MaxResults, TArray<FQuestEventLogEntry>& OutEntries) const;
+
+    // Total events logged, including spilled ones. An empty QuestID counts every quest; forgotten quests count zero.
+    int32 GetCount(const FString& QuestID, EQuestEventType EventType) const;
+
+    int32 NumResident() const;
+    int64 NumSpilled() const { return SpilledCount; }
+
+    // Read back entries written to a spill file, oldest first
+    static bool LoadSpilledEntries(const FString& Path, TArray<FQuestEventLogEntry>& OutEntries);
+
+    // Move an existing spill file to Name_1.ext, shifting older backups up and deleting the one past MaxBackups
+    static void RotateSpillFile(const FString& Path, int32 MaxBackups);
+
+private:
+    static constexpr int32 NumEventTypes = static_cast<int32>(EQuestEventType::ChoiceMade) + 1;
+
+    struct FEventCounts
+    {
+        int32 Counts[NumEventTypes] = {};
+    };
+
+    struct FSegment
+    {
+        TArray<FQuestEventLogEntry> Entries;
+        TMap<FString, TArray<int32>> EntriesByQuest;
+        TArray<int32> EntriesByType[NumEventTypes];
+
+        void Reset();
+    };
+
+    FSegment& GetSegment(int32 Age) { return Segments[(OldestSegment + Age) % Segments.Num()]; }
+    const FSegment& GetSegment(int32 Age) const { return Segments[(OldestSegment + Age) % Segments.Num()]; }
+
+    FSegment& StartSegment();
+    void SpillSegment(const FSegment& Segment);
+
+    int32 SegmentSize;
+    TArray<FSegment> Segments;
+    int32 OldestSegment = 0;
+    int32 NumSegments = 0;
+
+    FString SpillPath;
+    int64 SpilledCount = 0;
+
+    FEventCounts TotalCounts;
+    TMap<FString, FEventCounts> CountsByQuest;
+};
@@ -4,12 +4,14 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
 #include "Data/QuestData.h"
+#include "Core/QuestCatalog.h"
 #include "QuestManagementSubsystem.generated.h"
 
 // Forward declarations
 class UWorldManagementSubsystem;
 class UDAPlayerStateComponent;
 class UDataTable;
+class UDAQuestLogComponent;
 
 /**
  * Quest Management Subsystem
@@ -133,6 +135,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Quest Management|Data")
     TArray<FName> GetQuestsByTag(const FString& Tag) const;
 
+    // Indexed view of the quest table for native callers; built on first use
+    const FQuestCatalog& GetQuestCatalog() const;
+
     /**
      * Dynamic Quest Generation
      */
@@ -145,7 +150,7 @@ public:
      * World Event Integration
      */
 
-     // Handle world time progression (check time-limited quests)
+     // Handle world time progression (time-limited quests expire through UQuestRuntimeSubsystem)
     UFUNCTION(BlueprintCallable, Category = "Quest Management|World Events")
     void OnWorldTimeUpdate(float CurrentWorldTime);
 
@@ -182,12 +187,35 @@ private:
      // Check if player meets quest prerequisites
     bool CheckQuestPrerequisites(const FQuestData& QuestData) const;
 
-    // Evaluate the conditions for a quest branch
-    bool AreBranchConditionsMet(const FQuestBranch& Branch) const;
-
-    // Check a single quest condition
-    bool CheckQuestCondition(const FQuestCondition& Condition) const;
+    // Player state that compiled branch conditions read, bound to the quest log's character
+    const FDAConditionContext& GetConditionContext(const UDAQuestLogComponent* QuestLog) const;
 
     // Find player's quest log component
     class UDAQuestLogComponent* GetPlayerQuestLog() const;
+
+    // Quest availability uses an indexed catalog of the quest table and one bit per quest
+    // that is set while the player's log has the quest as not started. The bits are seeded
+    // once per quest log and then kept current from the log's state change events, so the
+    // availability queries only visit candidates from the catalog's index spans.
+    void BuildQuestCatalog() const;
+    void HandleQuestDataTableChanged();
+
+    // Returns the not-started bits for the player's quest log, or null if there is no log
+    const TBitArray<>* GetNotStartedQuests() const;
+    void RebuildQuestAvailability(UDAQuestLogComponent* QuestLog) const;
+    void ReleaseQuestLogBinding() const;
+
+    UFUNCTION()
+    void HandleQuestLogStateChanged(FName QuestID, EQuestState NewState);
+
+    bool IsCatalogQuestAvailable(int32 QuestIndex, const TBitArray<>& NotStartedQuests) const;
+    TArray<FName> CollectAvailableQuests(TConstArrayView<int32> Candidates) const;
+
+    mutable FQuestCatalog QuestCatalog;
+    mutable FDelegateHandle QuestDataTableChangedHandle;
+
+    mutable TBitArray<> NotStartedQuests;
+    mutable TWeakObjectPtr<UDAQuestLogComponent> AvailabilityQuestLog;
+
+    mutable FDAConditionContext ConditionContext;
 };
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Core/GlobalEventBus.h"
+#include "QuestObjectiveTrackerSubsystem.generated.h"
+
+// Defined in DynamicQuestSubsystem.h, which includes this header
+struct FQuestObjective;
+enum class EObjectiveType : uint8;
+
+/**
+ * Handle to an objective watch or deadline registered with UQuestObjectiveTrackerSubsystem.
+ * Zero is never a valid handle.
+ */
+struct FQuestTrackingHandle
+{
+    uint64 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+    void Invalidate() { Id = 0; }
+
+    bool operator==(const FQuestTrackingHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FQuestTrackingHandle& Other) const { return Id != Other.Id; }
+};
+
+// Called with the amount reported for a matching gameplay event
+using FQuestObjectiveCallback = TFunction<void(int32 Amount)>;
+
+using FQuestDeadlineCallback = TFunction<void()>;
+
+/**
+ * Objective tracking for quest systems.
+ *
+ * Objectives register a watch on an (event type, target) pair; gameplay code reports kills,
+ * pickups, arrivals and conversations through ReportObjectiveEvent and only the watches for
+ * that exact pair are called. A watch with no target matches every event of its type.
+ * Kills and arrivals come from the global event bus (NPCDied, PlayerEnteredRegion); pickups
+ * and conversations are reported by UInventoryComponent and UDialogueComponent.
+ * Time limits go into a deadline heap, and the tracker only ticks while a deadline is
+ * pending, checking the earliest one. Quests therefore do no work between events.
+ */
+UCLASS()
+class DARKAGE_API UQuestObjectiveTrackerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    static UQuestObjectiveTrackerSubsystem* Get(const UObject* WorldContext);
+
+    // FTickableGameObject interface (only ticks while deadlines are pending)
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return Deadlines.Num() > 0; }
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UQuestObjectiveTrackerSubsystem, STATGROUP_Tickables); }
+
+    /**
+     * Call Callback whenever an event of EventType is reported for Target (or for any
+     * target if Target is None). The watch is dropped once Owner has been destroyed.
+     */
+    FQuestTrackingHandle WatchObjective(UObject* Owner, EObjectiveType EventType, FName Target, FQuestObjectiveCallback Callback);
+
+    // Call Callback once after Delay seconds of unpaused game time
+    FQuestTrackingHandle ScheduleDeadline(UObject* Owner, float Delay, FQuestDeadlineCallback Callback);
+
+    // Cancel a watch or deadline and invalidate the handle; safe to call from inside a callback
+    void Cancel(FQuestTrackingHandle& Handle);
+    void Cancel(TArray<FQuestTrackingHandle>& Handles);
+
+    // Seconds until a deadline fires, or -1 if it isn't scheduled
+    float GetDeadlineRemaining(const FQuestTrackingHandle& Handle) const;
+
+    // Listen for kills and arrivals on EventBus; Initialize binds the game instance's bus
+    void BindEventBus(UGlobalEventBus* InEventBus);
+
+    // Report a gameplay event to the objectives watching it
+    UFUNCTION(BlueprintCallable, Category = "Quest|Tracking")
+    void ReportObjectiveEvent(EObjectiveType EventType, FName Target, int32 Amount = 1);
+
+    UFUNCTION(BlueprintPure, Category = "Quest|Tracking")
+    int32 GetNumWatches() const { return Watches.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Quest|Tracking")
+    int32 GetNumDeadlines() const { return Deadlines.Num(); }
+
+    // The target an objective of this type is tracked against
+    static FName GetObjectiveTarget(const FQuestObjective& Objective);
+
+    // Add progress to an objective; returns true if this completed it
+    static bool ApplyObjectiveProgress(FQuestObjective& Objective, int32 Amount);
+
+private:
+    struct FEventKey
+    {
+        EObjectiveType EventType{};
+        FName Target;
+
+        bool operator==(const FEventKey& Other) const { return EventType == Other.EventType && Target == Other.Target; }
+        friend uint32 GetTypeHash(const FEventKey& Key) { return HashCombine(::GetTypeHash(static_cast<uint8>(Key.EventType)), GetTypeHash(Key.Target)); }
+    };
+
+    struct FWatch
+    {
+        FEventKey Key;
+        TWeakObjectPtr<UObject> Owner;
+        FQuestObjectiveCallback Callback;
+    };
+
+    struct FDeadline
+    {
+        TWeakObjectPtr<UObject> Owner;
+        FQuestDeadlineCallback Callback;
+        double DueTime = 0.0;
+    };
+
+    // Heap entry; cancelled deadlines are left behind and skipped when they reach the top
+    struct FDeadlineEntry
+    {
+        double DueTime = 0.0;
+        uint64 Id = 0;
+    };
+
+    struct FDeadlineOrder
+    {
+        bool operator()(const FDeadlineEntry& A, const FDeadlineEntry& B) const { return A.DueTime < B.DueTime; }
+    };
+
+    UFUNCTION()
+    void HandleGlobalEvent(const FGlobalEvent& Event);
+
+    void UnbindEventBus();
+    void DispatchEvent(const FEventKey& Key, int32 Amount);
+    void RemoveWatch(uint64 WatchId);
+
+    UPROPERTY()
+    TObjectPtr<UGlobalEventBus> EventBus;
+
+    // The bus stores a pointer to this delegate, so it must be unregistered before destruction
+    FOnGlobalEvent GlobalEventDelegate;
+
+    TMap<uint64, FWatch> Watches;
+    TMap<FEventKey, TArray<uint64>> WatchesByEvent;
+
+    TMap<uint64, FDeadline> Deadlines;
+    TArray<FDeadlineEntry> DeadlineHeap;
+
+    // Advances only while deadlines are pending, which is the only time it is read
+    double TrackerTime = 0.0;
+    uint64 NextHandleId = 1;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/DynamicQuestSubsystem.h"
+
+// Which facade subsystem a runtime quest belongs to; quest IDs only need to be unique per source
+enum class EQuestRuntimeSource : uint8
+{
+    Dynamic,    // UDynamicQuestSubsystem
+    Generated,  // UAdvancedQuestGenerationSubsystem
+
+    Count
+};
+
+/**
+ * Handle to a quest in FQuestRuntimeStore. The generation changes every time a slot is
+ * reused, so a handle to a removed quest stays invalid rather than finding its successor.
+ * A default handle is never valid.
+ */
+struct FQuestRuntimeHandle
+{
+    uint32 Index = 0;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Generation != 0; }
+    void Invalidate() { Index = 0; Generation = 0; }
+
+    bool operator==(const FQuestRuntimeHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FQuestRuntimeHandle& Other) const { return !(*this == Other); }
+    friend uint32 GetTypeHash(const FQuestRuntimeHandle& Handle) { return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Generation)); }
+};
+
+struct FQuestRuntimeRecord
+{
+    FDynamicQuest Quest;
+    EQuestRuntimeSource Source = EQuestRuntimeSource::Dynamic;
+
+    // Seconds a completed, failed or expired quest stays readable before it is removed
+    float FinishedRetention = 0.0f;
+
+    // Objective watches and the pending time limit or removal deadline
+    bool bTracked = false;
+    TArray<FQuestTrackingHandle> Watches;
+    FQuestTrackingHandle Deadline;
+};
+
+/**
+ * Slot map holding every dynamic quest in the game.
+ *
+ * Records are packed into one array, so walking all quests touches contiguous memory.
+ * Handles go through a slot table that points at the packed position, and removal moves the
+ * last record into the hole and repoints its slot. Freed slots are reused with a new
+ * generation. Quest IDs are indexed per source so the facades can keep their string IDs.
+ */
+class DARKAGE_API FQuestRuntimeStore
+{
+public:
+    // Returns an invalid handle if Source already has a quest with this ID
+    FQuestRuntimeHandle Add(EQuestRuntimeSource Source, const FDynamicQuest& Quest, float FinishedRetention = 0.0f);
+
+    // Returns false if the handle is stale
+    bool Remove(FQuestRuntimeHandle Handle);
+
+    bool IsValid(FQuestRuntimeHandle Handle) const { return GetRecordIndex(Handle) != INDEX_NONE; }
+
+    FQuestRuntimeRecord* Find(FQuestRuntimeHandle Handle);
+    const FQuestRuntimeRecord* Find(FQuestRuntimeHandle Handle) const;
+
+    FQuestRuntimeHandle FindHandle(EQuestRuntimeSource Source, const FString& QuestID) const;
+
+    // Packed records, in no particular order; removal reorders them
+    TArrayView<FQuestRuntimeRecord> GetRecords() { return Records; }
+    TConstArrayView<FQuestRuntimeRecord> GetRecords() const { return Records; }
+    FQuestRuntimeHandle GetHandle(int32 RecordIndex) const;
+
+    int32 Num() const { return Records.Num(); }
+    int32 Num(EQuestRuntimeSource Source) const { return QuestIndex[static_cast<int32>(Source)].Num(); }
+
+    void Reset();
+
+private:
+    struct FSlot
+    {
+        int32 RecordIndex = INDEX_NONE;
+        uint32 Generation = 0;
+    };
+
+    int32 GetRecordIndex(FQuestRuntimeHandle Handle) const;
+
+    TArray<FQuestRuntimeRecord> Records;
+    TArray<int32> RecordSlots; // Slot index per packed record
+    TArray<FSlot> Slots;
+    TArray<int32> FreeSlots;
+
+    TMap<FString, FQuestRuntimeHandle> QuestIndex[static_cast<int32>(EQuestRuntimeSource::Count)];
+};
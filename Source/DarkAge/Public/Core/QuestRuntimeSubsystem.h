@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Core/QuestRuntimeStore.h"
+#include "QuestRuntimeSubsystem.generated.h"
+
+class UQuestObjectiveTrackerSubsystem;
+
+// A dynamic quest as written to a save game
+USTRUCT(BlueprintType)
+struct FQuestRuntimeSaveRecord
+{
+    GENERATED_BODY()
+
+    // EQuestRuntimeSource
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    uint8 Source = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FDynamicQuest Quest;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float FinishedRetention = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bTracked = false;
+};
+
+enum class EQuestRuntimeEvent : uint8
+{
+    ObjectiveCompleted, // ObjectiveIndex is the objective that just completed
+    Expired,            // The time limit ran out; the quest is already marked expired
+    Removed,            // Sent just before the record is freed
+    Restored            // The quest was loaded from a save
+};
+
+DECLARE_DELEGATE_ThreeParams(FOnQuestRuntimeEvent, FQuestRuntimeHandle /*Handle*/, EQuestRuntimeEvent /*Event*/, int32 /*ObjectiveIndex*/);
+
+/**
+ * Quest Runtime Subsystem
+ *
+ * Owns the state of every dynamic quest. UDynamicQuestSubsystem and
+ * UAdvancedQuestGenerationSubsystem are facades that keep their own generation logic and
+ * Blueprint API, but store quests here and receive lifecycle events through a listener.
+ * Objectives, time limits and the removal of finished quests are all scheduled on
+ * UQuestObjectiveTrackerSubsystem, so no quest system scans its quests on a timer.
+ */
+UCLASS()
+class DARKAGE_API UQuestRuntimeSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Each source has one listener, normally its facade subsystem
+    void SetListener(EQuestRuntimeSource Source, FOnQuestRuntimeEvent Listener);
+    void ClearListener(EQuestRuntimeSource Source);
+
+    // Store a quest; returns an invalid handle if Source already has a quest with this ID
+    FQuestRuntimeHandle AddQuest(EQuestRuntimeSource Source, const FDynamicQuest& Quest, float FinishedRetention);
+
+    // Stop tracking, notify Removed and free the record
+    bool RemoveQuest(FQuestRuntimeHandle Handle);
+
+    FDynamicQuest* FindQuest(FQuestRuntimeHandle Handle);
+    const FDynamicQuest* FindQuest(FQuestRuntimeHandle Handle) const;
+    FQuestRuntimeHandle FindHandle(EQuestRuntimeSource Source, const FString& QuestID) const { return Store.FindHandle(Source, QuestID); }
+
+    // Watch the quest's open objectives, and run down its time limit if it is active
+    void StartTracking(FQuestRuntimeHandle Handle);
+    void StopTracking(FQuestRuntimeHandle Handle);
+
+    // Mark a quest completed or failed and remove it after its retention time
+    void FinishQuest(FQuestRuntimeHandle Handle, EDynamicQuestStatus Status);
+
+    bool AreObjectivesCompleted(FQuestRuntimeHandle Handle) const;
+
+    // Seconds left on an active quest's time limit, or -1 if it isn't running down
+    float GetRemainingTime(FQuestRuntimeHandle Handle) const;
+
+    // Call Func(Handle, Quest) for every quest from Source
+    template <typename FuncType>
+    void ForEachQuest(EQuestRuntimeSource Source, FuncType&& Func) const
+    {
+        const TConstArrayView<FQuestRuntimeRecord> Records = Store.GetRecords();
+        for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+        {
+            if (Records[RecordIndex].Source == Source)
+            {
+                Func(Store.GetHandle(RecordIndex), Records[RecordIndex].Quest);
+            }
+        }
+    }
+
+    int32 GetNumQuests(EQuestRuntimeSource Source) const { return Store.Num(Source); }
+
+    UFUNCTION(BlueprintPure, Category = "Quest|Runtime")
+    int32 GetNumQuests() const { return Store.Num(); }
+
+    /**
+     * Persistence. Every dynamic quest is saved with the player's profile; loading replaces
+     * the current quests, re-registers tracking and sends Restored to each listener.
+     */
+    void SaveQuests(TArray<FQuestRuntimeSaveRecord>& OutRecords) const;
+    void LoadQuests(const TArray<FQuestRuntimeSaveRecord>& Records);
+
+    // True while LoadQuests is removing the current quests and restoring saved ones
+    bool IsLoadingQuests() const { return bLoadingQuests; }
+
+private:
+    void HandleObjectiveEvent(FQuestRuntimeHandle Handle, int32 ObjectiveIndex, int32 Amount);
+    void HandleDeadline(FQuestRuntimeHandle Handle);
+    void ScheduleRemoval(FQuestRuntimeHandle Handle);
+    void Notify(FQuestRuntimeHandle Handle, EQuestRuntimeEvent Event, int32 ObjectiveIndex = INDEX_NONE);
+
+    FQuestRuntimeStore Store;
+    FOnQuestRuntimeEvent Listeners[static_cast<int32>(EQuestRuntimeSource::Count)];
+    bool bLoadingQuests = false;
+
+    UPROPERTY()
+    TObjectPtr<UQuestObjectiveTrackerSubsystem> Tracker;
+};
@@ -9,12 +9,15 @@
 
 class UEconomySubsystem;
 class UFactionManagerSubsystem;
+class UQuestManagementSubsystem;
 
 /**
  * Quest System for Dark Age
  *
  * Manages dynamic quest generation, tracking, and completion.
  * Integrates with faction, economy, and other game systems.
+ * Quest data and acceptance go through UQuestManagementSubsystem and the player's quest log;
+ * this subsystem keeps no quest state of its own.
  */
 UCLASS()
 class DARKAGE_API UQuestSystem : public UGameInstanceSubsystem
@@ -89,16 +92,8 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnObjectiveProgress, FName, QuestID, FName, ObjectiveID, int32, NewProgress);
 	UPROPERTY(BlueprintAssignable, Category = "Quest")
 	FOnObjectiveProgress OnObjectiveProgress;
-
-public:
-	// Get a mutable pointer to a quest data
-	FQuestData* GetMutableQuestData(FName QuestID);
 	
 private:
-	// All quests in the system
-	UPROPERTY()
-	TMap<FName, FQuestData> Quests;
-	
 	// Time since last quest generation check
 	float TimeSinceLastGeneration;
 
@@ -120,9 +115,6 @@ private:
 	// Generate environmental quest
 	FQuestData GenerateEnvironmentalQuest(FName Region, int32 Difficulty);
 	
-	// Check for quest expiration
-	void CheckQuestExpiration();
-	
 	// Generate a unique quest ID
 	FName GenerateUniqueQuestID() const;
 
@@ -131,4 +123,7 @@ private:
 
     UPROPERTY()
     UFactionManagerSubsystem* FactionManagerSubsystem;
+
+    UPROPERTY()
+    UQuestManagementSubsystem* QuestManagementSubsystem;
 };
\ No newline at end of file
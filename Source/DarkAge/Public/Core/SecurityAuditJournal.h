@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+struct FSecurityAuditEvent;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Sparse time index entry: the file offset of every Nth record and its timestamp
+ */
+struct FSecurityAuditCheckpoint
+{
+    int64 Ticks = 0;
+    int64 Offset = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FSecurityAuditCheckpoint& Checkpoint)
+    {
+        return Ar << Checkpoint.Ticks << Checkpoint.Offset;
+    }
+};
+
+/**
+ * Index over one journal segment. Written next to the segment as a sidecar when the
+ * segment is sealed, so opening the journal never has to read the events themselves.
+ */
+struct FSecurityAuditSegmentIndex
+{
+    int32 Sequence = 0;
+    FString Path;
+    int64 Size = 0;
+    int32 NumRecords = 0;
+    int64 MinTicks = MAX_int64;
+    int64 MaxTicks = MIN_int64;
+    int64 CreatedTicks = 0;
+
+    // Bit per ESecurityEventType present in the segment
+    uint32 EventTypeMask = 0;
+
+    TArray<FSecurityAuditCheckpoint> Checkpoints;
+
+    // Record offsets per user, in file order
+    TMap<FString, TArray<int64>> UserOffsets;
+
+    void AddRecord(const FSecurityAuditEvent& Event, int64 Offset);
+    bool Overlaps(int64 StartTicks, int64 EndTicks) const { return NumRecords > 0 && MinTicks <= EndTicks && MaxTicks >= StartTicks; }
+
+    friend FArchive& operator<<(FArchive& Ar, FSecurityAuditSegmentIndex& Index)
+    {
+        return Ar << Index.Sequence << Index.Size << Index.NumRecords << Index.MinTicks << Index.MaxTicks
+            << Index.CreatedTicks << Index.EventTypeMask << Index.Checkpoints << Index.UserOffsets;
+    }
+};
+
+/**
+ * Append-only binary audit journal.
+ * Events are queued by the caller and committed in groups (one write and one flush per batch)
+ * by a background thread. The journal rotates to a new segment file by size or age.
+ */
+class DARKAGE_API FSecurityAuditJournal : public FRunnable
+{
+public:
+    FSecurityAuditJournal();
+    virtual ~FSecurityAuditJournal() override;
+
+    // Load segment indices from Directory and start a fresh segment and the writer thread
+    bool Open(const FString& InDirectory);
+
+    // Commit everything queued, seal the active segment and stop the writer
+    void Close();
+
+    // Queue an event for the next group commit
+    void Append(const FSecurityAuditEvent& Event);
+
+    // Commit queued events on the calling thread
+    void Flush();
+
+    // Events with Start <= Timestamp <= End, in file order; only segments whose type mask intersects EventTypeMask are read
+    void QueryTimeRange(const FDateTime& StartTime, const FDateTime& EndTime, TArray<FSecurityAuditEvent>& OutEvents, uint32 EventTypeMask = MAX_uint32);
+
+    // Events for one user within a time range, read through the per-segment user postings
+    void QueryUser(const FString& UserId, const FDateTime& StartTime, const FDateTime& EndTime, TArray<FSecurityAuditEvent>& OutEvents);
+
+    // Delete sealed segments whose newest event is older than Cutoff; returns the number removed
+    int32 DeleteSegmentsBefore(const FDateTime& Cutoff);
+
+    static uint32 GetEventTypeBit(uint8 EventType) { return 1u << (EventType & 31); }
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    void CommitPending();
+    void OpenNewSegment();
+    void SealActiveSegment();
+    bool ShouldRotate() const;
+
+    bool LoadSegmentIndex(const FString& SegmentPath, FSecurityAuditSegmentIndex& OutIndex) const;
+    bool RebuildSegmentIndex(const FString& SegmentPath, FSecurityAuditSegmentIndex& OutIndex) const;
+
+    // Read records from Offset until one is newer than EndTicks (or MaxRecords have been read)
+    static void ReadRecords(FArchive& Reader, int64 Offset, int64 StartTicks, int64 EndTicks, uint32 EventTypeMask, TArray<FSecurityAuditEvent>& OutEvents, int32 MaxRecords = MAX_int32);
+
+    static void SerializeRecord(TArray<uint8>& OutBytes, const FSecurityAuditEvent& Event);
+    static bool ReadRecord(FArchive& Reader, FSecurityAuditEvent& OutEvent);
+
+    FString Directory;
+
+    // Events waiting for the next group commit
+    TArray<FSecurityAuditEvent> PendingEvents;
+    FCriticalSection PendingCriticalSection;
+
+    // Active segment file; WriteCriticalSection serializes commits from the writer and Flush()
+    TUniquePtr<FArchive> SegmentArchive;
+    FCriticalSection WriteCriticalSection;
+
+    // Sealed segments followed by the active one; guarded by IndexCriticalSection
+    TArray<FSecurityAuditSegmentIndex> Segments;
+    mutable FCriticalSection IndexCriticalSection;
+
+    FRunnableThread* WriterThread = nullptr;
+    FEvent* WriterWakeEvent = nullptr;
+    std::atomic<bool> bStopRequested{false};
+};
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/RingBuffer.h"
+#include "Core/SecurityAuditJournal.h"
 #include "SecurityAuditSubsystem.generated.h"
 
 UENUM(BlueprintType)
@@ -147,6 +149,16 @@ public:
     TArray<FSecurityAuditEvent> SearchSecurityEventsInTimeRange(const FString& SearchTerm,
         ESecurityEventType EventType, const FDateTime& StartTime, const FDateTime& EndTime);
 
+    /**
+     * Get all events for one user (player or admin) in a time range
+     * @param UserId - Exact user ID
+     * @param StartTime - Start of time range
+     * @param EndTime - End of time range
+     * @return The user's events in chronological order
+     */
+    UFUNCTION(BlueprintCallable)
+    TArray<FSecurityAuditEvent> GetUserEvents(const FString& UserId, const FDateTime& StartTime, const FDateTime& EndTime);
+
     /**
      * Generate security report
      * @param Hours - Time period for report
@@ -196,9 +208,11 @@ public:
     bool IsInLockdown() const;
 
 protected:
-    // Event storage
-    UPROPERTY()
-    TArray<FSecurityAuditEvent> SecurityEvents;
+    // Events from the last RECENT_EVENT_HOURS, oldest first; older history is read from the journal
+    TRingBuffer<FSecurityAuditEvent> RecentEvents;
+
+    // Append-only on-disk event store
+    FSecurityAuditJournal Journal;
     
     // Metrics tracking
     UPROPERTY()
@@ -230,6 +244,15 @@ protected:
     // File operations
     bool WriteEventToFile(const FSecurityAuditEvent& Event);
     bool LoadEventsFromFile();
+
+    // Index of the first cached event at or after Time (binary search over RecentEvents)
+    int32 FindFirstRecentEvent(const FDateTime& Time) const;
+
+    // Oldest time RecentEvents is guaranteed to cover
+    FDateTime GetRecentEventsHorizon() const;
+
+    // Events in [StartTime, EndTime] whose type bit is in EventTypeMask, from the cache when it covers the range
+    void CollectEvents(const FDateTime& StartTime, const FDateTime& EndTime, uint32 EventTypeMask, TArray<FSecurityAuditEvent>& OutEvents);
     
     // Utility functions
     FString GenerateEventId();
@@ -244,6 +267,7 @@ protected:
     
     // Configuration
     static constexpr int32 MAX_STORED_EVENTS = 100000;
+    static constexpr int32 RECENT_EVENT_HOURS = 24;
     static constexpr int32 EVENT_RETENTION_DAYS = 90;
     static constexpr float PROCESS_INTERVAL = 1.0f;
     static constexpr float CLEANUP_INTERVAL = 3600.0f; // 1 hour
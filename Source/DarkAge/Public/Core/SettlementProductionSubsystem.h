@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Core/DAProductionBatch.h"
+#include "Data/NPCEcosystemData.h"
+#include "SettlementProductionSubsystem.generated.h"
+
+class UDataTable;
+class UEconomySubsystem;
+class UCraftingRecipeDatabase;
+class UAdvancedResourceChainSubsystem;
+
+// A gathering recipe with no inputs: workers turn time alone into a raw good
+USTRUCT(BlueprintType)
+struct FSettlementExtractionRecipe
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Production")
+    FName RecipeID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Production")
+    FName OutputItemID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Production", meta = (ClampMin = "1"))
+    int32 OutputQuantity = 1;
+
+    // Seconds one worker takes per run
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Production", meta = (ClampMin = "0.1"))
+    float CycleSeconds = 60.0f;
+};
+
+/**
+ * Runs off-screen NPC crafting and resource-chain production for every settlement in
+ * batched steps, and feeds the resulting stock changes into the settlement region's supply
+ * in UEconomySubsystem.
+ *
+ * Recipes come from ExtractionRecipes, from UCraftingRecipeDatabase, compiled once it has
+ * loaded, and from UAdvancedResourceChainSubsystem. Extraction recipes need no inputs, so
+ * they are what gets a fresh settlement producing; crafting recipes then use their output. Settlements only assign a worker count to each recipe,
+ * so the cost of a step grows with settlements and recipes, not with workers.
+ * UNPCEcosystemSubsystem registers its settlements here and turns resident professions into
+ * workers through ProfessionRecipes.
+ */
+UCLASS(Config=Game, DefaultConfig)
+class DARKAGE_API USettlementProductionSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface (only ticks while settlements are registered)
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return Production.NumSettlements() > 0; }
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(USettlementProductionSubsystem, STATGROUP_Tickables); }
+
+    // Add a settlement whose output feeds RegionID's market; re-registering moves it to RegionID
+    UFUNCTION(BlueprintCallable, Category = "Economy|Production")
+    void RegisterSettlement(FName SettlementID, FName RegionID);
+
+    /**
+     * Assign Workers NPCs in a settlement to a recipe, replacing any earlier assignment.
+     * Assignments to crafting recipes that are still streaming in are applied once they load.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Economy|Production")
+    bool SetRecipeWorkers(FName SettlementID, FName RecipeID, int32 Workers);
+
+    // Set every ProfessionRecipes recipe's workers to the settlement's residents of that profession
+    void SetProfessionWorkers(FName SettlementID, const TMap<ENPCProfession, int32>& ProfessionCounts);
+
+    // Register an input-free recipe; returns false if its ID is already taken
+    UFUNCTION(BlueprintCallable, Category = "Economy|Production")
+    bool AddExtractionRecipe(const FSettlementExtractionRecipe& Recipe);
+
+    // Market that settlement output feeds; Initialize binds the game instance's economy
+    void BindEconomy(UEconomySubsystem* InEconomy);
+
+    UFUNCTION(BlueprintCallable, Category = "Economy|Production")
+    void AddSettlementStock(FName SettlementID, FName ItemID, int32 Quantity);
+
+    UFUNCTION(BlueprintPure, Category = "Economy|Production")
+    int32 GetSettlementStock(FName SettlementID, FName ItemID) const;
+
+    // Run one production step now, regardless of the interval
+    UFUNCTION(BlueprintCallable, Category = "Economy|Production")
+    void SimulateStep(float DeltaSeconds);
+
+    // Seconds of game time between production steps
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy|Production", meta = (ClampMin = "0.1"))
+    float SimulationInterval = 10.0f;
+
+    // Crafting recipes carry no duration; this is how long one worker takes per craft
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy|Production", meta = (ClampMin = "0.1"))
+    float CraftingCycleSeconds = 60.0f;
+
+    // Loaded into UCraftingRecipeDatabase on startup, so settlements don't wait for a crafter to ask for it
+    UPROPERTY(Config, EditAnywhere, Category = "Economy|Production")
+    TSoftObjectPtr<UDataTable> CraftingRecipesTable;
+
+    // Input-free recipes registered on startup
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Economy|Production")
+    TArray<FSettlementExtractionRecipe> ExtractionRecipes;
+
+    // The recipe each working profession produces; professions without an entry don't produce anything
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Economy|Production")
+    TMap<ENPCProfession, FName> ProfessionRecipes;
+
+private:
+    UFUNCTION()
+    void HandleCraftingRecipesLoaded();
+
+    void CompileResourceChainRecipes();
+    void CompileCraftingRecipes();
+    void ApplyPendingWorkers();
+
+    struct FPendingWorkers
+    {
+        FName SettlementID;
+        FName RecipeID;
+        int32 Workers = 0;
+    };
+
+    FDAProductionBatch Production;
+    TArray<FPendingWorkers> PendingWorkers;
+    TArray<FDAProductionBatch::FStockChange> StockChanges;
+    float TimeSinceLastStep = 0.0f;
+
+    UPROPERTY()
+    TObjectPtr<UEconomySubsystem> Economy;
+
+    UPROPERTY()
+    TObjectPtr<UCraftingRecipeDatabase> CraftingRecipes;
+
+    UPROPERTY()
+    TObjectPtr<UAdvancedResourceChainSubsystem> ResourceChains;
+};
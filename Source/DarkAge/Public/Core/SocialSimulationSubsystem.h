@@ -136,9 +136,21 @@ public:
     FOnSocialEventTriggered OnSocialEventTriggered;
 
 protected:
-    // Relationship storage (Character1ID_Character2ID -> Relationship)
+    // Relationship storage (packed pair of interned character indices -> Relationship)
     UPROPERTY(VisibleAnywhere, Category = "Social Data")
-    TMap<FString, FSocialRelationship> CharacterRelationships;
+    TMap<uint64, FSocialRelationship> CharacterRelationships;
+
+    // Interned character IDs; relationships and indices below refer to characters by index
+    UPROPERTY(VisibleAnywhere, Category = "Social Data")
+    TArray<FString> CharacterIDs;
+
+    TMap<FString, int32> CharacterIndexByID;
+
+    // Adjacency index: characters each character has a relationship with
+    TArray<TArray<int32>> CharacterNeighbours;
+
+    // Relationship part of each character's influence score, kept current on every strength change
+    TArray<float> CharacterRelationshipInfluence;
 
     // Faction storage
     UPROPERTY(VisibleAnywhere, Category = "Social Data")
@@ -160,9 +172,17 @@ protected:
     TArray<FSocialEvent> RecentSocialEvents;
 
     // Configuration
+    // Strength lost per idle day once the grace period has passed; applied lazily on read
     UPROPERTY(EditAnywhere, Category = "Social Simulation Config")
     float RelationshipDecayRate = 1.0f;
 
+    UPROPERTY(EditAnywhere, Category = "Social Simulation Config")
+    float RelationshipDecayGracePeriod = 86400.0f; // 24 hours
+
+    // Characters whose relationships are compacted per background pass
+    UPROPERTY(EditAnywhere, Category = "Social Simulation Config")
+    int32 DecayCompactionBatchSize = 256;
+
     UPROPERTY(EditAnywhere, Category = "Social Simulation Config")
     float EventPropagationSpeed = 100.0f;
 
@@ -180,14 +200,21 @@ protected:
 
 private:
     // Helper functions
-    FString GetRelationshipKey(const FString& Character1ID, const FString& Character2ID) const;
-    void ProcessRelationshipDecay(float DeltaTime);
+    int32 InternCharacter(const FString& CharacterID);
+    int32 FindCharacterIndex(const FString& CharacterID) const;
+    const FSocialRelationship* FindRelationship(int32 CharacterIndex1, int32 CharacterIndex2) const;
+    void SetRelationshipStrength(int32 CharacterIndex1, int32 CharacterIndex2, FSocialRelationship& Relationship, float NewStrength);
+    static uint64 GetRelationshipKey(int32 CharacterIndex1, int32 CharacterIndex2);
+    float GetCurrentTime() const;
+    float GetDecayedStrength(const FSocialRelationship& Relationship, float CurrentTime) const;
+    void CompactRelationshipDecay();
     void CleanupOldEvents();
     void ApplyEventToRelationship(const FSocialEvent& Event, const FString& Character1ID, const FString& Character2ID);
 
     // Event processing timer
     float LastEventCleanupTime;
     float LastRelationshipDecayTime;
+    int32 DecayCompactionCursor = 0;
 
     // System event broadcast stub
     void BroadcastSystemEvent(FName EventType, const FString& EventData);
@@ -58,6 +58,12 @@ struct FGameDateTime
 		return (Year * 360) + ((Month - 1) * 30) + Day;
 	}
 	
+	// Get total minutes (packed, monotonic timestamp for ordering and elapsed-time math)
+	int32 GetTotalMinutes() const
+	{
+		return (GetTotalDays() * 24 * 60) + (Hour * 60) + Minute;
+	}
+	
 	// Get day of year (1-360)
 	int32 GetDayOfYear() const
 	{
@@ -203,6 +209,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Time")
 	TArray<FString> GetUpcomingEvents(int32 DaysAhead) const;
 	
+	// Events that haven't fired yet; fired events are removed
+	UFUNCTION(BlueprintPure, Category = "Time")
+	int32 GetNumCalendarEvents() const { return CalendarEvents.Num(); }
+	
+	// Delegate fired when the clock reaches a calendar event
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCalendarEvent, FName, EventType, const FString&, EventDescription);
+	UPROPERTY(BlueprintAssignable, Category = "Time")
+	FOnCalendarEvent OnCalendarEvent;
+	
 	// Delegate for time change events
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimeChanged, const FGameDateTime&, NewTime);
 	UPROPERTY(BlueprintAssignable, Category = "Time")
@@ -234,15 +249,28 @@ private:
 	UPROPERTY()
 	TMap<FString, FString> CalendarEventData;
 	
-	// Calendar events map for runtime use
-	TMap<FString, TPair<FGameDateTime, FString>> CalendarEvents;
+	struct FCalendarEntry
+	{
+		// FGameDateTime::GetTotalMinutes of the event
+		int32 Timestamp;
+		FName EventType;
+		FGameDateTime EventTime;
+		FString Description;
+	};
+	
+	// Pending calendar events sorted by timestamp; events with the same timestamp keep insertion order
+	TArray<FCalendarEntry> CalendarEvents;
+	
+	// Index of the first event that hasn't fired yet; everything before it is in the past and removed at the next check
+	int32 NextEventIndex;
+	
+	// Index of the first event with a timestamp >= Timestamp (or > Timestamp for the upper bound)
+	int32 LowerBoundEvent(int32 Timestamp) const;
+	int32 UpperBoundEvent(int32 Timestamp) const;
 	
 	// Update season based on current date
 	void UpdateSeason();
 	
 	// Check for and trigger calendar events
 	void CheckCalendarEvents();
-	
-	// Convert game time to a unique string key for the calendar
-	FString DateTimeToString(const FGameDateTime& DateTime) const;
 };
\ No newline at end of file
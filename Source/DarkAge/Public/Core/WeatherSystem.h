@@ -12,6 +12,9 @@ class DARKAGE_API UWeatherSystem : public UGameInstanceSubsystem
     GENERATED_BODY()
 
 public:
+    // Temperature at startup, in °F like every temperature the weather system publishes
+    static constexpr float DefaultTemperature = 70.0f;
+
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
@@ -24,12 +27,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Weather")
     void SetWeather(EWeatherType NewWeather);
 
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void SetTemperature(float NewTemperature);
+
     UFUNCTION(BlueprintCallable, Category = "Weather|GAS")
     void ApplyWeatherEffectsToCharacter(AActor* Character);
 
 private:
     void UpdateWeather();
 
+    // Push the current weather to UEnvironmentalFieldSubsystem subscribers
+    void PublishEnvironmentalFactors();
+
     UPROPERTY()
     EWeatherType CurrentWeather;
 
@@ -66,6 +66,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "World Management|Regions")
     FRegionData GetRegionData(const FString& RegionID) const;
 
+    // Native access to a region's row without copying it; null if the region is unknown
+    const FRegionData* FindRegionData(const FString& RegionID) const;
+
     UFUNCTION(BlueprintPure, Category = "World Management|Regions")
     TMap<FName, FVector> GetPointsOfInterest(const FString& RegionID) const;
 
@@ -2,10 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Containers/RingBuffer.h"
 #include "Data/RegionState.h"
 #include "Core/TimeSystem.h"
 #include "Core/GlobalEventBus.h"
 #include "Core/WorldStateLock.h"
+#include <atomic>
 #include "WorldPersistenceSystem.generated.h"
 
 UENUM(BlueprintType)
@@ -81,9 +84,43 @@ struct FWorldEventLogEntry
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWorldStateChanged, FName, RegionID, const FRegionState&, NewState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnWorldEvent, FName, EventType, FName, RegionID, const FString&, Description);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWorldCatchUpProgress, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWorldCatchUpFinished, bool, bWasCancelled);
+
+/**
+ * Running totals of player actions recorded in a region.
+ * Maintained incrementally on record/evict so region updates never scan the action history.
+ */
+struct FRegionImpactAggregate
+{
+    int32 ActionCount = 0;
+    float TotalMagnitude = 0.0f;
+
+    // Exponentially decayed sum of magnitudes, valid as of LastDecayMinute
+    float DecayedImpact = 0.0f;
+    int32 LastDecayMinute = 0;
+};
+
+/**
+ * Working state for one region during a fast-forward catch-up.
+ * Each region is advanced independently, so these are processed in parallel.
+ */
+struct FRegionCatchUpState
+{
+    FName RegionID = NAME_None;
+    float PlayerImpact = 0.0f;
+    float CrimeHeatLevel = 0.0f;
+
+    // Per-region stream so parallel steps are deterministic for a given seed
+    FRandomStream RandomStream;
+
+    // Ring of the most recent event types; older ones would be trimmed from the region anyway
+    TArray<FName> RecentEventTypes;
+    int32 TotalEvents = 0;
+};
 
 UCLASS()
-class DARKAGE_API UWorldPersistenceSystem : public UGameInstanceSubsystem
+class DARKAGE_API UWorldPersistenceSystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
     GENERATED_BODY()
 
@@ -93,6 +130,11 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
+    // FTickableGameObject interface (only ticks while a catch-up is in progress)
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return bCatchUpInProgress; }
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UWorldPersistenceSystem, STATGROUP_Tickables); }
+
     // Ticking/update for persistence simulation
     void UpdateWorldPersistence(float DeltaTime);
 
@@ -109,6 +151,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Persistence")
     void SimulateWorldEvolution(int32 GameMinutes);
 
+    // Fast-forward catch-up for long offline periods. Integrates decay in closed form over
+    // coarse (one game day) steps, advances regions in parallel and spreads the work over frames.
+    UFUNCTION(BlueprintCallable, Category = "Persistence")
+    bool BeginWorldCatchUp(int32 GameMinutes, int32 Seed = 0);
+
+    UFUNCTION(BlueprintCallable, Category = "Persistence")
+    void CancelWorldCatchUp();
+
+    UFUNCTION(BlueprintPure, Category = "Persistence")
+    bool IsWorldCatchUpInProgress() const { return bCatchUpInProgress; }
+
+    UFUNCTION(BlueprintPure, Category = "Persistence")
+    float GetWorldCatchUpProgress() const;
+
     // Region insights
     UFUNCTION(BlueprintPure, Category = "Persistence")
     TArray<FString> GetRecentRegionalEvents(FName RegionID, int32 Count = 5) const;
@@ -116,6 +172,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Persistence")
     float GetPlayerRegionalImpact(FName RegionID) const;
 
+    // Player impact weighted towards recent actions (halves every game day)
+    UFUNCTION(BlueprintPure, Category = "Persistence")
+    float GetRecentPlayerRegionalImpact(FName RegionID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Persistence")
+    int32 GetPlayerActionCount(FName RegionID) const;
+
     // Save/Load world state (single file)
     UFUNCTION(BlueprintCallable, Category = "Persistence")
     bool SaveWorldState();
@@ -140,12 +203,24 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Persistence")
     FOnWorldEvent OnWorldEvent;
 
+    UPROPERTY(BlueprintAssignable, Category = "Persistence")
+    FOnWorldCatchUpProgress OnWorldCatchUpProgress;
+
+    UPROPERTY(BlueprintAssignable, Category = "Persistence")
+    FOnWorldCatchUpFinished OnWorldCatchUpFinished;
+
 private:
     // Internal helpers
     FString GetWorldStateSavePath() const;
     void ProcessPlayerActions();
+    void AddPlayerAction(const FWorldAction& Action);
+    void EvictOldestPlayerAction();
+    int32 GetCurrentGameMinute() const;
     void UpdateRegion(FName RegionID, float DeltaTime);
     void GenerateRandomEvent(FName RegionID);
+    void RecordRegionEvent(FName RegionID, FName EventType, const FString& EventDescription);
+    void AdvanceCatchUpStep(int32 CyclesInStep);
+    void FinishWorldCatchUp(bool bWasCancelled);
     void ApplyActionEffects(const FWorldAction& Action);
     void SimulateNPCActions(float DeltaTime);
     void SimulateFactionDynamics(float DeltaTime);
@@ -157,9 +232,14 @@ private:
     UPROPERTY()
     TMap<FName, FRegionState> RegionStates;
 
-    // Recorded player actions
-    UPROPERTY()
-    TArray<FWorldAction> PlayerActions;
+    // Recorded player actions, oldest first; bounded so the oldest entry is evicted in O(1)
+    TRingBuffer<FWorldAction> PlayerActions;
+
+    // Actions at the back of PlayerActions that ProcessPlayerActions has not applied yet
+    int32 NumPendingPlayerActions = 0;
+
+    // Per-region running aggregates over PlayerActions
+    TMap<FName, FRegionImpactAggregate> RegionImpact;
 
     // Event log
     UPROPERTY()
@@ -181,4 +261,14 @@ private:
 
     // Current save/load lock
     FGuid CurrentSaveLockID;
+
+    // When the loaded world state was saved; zero if unknown
+    FDateTime LastSavedUtc;
+
+    // Fast-forward catch-up state
+    TArray<FRegionCatchUpState> CatchUpRegions;
+    int32 CatchUpTotalCycles = 0;
+    int32 CatchUpCompletedCycles = 0;
+    bool bCatchUpInProgress = false;
+    std::atomic<bool> bCatchUpCancelRequested { false };
 };
\ No newline at end of file
@@ -4,6 +4,62 @@
 #include "Engine/DataTable.h"
 #include "DialogueData.generated.h"
 
+UENUM(BlueprintType)
+enum class EDialogueMood : uint8
+{
+    Neutral     UMETA(DisplayName = "Neutral"),
+    Friendly    UMETA(DisplayName = "Friendly"),
+    Angry       UMETA(DisplayName = "Angry"),
+    Suspicious  UMETA(DisplayName = "Suspicious"),
+    Fearful     UMETA(DisplayName = "Fearful"),
+    Excited     UMETA(DisplayName = "Excited")
+};
+
+USTRUCT(BlueprintType)
+struct FDialogueLine
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    FString SpeakerName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    FString Text;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    EDialogueMood Mood;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    TArray<FString> Responses;
+
+    FDialogueLine()
+    {
+        SpeakerName = TEXT("");
+        Text = TEXT("");
+        Mood = EDialogueMood::Neutral;
+    }
+};
+
+USTRUCT(BlueprintType)
+struct FDialogueTree
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    FString TreeID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    TArray<FDialogueLine> Lines;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
+    TMap<FString, FString> Conditions; // Key: Condition, Value: NextTreeID
+
+    FDialogueTree()
+    {
+        TreeID = TEXT("");
+    }
+};
+
 USTRUCT(BlueprintType)
 struct FDialogueOption
 {
@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
 #include "Data/EnvironmentalFactorsData.h"
+#include "Core/DATimerWheelSubsystem.h"
 #include "DiseaseData.generated.h"
 
 // Forward declarations
@@ -188,6 +189,13 @@ struct DARKAGE_API FActiveDiseaseInstance
    
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Disease Instance")
     bool bIsContagious;
+
+    // Row resolved from DiseaseDataRowHandle at infection time
+    const FDiseaseData* DiseaseData;
+
+    // Next incubation/stage transition and pending detection rolls on UDATimerWheelSubsystem
+    FDATimerHandle StageTimer;
+    FDATimerHandle DetectionTimer;
    
     FActiveDiseaseInstance()
     	: CurrentStage(0)
@@ -198,6 +206,7 @@ struct DARKAGE_API FActiveDiseaseInstance
     	, bIsDetected(false)
     	, bIsActive(true)
     	, bIsContagious(false)
+    	, DiseaseData(nullptr)
     {
     }
 
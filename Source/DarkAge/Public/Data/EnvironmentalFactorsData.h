@@ -267,6 +267,7 @@ struct DARKAGE_API FEnvironmentalFactors
     {
     }
 
+    // °F
     UPROPERTY(BlueprintReadWrite, Category = "Environmental Factors")
     float AirTemperature;
 
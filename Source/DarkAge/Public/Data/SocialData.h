@@ -49,6 +49,7 @@ struct DARKAGE_API FSocialRelationship
         , Fear(0.0f)
         , Attraction(0.0f)
         , LastInteractionTime(0.0f)
+        , LastDecayTime(0.0f)
         , InteractionCount(0)
         , bIsPublicRelationship(true)
     {
@@ -82,6 +83,10 @@ struct DARKAGE_API FSocialRelationship
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Relationship")
     float LastInteractionTime;
 
+    // When RelationshipStrength was last brought up to date with idle decay
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Relationship")
+    float LastDecayTime;
+
     // Number of interactions between these characters
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Relationship")
     int32 InteractionCount;
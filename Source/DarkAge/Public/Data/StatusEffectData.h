@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
 #include "Core/DAStatusEffectBehavior.h"
+#include "Core/DATimerWheelSubsystem.h"
 #include "StatusEffectData.generated.h"
 
 /**
@@ -226,8 +227,8 @@ struct DARKAGE_API FActiveStatusEffect
     GENERATED_BODY()
 
     FActiveStatusEffect()
-        // : EffectData(nullptr) // MODIFIED: Initialization changes with FDataTableRowHandle
-        : EffectID()
+        : EffectData(nullptr)
+        , EffectID()
         , CurrentStacks(1)
         , RemainingDuration(0.0f)
         , LastTickTime(0.0f)
@@ -242,6 +243,9 @@ struct DARKAGE_API FActiveStatusEffect
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect Instance")
     FDataTableRowHandle EffectDataRowHandle;
 
+    // Row resolved from EffectDataRowHandle when the effect is applied
+    const FStatusEffectData* EffectData;
+
     // ID of the effect for quick lookup
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect Instance")
     FName EffectID; // You might want to get this from the RowHandle's RowName after it's set
@@ -269,6 +273,10 @@ struct DARKAGE_API FActiveStatusEffect
     // Whether this effect is currently active
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect Instance")
     bool bIsActive;
+
+    // Expiry and periodic tick timers on UDATimerWheelSubsystem
+    FDATimerHandle ExpiryTimer;
+    FDATimerHandle PeriodicTimer;
 };
 
 /**
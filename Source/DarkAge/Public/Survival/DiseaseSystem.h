@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "Data/DiseaseData.h"
 #include "DiseaseSystem.generated.h"
 
+class UDiseaseManagementComponent;
+
 /**
  * @brief Disease System for Dark Age.
  *
@@ -16,7 +19,7 @@
  * @see [API Doc](../../../docs/api/DiseaseSystem.md)
  */
 UCLASS()
-class DARKAGE_API UDiseaseSystem : public UGameInstanceSubsystem
+class DARKAGE_API UDiseaseSystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -36,6 +39,27 @@ public:
 	 */
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject interface (runs the contagion pass while hosts are registered)
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return ContagionHosts.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDiseaseSystem, STATGROUP_Tickables); }
+
+	/**
+	 * Add a host to the contagion pass. Called by UDiseaseManagementComponent on BeginPlay.
+	 */
+	void RegisterContagionHost(UDiseaseManagementComponent* Host);
+
+	/**
+	 * Remove a host from the contagion pass
+	 */
+	void UnregisterContagionHost(UDiseaseManagementComponent* Host);
+
+	/**
+	 * Reseed the transmission rolls, e.g. to replay an outbreak
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Disease")
+	void SetContagionSeed(int32 Seed);
+
 	/**
 	 * Update disease system
 	 */
@@ -107,6 +131,17 @@ private:
 	// Time since last disease update
 	float TimeSinceLastUpdate;
 	
+	// Seconds between contagion passes
+	static constexpr float CONTAGION_INTERVAL = 1.0f;
+	
+	// Hosts with a disease component, in registration order
+	TArray<TWeakObjectPtr<UDiseaseManagementComponent>> ContagionHosts;
+	
+	// Drives every transmission roll so a pass is reproducible from its seed
+	FRandomStream ContagionRandomStream;
+	
+	float TimeSinceContagionPass;
+	
 	// Update disease progression for a character
 	void UpdateDiseaseProgression(AActor* Character, float DeltaTime);
 	
@@ -116,7 +151,7 @@ private:
 	// Apply disease effects to character
 	void ApplyDiseaseEffects(AActor* Character, const FDiseaseData& DiseaseData, const FActiveDiseaseInstance& ActiveDisease);
 	
-	// Check for disease transmission between characters
+	// Grid-bucketed transmission between registered hosts; infections are applied as one batch at the end
 	void CheckDiseaseTransmission(float DeltaTime);
 	
 	// Update regional disease outbreaks
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the shared crafting recipe database and its reverse indices
+
+#include "Misc/AutomationTest.h"
+#include "Core/CraftingRecipeDatabase.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCraftingRecipeDatabaseTest, "DarkAge.Crafting.RecipeDatabase", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCraftingRecipeDatabaseTest::RunTest(const FString& Parameters)
+{
+    UDataTable* Table = NewObject<UDataTable>();
+    Table->RowStruct = FCraftingRecipe::StaticStruct();
+
+    auto AddRecipe = [Table](FName RecipeID, FName OutputItemID, TArray<FCraftingIngredient> Ingredients, FName SkillID)
+    {
+        FCraftingRecipe Recipe;
+        Recipe.OutputItemID = OutputItemID;
+        Recipe.Ingredients = MoveTemp(Ingredients);
+        Recipe.RequiredSkillID = SkillID;
+        Table->AddRow(RecipeID, Recipe);
+    };
+
+    FCraftingIngredient Wood;
+    Wood.ItemID = TEXT("Wood");
+    Wood.Quantity = 2;
+    FCraftingIngredient Iron;
+    Iron.ItemID = TEXT("Iron");
+    Iron.Quantity = 1;
+
+    AddRecipe(TEXT("Torch"), TEXT("Torch"), { Wood }, NAME_None);
+    AddRecipe(TEXT("Axe"), TEXT("Axe"), { Wood, Iron }, TEXT("Smithing"));
+    AddRecipe(TEXT("Nails"), TEXT("Nails"), { Iron }, TEXT("Smithing"));
+
+    UCraftingRecipeDatabase* Database = NewObject<UCraftingRecipeDatabase>();
+    TestFalse(TEXT("Not loaded before a build"), Database->IsLoaded());
+
+    Database->BuildFromTable(Table);
+    TestTrue(TEXT("Loaded after a build"), Database->IsLoaded());
+    TestEqual(TEXT("Every row indexed"), Database->GetNumRecipes(), 3);
+
+    const int32 Axe = Database->FindRecipe(TEXT("Axe"));
+    TestTrue(TEXT("Recipe found by ID"), Axe != INDEX_NONE);
+    TestEqual(TEXT("Index maps back to its ID"), Database->GetRecipeID(Axe), FName(TEXT("Axe")));
+    TestEqual(TEXT("Ingredients are flattened per recipe"), Database->GetIngredients(Axe).Num(), 2);
+    TestEqual(TEXT("Unknown recipes are not found"), Database->FindRecipe(TEXT("Missing")), static_cast<int32>(INDEX_NONE));
+
+    TestEqual(TEXT("Wood is used by two recipes"), Database->GetRecipesUsingIngredient(TEXT("Wood")).Num(), 2);
+    TestEqual(TEXT("Iron is used by two recipes"), Database->GetRecipesUsingIngredient(TEXT("Iron")).Num(), 2);
+    TestFalse(TEXT("Outputs are not ingredients"), Database->IsIngredient(TEXT("Torch")));
+    TestEqual(TEXT("Smithing gates two recipes"), Database->GetRecipesForSkill(TEXT("Smithing")).Num(), 2);
+    TestEqual(TEXT("Unknown skills gate nothing"), Database->GetRecipesForSkill(TEXT("Alchemy")).Num(), 0);
+
+    return true;
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for compiled quest and dialogue conditions
+
+#include "Misc/AutomationTest.h"
+#include "Core/DAConditionProgram.h"
+#include "Core/DAStatLayout.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDAConditionProgramTest, "DarkAge.Conditions.Program", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDAConditionProgramTest::RunTest(const FString& Parameters)
+{
+    FDAConditionProgram Program;
+    FDAConditionContext NoPlayer;
+
+    const int32 Unconditional = Program.CompileClause(TConstArrayView<FQuestCondition>());
+    TestTrue(TEXT("Branches without conditions always pass"), Program.Evaluate(Unconditional, NoPlayer));
+
+    FQuestCondition NeedsSkill;
+    NeedsSkill.ConditionType = EQuestConditionType::QCT_SkillLevel;
+    NeedsSkill.TargetID = FName("Smithing");
+    NeedsSkill.Operator = EComparisonOperator::CO_GreaterThanOrEqualTo;
+    NeedsSkill.Value = 10;
+
+    FQuestCondition NeedsQuest;
+    NeedsQuest.ConditionType = EQuestConditionType::QCT_QuestCompleted;
+    NeedsQuest.TargetID = FName("Q_Intro");
+    NeedsQuest.Value = 1;
+
+    const int32 Gated = Program.CompileClause({ NeedsSkill, NeedsQuest });
+    TestEqual(TEXT("One instruction per condition"), Program.NumInstructions(), 2);
+    TestTrue(TEXT("Stat names are resolved to layout indices at compile time"), FDAStatLayout::Get().FindStatIndex(FName("Smithing")) != INDEX_NONE);
+    TestFalse(TEXT("Player conditions fail without a player"), Program.Evaluate(Gated, NoPlayer));
+
+    const int32 DialogueKey = Program.CompileDialogueCondition(TEXT("HasQuest"));
+    TestTrue(TEXT("Placeholder dialogue keys pass"), Program.Evaluate(DialogueKey, NoPlayer));
+    TestFalse(TEXT("Unknown clauses fail"), Program.Evaluate(Program.NumClauses(), NoPlayer));
+
+    return true;
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the persistent procedural generation cache
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Core/DAGenerationCache.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDAGenerationCacheTest, "DarkAge.Procedural.GenerationCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDAGenerationCacheTest::RunTest(const FString& Parameters)
+{
+    const FString Path = FPaths::AutomationTransientDir() / TEXT("GenerationCacheTest.bin");
+    IFileManager::Get().Delete(*Path);
+
+    const TArray<uint8> KeyA = { 1, 2, 3 };
+    const TArray<uint8> KeyB = { 1, 2, 4 };
+    const uint64 A = FDAGenerationCache::MakeKey(KeyA);
+    const uint64 B = FDAGenerationCache::MakeKey(KeyB);
+    TestNotEqual(TEXT("Different inputs give different keys"), A, B);
+    TestEqual(TEXT("Keys are stable"), FDAGenerationCache::MakeKey(KeyA), A);
+
+    const TArray<uint8> PayloadA = { 10, 20, 30, 40 };
+    const TArray<uint8> PayloadB = { 50 };
+
+    {
+        FDAGenerationCache Cache;
+        Cache.Open(Path);
+        TestEqual(TEXT("New store is empty"), Cache.Num(), 0);
+
+        Cache.Add(A, PayloadA);
+        Cache.Add(A, PayloadB);
+        TestEqual(TEXT("First payload for a key wins"), Cache.Find(A).Num(), PayloadA.Num());
+        TestTrue(TEXT("Store written"), Cache.Flush());
+
+        // Appending after a flush only writes the new record
+        Cache.Add(B, PayloadB);
+        TestEqual(TEXT("Only the new record is pending"), Cache.GetNumPendingBytes(), static_cast<int64>(sizeof(uint64) + sizeof(int32) + PayloadB.Num()));
+        TestTrue(TEXT("Append written"), Cache.Flush());
+    }
+
+    {
+        FDAGenerationCache Reopened;
+        Reopened.Open(Path);
+        TestEqual(TEXT("Both entries reloaded"), Reopened.Num(), 2);
+        const TConstArrayView<uint8> Loaded = Reopened.Find(A);
+        TestTrue(TEXT("Payload round-trips"), Loaded.Num() == PayloadA.Num() && FMemory::Memcmp(Loaded.GetData(), PayloadA.GetData(), PayloadA.Num()) == 0);
+        TestEqual(TEXT("Missing keys find nothing"), Reopened.Find(A ^ B).Num(), 0);
+    }
+
+    // A partial trailing record is dropped on open
+    TArray<uint8> Truncated;
+    FFileHelper::LoadFileToArray(Truncated, *Path);
+    Truncated.SetNum(Truncated.Num() - 1);
+    FFileHelper::SaveArrayToFile(Truncated, *Path);
+    {
+        FDAGenerationCache Recovered;
+        Recovered.Open(Path);
+        TestEqual(TEXT("Complete records survive truncation"), Recovered.Num(), 1);
+        TestEqual(TEXT("The truncated record is gone"), Recovered.Find(B).Num(), 0);
+    }
+
+    // Stores over the size limit are discarded
+    {
+        FDAGenerationCache Limited;
+        Limited.Open(Path, 4);
+        TestEqual(TEXT("Oversized store discarded"), Limited.Num(), 0);
+    }
+
+    // Adding past the size limit starts the store over instead of growing it
+    IFileManager::Get().Delete(*Path);
+    {
+        const int64 RecordBytes = sizeof(uint64) + sizeof(int32) + PayloadA.Num();
+        const int64 Limit = sizeof(uint32) * 2 + RecordBytes * 2;
+        FDAGenerationCache Bounded;
+        Bounded.Open(Path, Limit);
+        TestTrue(TEXT("First record fits"), Bounded.Add(A, PayloadA));
+        TestTrue(TEXT("Second record fits"), Bounded.Add(B, PayloadA));
+        TestTrue(TEXT("Store is at its limit"), Bounded.GetNumBytes() == Limit);
+
+        const TArray<uint8> KeyC = { 1, 2, 5 };
+        const uint64 C = FDAGenerationCache::MakeKey(KeyC);
+        TestTrue(TEXT("A third record is stored after starting over"), Bounded.Add(C, PayloadA));
+        TestEqual(TEXT("Older entries were dropped"), Bounded.Num(), 1);
+        TestTrue(TEXT("Store stays within its limit"), Bounded.GetNumBytes() <= Limit);
+
+        TArray<uint8> Huge;
+        Huge.SetNumZeroed(static_cast<int32>(Limit));
+        TestFalse(TEXT("A payload larger than the limit is refused"), Bounded.Add(A ^ B, Huge));
+        TestEqual(TEXT("Refusing keeps existing entries"), Bounded.Num(), 1);
+
+        TestTrue(TEXT("Restarted store written"), Bounded.Flush());
+        TestTrue(TEXT("File matches the bounded image"), IFileManager::Get().FileSize(*Path) == Bounded.GetNumBytes());
+    }
+
+    IFileManager::Get().Delete(*Path);
+    return true;
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the batched settlement production simulator
+
+#include "Misc/AutomationTest.h"
+#include "Core/DAProductionBatch.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDAProductionBatchTest, "DarkAge.Economy.ProductionBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDAProductionBatchTest::RunTest(const FString& Parameters)
+{
+    FDAProductionBatch Batch;
+
+    // Mining needs no inputs; smelting turns two ore into one ingot
+    const int32 Mine = Batch.AddRecipe(TEXT("MineOre"), {}, TEXT("Ore"), 1, 5.0f);
+    const TPair<FName, int32> SmeltInputs[] = { TPair<FName, int32>(TEXT("Ore"), 2) };
+    const int32 Smelt = Batch.AddRecipe(TEXT("SmeltIron"), SmeltInputs, TEXT("Ingot"), 1, 10.0f);
+    TestTrue(TEXT("Recipes registered"), Mine != INDEX_NONE && Smelt != INDEX_NONE);
+    TestEqual(TEXT("Duplicate recipe IDs are rejected"), Batch.AddRecipe(TEXT("MineOre"), {}, TEXT("Ore"), 1, 5.0f), static_cast<int32>(INDEX_NONE));
+
+    const int32 Ore = Batch.FindItem(TEXT("Ore"));
+    const int32 Ingot = Batch.FindItem(TEXT("Ingot"));
+
+    const int32 Town = Batch.AddSettlement(TEXT("Town"), TEXT("Lowlands"));
+    Batch.SetWorkers(Town, Mine, 3);
+    Batch.SetWorkers(Town, Smelt, 1);
+
+    // Three miners make six ore in ten seconds; the smelter then uses two of them in the same step
+    Batch.Step(10.0f);
+    TestEqual(TEXT("Ore left after smelting"), Batch.GetStock(Town, Ore), 4);
+    TestEqual(TEXT("One ingot smelted"), Batch.GetStock(Town, Ingot), 1);
+
+    TArray<FDAProductionBatch::FStockChange> Changes;
+    Batch.GetStockChanges(Changes);
+    TestEqual(TEXT("Net change per item"), Changes.Num(), 2);
+
+    // Enough settlements to widen the columns; earlier stock must survive
+    int32 Forge = INDEX_NONE;
+    for (int32 i = 0; i < 10; ++i)
+    {
+        Forge = Batch.AddSettlement(FName(*FString::Printf(TEXT("Village%d"), i)), TEXT("Highlands"));
+    }
+    TestEqual(TEXT("Stock survives widening"), Batch.GetStock(Town, Ingot), 1);
+    TestEqual(TEXT("Workers survive widening"), Batch.GetWorkers(Town, Mine), 3);
+
+    // A starved smelter doesn't bank idle time
+    Batch.SetWorkers(Forge, Smelt, 1);
+    Batch.Step(30.0f);
+    TestEqual(TEXT("Nothing smelted without ore"), Batch.GetStock(Forge, Ingot), 0);
+    Batch.AddStock(Forge, Ore, 10);
+    Batch.Step(10.0f);
+    TestEqual(TEXT("Only one backlogged run is kept"), Batch.GetStock(Forge, Ingot), 2);
+    TestEqual(TEXT("Ore consumed"), Batch.GetStock(Forge, Ore), 6);
+
+    // Half of all runs succeed; partial output carries over between steps
+    const int32 Forage = Batch.AddRecipe(TEXT("ForageHerbs"), {}, TEXT("Herbs"), 1, 10.0f, 0.5f);
+    Batch.SetWorkers(Town, Forage, 1);
+    Batch.Step(10.0f);
+    Batch.Step(10.0f);
+    Batch.Step(10.0f);
+    Batch.Step(10.0f);
+    TestEqual(TEXT("Yield applied across steps"), Batch.GetStock(Town, Batch.FindItem(TEXT("Herbs"))), 2);
+
+    return true;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the shared dialogue tree registry
+
+#include "Misc/AutomationTest.h"
+#include "Core/DialogueTreeRegistry.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDialogueTreeRegistryTest, "DarkAge.Dialogue.TreeRegistry", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDialogueTreeRegistryTest::RunTest(const FString& Parameters)
+{
+    UDialogueTreeRegistry* Registry = NewObject<UDialogueTreeRegistry>();
+
+    FDialogueTree Tree;
+    Tree.TreeID = TEXT("Blacksmith");
+    FDialogueLine Line;
+    Line.Text = TEXT("Need something forged?");
+    Line.Responses = { TEXT("Show me your wares."), TEXT("Goodbye. [END]") };
+    Tree.Lines.Add(Line);
+    Tree.Conditions.Add(TEXT("HasQuest"), TEXT("BlacksmithQuest"));
+
+    // Two NPCs registering the same content share one compiled tree
+    const FDialogueTreeHandle First = Registry->RegisterTree(Tree);
+    const FDialogueTreeHandle Second = Registry->RegisterTree(Tree);
+    TestTrue(TEXT("Tree compiled"), First.IsValid());
+    TestTrue(TEXT("Identical trees share a handle"), First == Second);
+    TestEqual(TEXT("Only one tree stored"), Registry->GetNumTrees(), 1);
+
+    // Different content gets its own tree, but repeated strings are interned once
+    const int32 StringsBefore = Registry->GetNumUniqueStrings();
+    Tree.Lines[0].Text = TEXT("The forge is cold today.");
+    const FDialogueTreeHandle Variant = Registry->RegisterTree(Tree);
+    TestTrue(TEXT("Different content compiles separately"), Variant != First);
+    TestEqual(TEXT("Only the new line text was added to the pool"), Registry->GetNumUniqueStrings(), StringsBefore + 1);
+
+    FDialogueLine Output;
+    Registry->GetLine(First, 0, Output);
+    TestEqual(TEXT("Line text round-trips"), Output.Text, FString(TEXT("Need something forged?")));
+    TestEqual(TEXT("Responses round-trip"), Output.Responses.Num(), 2);
+    TestFalse(TEXT("Ordinary responses continue"), Registry->DoesResponseEndDialogue(First, 0, 0));
+    TestTrue(TEXT("[END] responses end the dialogue"), Registry->DoesResponseEndDialogue(First, 0, 1));
+
+    TestEqual(TEXT("Branches compiled"), Registry->GetBranches(First).Num(), 1);
+    TestEqual(TEXT("Branch target kept"), Registry->GetBranches(First)[0].NextTreeID, FName(TEXT("BlacksmithQuest")));
+
+    // Strings that differ only in case are distinct lines, and trees built from them stay distinct
+    const int32 StringsBeforeCase = Registry->GetNumUniqueStrings();
+    Tree.Lines[0].Text = TEXT("THE FORGE IS COLD TODAY.");
+    const FDialogueTreeHandle Shouted = Registry->RegisterTree(Tree);
+    TestEqual(TEXT("Case variants are interned separately"), Registry->GetNumUniqueStrings(), StringsBeforeCase + 1);
+    TestTrue(TEXT("Case variants compile separately"), Shouted != Variant);
+    Registry->GetLine(Shouted, 0, Output);
+    TestEqual(TEXT("Case variant text round-trips"), Output.Text, FString(TEXT("THE FORGE IS COLD TODAY.")));
+    Tree.Lines[0].Text = TEXT("The forge is cold today.");
+
+    Registry->RegisterSharedTree(Tree);
+    TestTrue(TEXT("Shared trees are found by ID"), Registry->FindSharedTree(FName(TEXT("Blacksmith"))) == Variant);
+    TestFalse(TEXT("Unknown IDs are not found"), Registry->FindSharedTree(FName(TEXT("Missing"))).IsValid());
+
+    return true;
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the environmental factors component's thermal bands
+
+#include "Misc/AutomationTest.h"
+#include "Core/EnvironmentalFactorsComponent.h"
+#include "Core/WeatherSystem.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnvironmentalFactorsThermalTest, "DarkAge.Environment.ThermalState", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FEnvironmentalFactorsThermalTest::RunTest(const FString& Parameters)
+{
+    UEnvironmentalFactorsComponent* Component = NewObject<UEnvironmentalFactorsComponent>();
+
+    FEnvironmentalFactors Factors;
+    const auto PushTemperature = [Component, &Factors](float Temperature)
+    {
+        Factors.AirTemperature = Temperature;
+        Component->UpdateEnvironmentalFactors(Factors);
+        return Component->GetThermalState();
+    };
+
+    // The weather system's default is a comfortable day, not a heat wave
+    TestTrue(TEXT("Default weather temperature is neutral"), PushTemperature(UWeatherSystem::DefaultTemperature) == EThermalState::Neutral);
+
+    TestTrue(TEXT("Below the cold threshold"), PushTemperature(Component->ColdThreshold - 1.0f) == EThermalState::Cold);
+    TestTrue(TEXT("Cold holds inside the hysteresis margin"), PushTemperature(Component->ColdThreshold + Component->TemperatureHysteresis * 0.5f) == EThermalState::Cold);
+    TestTrue(TEXT("Cold clears past the margin"), PushTemperature(Component->ColdThreshold + Component->TemperatureHysteresis + 1.0f) == EThermalState::Neutral);
+
+    TestTrue(TEXT("Above the hot threshold"), PushTemperature(Component->HotThreshold + 1.0f) == EThermalState::Hot);
+    TestTrue(TEXT("Hot holds inside the hysteresis margin"), PushTemperature(Component->HotThreshold - Component->TemperatureHysteresis * 0.5f) == EThermalState::Hot);
+    TestTrue(TEXT("Back to the default temperature"), PushTemperature(UWeatherSystem::DefaultTemperature) == EThermalState::Neutral);
+
+    return true;
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the indexed quest catalog
+
+#include "Misc/AutomationTest.h"
+#include "Core/QuestCatalog.h"
+#include "Engine/DataTable.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestCatalogIndexTest, "DarkAge.Quest.CatalogIndices", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestCatalogIndexTest::RunTest(const FString& Parameters)
+{
+    UDataTable* QuestTable = NewObject<UDataTable>();
+    QuestTable->RowStruct = FQuestData::StaticStruct();
+
+    FQuestData Hunt;
+    Hunt.QuestType = EQuestType::Combat;
+    Hunt.QuestGiver = FName("Huntsman");
+    Hunt.RegionID = FName("Forest");
+    Hunt.Tags = { FName("Wolves"), FName("Bounty") };
+    FQuestStageEntry HuntStage;
+    HuntStage.StageID = FName("Track");
+    FQuestBranch ToReport;
+    ToReport.NextStageID = FName("Report");
+    HuntStage.Stage.Branches.Add(ToReport);
+    Hunt.Stages.Add(HuntStage);
+    QuestTable->AddRow(FName("Q_Hunt"), Hunt);
+
+    FQuestData Herbs;
+    Herbs.QuestType = EQuestType::QT_Task;
+    Herbs.QuestGiver = FName("Healer");
+    Herbs.RegionID = FName("Forest");
+    Herbs.Tags = { FName("Gathering") };
+    QuestTable->AddRow(FName("Q_Herbs"), Herbs);
+
+    FQuestCatalog Catalog;
+    Catalog.Build(QuestTable);
+
+    TestEqual(TEXT("Every row is indexed"), Catalog.Num(), 2);
+    TestTrue(TEXT("Catalog remembers its source table"), Catalog.IsBuiltFrom(QuestTable));
+
+    const int32 HuntIndex = Catalog.FindQuestIndex(FName("Q_Hunt"));
+    TestTrue(TEXT("Quest lookup by ID"), HuntIndex != INDEX_NONE);
+    TestEqual(TEXT("Rows are read in place"), Catalog.GetQuestData(HuntIndex).QuestGiver, FName("Huntsman"));
+    TestEqual(TEXT("Unknown quests are absent"), Catalog.FindQuestIndex(FName("Q_Missing")), INDEX_NONE);
+
+    TestEqual(TEXT("Region index"), Catalog.GetQuestsInRegion(FName("Forest")).Num(), 2);
+    TestEqual(TEXT("Giver index"), Catalog.GetQuestsFromGiver(FName("Healer")).Num(), 1);
+    TestEqual(TEXT("Type index"), Catalog.GetQuestsByType(EQuestType::Combat).Num(), 1);
+    TestEqual(TEXT("Tag index"), Catalog.GetQuestsByTag(FName("Bounty")).Num(), 1);
+    TestEqual(TEXT("Missing keys give an empty span"), Catalog.GetQuestsInRegion(FName("Swamp")).Num(), 0);
+    TestFalse(TEXT("Quests without required items skip the prerequisite check"), Catalog.HasPrerequisites(HuntIndex));
+
+    TConstArrayView<FQuestCatalog::FStageBranch> Branches;
+    TestTrue(TEXT("Stage branches are compiled"), Catalog.FindStageBranches(HuntIndex, FName("Track"), Branches));
+    TestTrue(TEXT("Unconditional branch passes"), Branches.Num() == 1 && Catalog.GetConditions().Evaluate(Branches[0].Clause, FDAConditionContext()));
+    TestFalse(TEXT("Unknown stages have no branches"), Catalog.FindStageBranches(HuntIndex, FName("Missing"), Branches));
+
+    return true;
+}
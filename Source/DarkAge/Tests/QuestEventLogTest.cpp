@@ -0,0 +1,80 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the bounded quest event log
+
+#include "Misc/AutomationTest.h"
+#include "Core/QuestEventLog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestEventLogTest, "DarkAge.Quest.EventLog", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestEventLogTest::RunTest(const FString& Parameters)
+{
+    // Two segments of four entries: at most eight events stay in memory
+    FQuestEventLog Log(4, 2);
+
+    for (int32 i = 0; i < 10; ++i)
+    {
+        FQuestEventLogEntry Entry;
+        Entry.QuestID = (i % 2 == 0) ? TEXT("Q_Even") : TEXT("Q_Odd");
+        Entry.EventType = (i == 9) ? EQuestEventType::Completed : EQuestEventType::Accepted;
+        Entry.Timestamp = static_cast<float>(i);
+        Log.Add(MoveTemp(Entry));
+    }
+
+    TestEqual(TEXT("Only the newest segments stay resident"), Log.NumResident(), 6);
+    TestEqual(TEXT("The oldest segment was evicted"), Log.NumSpilled(), static_cast<int64>(4));
+
+    TestEqual(TEXT("Counts include evicted events"), Log.GetCount(TEXT(""), EQuestEventType::Accepted), 9);
+    TestEqual(TEXT("Per-quest counts"), Log.GetCount(TEXT("Q_Even"), EQuestEventType::Accepted), 5);
+    TestEqual(TEXT("Per-quest counts by type"), Log.GetCount(TEXT("Q_Odd"), EQuestEventType::Completed), 1);
+    TestEqual(TEXT("Unknown quests count zero"), Log.GetCount(TEXT("Q_Missing"), EQuestEventType::Accepted), 0);
+
+    TArray<FQuestEventLogEntry> Results;
+    Log.Query(TEXT("Q_Even"), EQuestEventType::Accepted, 2, Results);
+    TestEqual(TEXT("Query honours the result limit"), Results.Num(), 2);
+    TestTrue(TEXT("Query returns newest first"), Results.Num() == 2 && Results[0].Timestamp == 8.0f && Results[1].Timestamp == 6.0f);
+
+    Results.Reset();
+    Log.Query(TEXT(""), EQuestEventType::Completed, 50, Results);
+    TestEqual(TEXT("Type index finds the completion"), Results.Num(), 1);
+
+    // Forgetting a quest drops only its own counts
+    Log.ForgetQuest(TEXT("Q_Even"));
+    TestEqual(TEXT("Forgotten quests count zero"), Log.GetCount(TEXT("Q_Even"), EQuestEventType::Accepted), 0);
+    TestEqual(TEXT("Totals keep forgotten quests"), Log.GetCount(TEXT(""), EQuestEventType::Accepted), 9);
+    TestEqual(TEXT("Other quests keep their counts"), Log.GetCount(TEXT("Q_Odd"), EQuestEventType::Completed), 1);
+
+    Log.Reset();
+    TestEqual(TEXT("Reset clears resident events"), Log.NumResident(), 0);
+    TestEqual(TEXT("Reset clears counts"), Log.GetCount(TEXT(""), EQuestEventType::Accepted), 0);
+
+    // Rotation keeps the newest MaxBackups sessions
+    IFileManager& FileManager = IFileManager::Get();
+    const FString SpillPath = FPaths::AutomationTransientDir() / TEXT("QuestEventsTest.log");
+    const FString FirstBackup = FPaths::AutomationTransientDir() / TEXT("QuestEventsTest_1.log");
+    const FString SecondBackup = FPaths::AutomationTransientDir() / TEXT("QuestEventsTest_2.log");
+    for (const FString& Path : { SpillPath, FirstBackup, SecondBackup })
+    {
+        FileManager.Delete(*Path);
+    }
+
+    for (const TCHAR* Session : { TEXT("First"), TEXT("Second"), TEXT("Third") })
+    {
+        FQuestEventLog::RotateSpillFile(SpillPath, 1);
+        FFileHelper::SaveStringToFile(Session, *SpillPath);
+    }
+
+    FString Contents;
+    TestTrue(TEXT("Current session is written fresh"), FFileHelper::LoadFileToString(Contents, *SpillPath) && Contents == TEXT("Third"));
+    TestTrue(TEXT("Previous session is kept"), FFileHelper::LoadFileToString(Contents, *FirstBackup) && Contents == TEXT("Second"));
+    TestFalse(TEXT("Backups past the limit are deleted"), FileManager.FileExists(*SecondBackup));
+
+    for (const FString& Path : { SpillPath, FirstBackup, SecondBackup })
+    {
+        FileManager.Delete(*Path);
+    }
+
+    return true;
+}
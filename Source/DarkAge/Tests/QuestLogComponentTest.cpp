@@ -0,0 +1,38 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for quest log replacement events
+
+#include "Misc/AutomationTest.h"
+#include "Components/DAQuestLogComponent.h"
+#include "QuestLogTestListener.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestLogReplaceTest, "DarkAge.Quest.LogReplace", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestLogReplaceTest::RunTest(const FString& Parameters)
+{
+    UDAQuestLogComponent* QuestLog = NewObject<UDAQuestLogComponent>();
+    FQuestData Hunt;
+    QuestLog->AddOrUpdateQuest(FName("Q_Hunt"), Hunt);
+
+    // Quest availability is kept current from these events, so a loaded log must send them too
+    UQuestLogTestListener* Listener = NewObject<UQuestLogTestListener>();
+    QuestLog->OnQuestStateChanged.AddDynamic(Listener, &UQuestLogTestListener::OnQuestStateChanged);
+
+    TArray<FQuestLogEntry> LoadedLog;
+    FQuestLogEntry Herbs;
+    Herbs.QuestID = FName("Q_Herbs");
+    Herbs.QuestState = EQuestState::QS_Completed;
+    LoadedLog.Add(Herbs);
+    QuestLog->SetQuestLog(LoadedLog);
+
+    TestTrue(TEXT("Loaded quest state"), QuestLog->GetQuestState(FName("Q_Herbs")) == EQuestState::QS_Completed);
+    TestTrue(TEXT("Loaded quests are broadcast"), Listener->LastStates.FindRef(FName("Q_Herbs")) == EQuestState::QS_Completed);
+    TestTrue(TEXT("Dropped quests are broadcast as not started"), Listener->LastStates.Contains(FName("Q_Hunt")) && Listener->LastStates.FindRef(FName("Q_Hunt")) == EQuestState::QS_NotStarted);
+
+    // Reloading the same log is safe and reports the same states
+    Listener->LastStates.Reset();
+    QuestLog->SetQuestLog(QuestLog->GetQuestLog());
+    TestEqual(TEXT("Self-assignment keeps the log"), QuestLog->GetQuestLog().Num(), 1);
+    TestEqual(TEXT("Only the logged quest is broadcast"), Listener->LastStates.Num(), 1);
+
+    return true;
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2025 RaioCore
+// Helper UObject for quest log test delegate binding
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Data/QuestData.h"
+#include "QuestLogTestListener.generated.h"
+
+UCLASS()
+class UQuestLogTestListener : public UObject
+{
+    GENERATED_BODY()
+public:
+    TMap<FName, EQuestState> LastStates;
+
+    UFUNCTION()
+    void OnQuestStateChanged(FName QuestID, EQuestState NewState) { LastStates.Add(QuestID, NewState); }
+};
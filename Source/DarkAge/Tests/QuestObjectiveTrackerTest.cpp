@@ -0,0 +1,114 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for event-driven quest objective tracking
+
+#include "Misc/AutomationTest.h"
+#include "Core/QuestObjectiveTrackerSubsystem.h"
+#include "Core/DynamicQuestSubsystem.h"
+#include "Core/GlobalEventBus.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestObjectiveTrackerTest, "DarkAge.Quest.ObjectiveTracker", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestObjectiveTrackerTest::RunTest(const FString& Parameters)
+{
+    UQuestObjectiveTrackerSubsystem* Tracker = NewObject<UQuestObjectiveTrackerSubsystem>();
+    UObject* Owner = NewObject<UObject>();
+
+    int32 WolfKills = 0;
+    int32 AnyKills = 0;
+    FQuestTrackingHandle WolfWatch = Tracker->WatchObjective(Owner, EObjectiveType::Kill, FName("Wolves"), [&WolfKills](int32 Amount) { WolfKills += Amount; });
+    Tracker->WatchObjective(Owner, EObjectiveType::Kill, NAME_None, [&AnyKills](int32 Amount) { AnyKills += Amount; });
+
+    // Only watches for the reported pair (and the untargeted watch of that type) run
+    Tracker->ReportObjectiveEvent(EObjectiveType::Kill, FName("Wolves"), 2);
+    Tracker->ReportObjectiveEvent(EObjectiveType::Kill, FName("Bandits"));
+    Tracker->ReportObjectiveEvent(EObjectiveType::Collect, FName("Wolves"));
+    TestEqual(TEXT("Targeted watch sees its target only"), WolfKills, 2);
+    TestEqual(TEXT("Untargeted watch sees every kill"), AnyKills, 3);
+
+    Tracker->Cancel(WolfWatch);
+    Tracker->ReportObjectiveEvent(EObjectiveType::Kill, FName("Wolves"));
+    TestEqual(TEXT("Cancelled watches stop receiving events"), WolfKills, 2);
+    TestFalse(TEXT("Cancel invalidates the handle"), WolfWatch.IsValid());
+
+    // Deadlines fire in order once their time has passed, and the tracker idles afterwards
+    TArray<int32> Fired;
+    Tracker->ScheduleDeadline(Owner, 5.0f, [&Fired]() { Fired.Add(5); });
+    Tracker->ScheduleDeadline(Owner, 1.0f, [&Fired]() { Fired.Add(1); });
+    FQuestTrackingHandle Cancelled = Tracker->ScheduleDeadline(Owner, 2.0f, [&Fired]() { Fired.Add(2); });
+    Tracker->Cancel(Cancelled);
+
+    TestTrue(TEXT("Tracker ticks while deadlines are pending"), Tracker->IsTickable());
+    Tracker->Tick(1.5f);
+    TestEqual(TEXT("Only the due deadline fired"), Fired.Num(), 1);
+    Tracker->Tick(4.0f);
+    TestEqual(TEXT("Both live deadlines fired"), Fired.Num(), 2);
+    TestTrue(TEXT("Deadlines fire earliest first"), Fired.Num() == 2 && Fired[0] == 1 && Fired[1] == 5);
+    TestFalse(TEXT("Tracker stops ticking with no deadlines"), Tracker->IsTickable());
+
+    FQuestObjective Objective;
+    Objective.RequiredCount = 3;
+    TestFalse(TEXT("Partial progress does not complete"), UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(Objective, 2));
+    TestTrue(TEXT("Reaching the count completes"), UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(Objective, 5));
+    TestEqual(TEXT("Progress is clamped"), Objective.CurrentCount, 3);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestObjectiveBusEventsTest, "DarkAge.Quest.ObjectiveTracker.BusEvents", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestObjectiveBusEventsTest::RunTest(const FString& Parameters)
+{
+    UGlobalEventBus* EventBus = NewObject<UGlobalEventBus>();
+    UQuestObjectiveTrackerSubsystem* Tracker = NewObject<UQuestObjectiveTrackerSubsystem>();
+    Tracker->BindEventBus(EventBus);
+    UObject* Owner = NewObject<UObject>();
+
+    FDynamicQuest Quest;
+    FQuestObjective Hunt;
+    Hunt.ObjectiveType = EObjectiveType::Kill;
+    Hunt.TargetEnemy = TEXT("Wolves");
+    Hunt.RequiredCount = 2;
+    Quest.Objectives.Add(Hunt);
+    FQuestObjective Scout;
+    Scout.ObjectiveType = EObjectiveType::Investigate;
+    Scout.TargetLocation = TEXT("Millbrook");
+    Scout.RequiredCount = 1;
+    Quest.Objectives.Add(Scout);
+
+    for (int32 ObjectiveIndex = 0; ObjectiveIndex < Quest.Objectives.Num(); ++ObjectiveIndex)
+    {
+        Tracker->WatchObjective(Owner, Quest.Objectives[ObjectiveIndex].ObjectiveType, UQuestObjectiveTrackerSubsystem::GetObjectiveTarget(Quest.Objectives[ObjectiveIndex]),
+            [&Quest, ObjectiveIndex](int32 Amount)
+            {
+                UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(Quest.Objectives[ObjectiveIndex], Amount);
+            });
+    }
+
+    // The same events UStatlineComponent and UWorldInteractionComponent broadcast
+    auto BroadcastDeath = [EventBus](const FString& NPCName, const FString& EnemyType)
+    {
+        TMap<FString, FString> EventData;
+        EventData.Add(TEXT("EnemyType"), EnemyType);
+        EventBus->BroadcastSimpleEvent(EGlobalEventType::NPCDied, NPCName, NPCName, EventData, EEventPriority::Normal, true);
+    };
+
+    BroadcastDeath(TEXT("Bandit_1"), TEXT("Bandits"));
+    TestEqual(TEXT("Other enemy types don't count"), Quest.Objectives[0].CurrentCount, 0);
+    BroadcastDeath(TEXT("Wolf_1"), TEXT("Wolves"));
+    BroadcastDeath(TEXT("Wolf_2"), TEXT("Wolves"));
+    TestTrue(TEXT("Kills complete the hunt"), Quest.Objectives[0].bIsCompleted);
+    TestFalse(TEXT("Arrival is still open"), Quest.Objectives[1].bIsCompleted);
+
+    EventBus->BroadcastSimpleEventNoData(EGlobalEventType::PlayerEnteredRegion, TEXT("Player"), TEXT("Millbrook"), EEventPriority::Normal, true);
+    TestTrue(TEXT("Entering the region completes the quest"), Quest.Objectives[0].bIsCompleted && Quest.Objectives[1].bIsCompleted);
+
+    // Once unbound, the bus no longer reaches the tracker
+    FQuestObjective Cull;
+    Cull.RequiredCount = 1;
+    Tracker->WatchObjective(Owner, EObjectiveType::Kill, NAME_None, [&Cull](int32 Amount) { UQuestObjectiveTrackerSubsystem::ApplyObjectiveProgress(Cull, Amount); });
+    Tracker->BindEventBus(nullptr);
+    BroadcastDeath(TEXT("Wolf_3"), TEXT("Wolves"));
+    TestFalse(TEXT("Unbound tracker ignores the bus"), Cull.bIsCompleted);
+
+    return true;
+}
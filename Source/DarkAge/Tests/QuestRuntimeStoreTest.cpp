@@ -0,0 +1,64 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for the quest runtime's slot map storage
+
+#include "Misc/AutomationTest.h"
+#include "Core/QuestRuntimeStore.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQuestRuntimeStoreTest, "DarkAge.Quest.RuntimeStore", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FQuestRuntimeStoreTest::RunTest(const FString& Parameters)
+{
+    FQuestRuntimeStore Store;
+
+    FDynamicQuest Hunt;
+    Hunt.QuestID = TEXT("1");
+    Hunt.QuestName = TEXT("Hunt");
+    FDynamicQuest Supply;
+    Supply.QuestID = TEXT("2");
+    Supply.QuestName = TEXT("Supply");
+
+    const FQuestRuntimeHandle HuntHandle = Store.Add(EQuestRuntimeSource::Generated, Hunt, 30.0f);
+    const FQuestRuntimeHandle SupplyHandle = Store.Add(EQuestRuntimeSource::Generated, Supply);
+    TestTrue(TEXT("Handles are valid"), HuntHandle.IsValid() && SupplyHandle.IsValid());
+    TestFalse(TEXT("Duplicate IDs within a source are rejected"), Store.Add(EQuestRuntimeSource::Generated, Hunt).IsValid());
+
+    // Sources have separate ID spaces
+    const FQuestRuntimeHandle DynamicHunt = Store.Add(EQuestRuntimeSource::Dynamic, Hunt);
+    TestTrue(TEXT("Same ID in another source"), DynamicHunt.IsValid());
+    TestEqual(TEXT("Generated quests"), Store.Num(EQuestRuntimeSource::Generated), 2);
+    TestEqual(TEXT("All quests"), Store.Num(), 3);
+
+    TestTrue(TEXT("Lookup by ID"), Store.FindHandle(EQuestRuntimeSource::Generated, TEXT("2")) == SupplyHandle);
+    const FQuestRuntimeRecord* HuntRecord = Store.Find(HuntHandle);
+    TestTrue(TEXT("Record found"), HuntRecord && HuntRecord->Quest.QuestName == TEXT("Hunt") && HuntRecord->FinishedRetention == 30.0f);
+
+    // Removing the first record moves the last one into its place
+    TestTrue(TEXT("Removed"), Store.Remove(HuntHandle));
+    TestFalse(TEXT("Removed twice"), Store.Remove(HuntHandle));
+    TestNull(TEXT("Removed handle finds nothing"), Store.Find(HuntHandle));
+    TestFalse(TEXT("Removed ID is unindexed"), Store.FindHandle(EQuestRuntimeSource::Generated, TEXT("1")).IsValid());
+    const FQuestRuntimeRecord* DynamicRecord = Store.Find(DynamicHunt);
+    TestTrue(TEXT("Moved record is still reachable"), DynamicRecord && DynamicRecord->Source == EQuestRuntimeSource::Dynamic);
+
+    // The freed slot is reused with a new generation
+    FDynamicQuest Escort;
+    Escort.QuestID = TEXT("3");
+    const FQuestRuntimeHandle EscortHandle = Store.Add(EQuestRuntimeSource::Generated, Escort);
+    TestEqual(TEXT("Slot reused"), EscortHandle.Index, HuntHandle.Index);
+    TestNull(TEXT("Stale handle stays invalid"), Store.Find(HuntHandle));
+    TestTrue(TEXT("New handle finds the new quest"), Store.Find(EscortHandle) && Store.Find(EscortHandle)->Quest.QuestID == TEXT("3"));
+
+    // Packed records map back to their handles
+    bool bHandlesMatch = true;
+    for (int32 RecordIndex = 0; RecordIndex < Store.Num(); ++RecordIndex)
+    {
+        bHandlesMatch &= Store.Find(Store.GetHandle(RecordIndex)) == &Store.GetRecords()[RecordIndex];
+    }
+    TestTrue(TEXT("Packed records map to their handles"), bHandlesMatch);
+
+    Store.Reset();
+    TestEqual(TEXT("Reset empties the store"), Store.Num(), 0);
+    TestNull(TEXT("Handles from before a reset are invalid"), Store.Find(SupplyHandle));
+
+    return true;
+}
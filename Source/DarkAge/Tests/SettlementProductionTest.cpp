@@ -0,0 +1,53 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for settlement production feeding the regional economy
+
+#include "Misc/AutomationTest.h"
+#include "Core/SettlementProductionSubsystem.h"
+#include "Core/EconomySubsystem.h"
+#include "Engine/GameInstance.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSettlementProductionEconomyTest, "DarkAge.Economy.SettlementProduction", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSettlementProductionEconomyTest::RunTest(const FString& Parameters)
+{
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+    UEconomySubsystem* Economy = NewObject<UEconomySubsystem>(GameInstance);
+    USettlementProductionSubsystem* Production = NewObject<USettlementProductionSubsystem>(GameInstance);
+
+    // Use the shipped config: farmers must gather something without any inputs
+    const FName* FarmRecipe = Production->ProfessionRecipes.Find(ENPCProfession::Farmer);
+    TestNotNull(TEXT("Farmers have a default recipe"), FarmRecipe);
+    const FSettlementExtractionRecipe* Extraction = FarmRecipe
+        ? Production->ExtractionRecipes.FindByPredicate([FarmRecipe](const FSettlementExtractionRecipe& Recipe) { return Recipe.RecipeID == *FarmRecipe; })
+        : nullptr;
+    TestNotNull(TEXT("The farmers' recipe is an extraction recipe"), Extraction);
+    if (!Extraction)
+    {
+        return false;
+    }
+
+    Production->BindEconomy(Economy);
+    for (const FSettlementExtractionRecipe& Recipe : Production->ExtractionRecipes)
+    {
+        Production->AddExtractionRecipe(Recipe);
+    }
+
+    const FName Region = TEXT("TestRegion");
+    Economy->RegisterItem(Region, Extraction->OutputItemID, 2.0f);
+
+    // A fresh settlement: no stock, just residents
+    const FName Settlement = TEXT("TestHamlet");
+    Production->RegisterSettlement(Settlement, Region);
+    TMap<ENPCProfession, int32> ProfessionCounts;
+    ProfessionCounts.Add(ENPCProfession::Farmer, 4);
+    Production->SetProfessionWorkers(Settlement, ProfessionCounts);
+
+    // Four farmers working one full cycle each
+    Production->SimulateStep(Extraction->CycleSeconds);
+
+    const int32 Expected = 4 * Extraction->OutputQuantity;
+    TestEqual(TEXT("Settlement stock holds the harvest"), Production->GetSettlementStock(Settlement, Extraction->OutputItemID), Expected);
+    TestEqual(TEXT("Harvest reaches the regional market"), Economy->GetItemSupply(Region, Extraction->OutputItemID), static_cast<float>(Expected));
+
+    return true;
+}
@@ -5,6 +5,10 @@
 #include "Misc/AutomationTest.h"
 #include "Components/StatlineComponent.h"
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "Engine/DataTable.h"
+#include "Core/DATimerWheelSubsystem.h"
+#include "Data/StatusEffectData.h"
 #include "StatlineComponentTestListener.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatlineComponentAdvancedTest, "DarkAge.Statline.Advanced", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
@@ -38,3 +42,99 @@ bool FStatlineComponentAdvancedTest::RunTest(const FString& Parameters)
 
     return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatlineComponentStatTableTest, "DarkAge.Statline.StatTable", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStatlineComponentStatTableTest::RunTest(const FString& Parameters)
+{
+    AActor* DummyActor = NewObject<AActor>();
+    UStatlineComponent* Statline = NewObject<UStatlineComponent>(DummyActor);
+    Statline->RegisterComponent();
+
+    TArray<FStatEntry> InitialStats;
+    InitialStats.Add(FStatEntry{FName("Thirst"), FStat(80.0f, 80.0f, EStatCategory::Survival)});
+    InitialStats.Add(FStatEntry{FName("Health"), FStat(100.0f, 100.0f, EStatCategory::Primary)});
+    InitialStats.Add(FStatEntry{FName("TestFocus"), FStat(50.0f, 50.0f, EStatCategory::Generic)});
+    Statline->SetStats(InitialStats);
+
+    // Index and name access agree regardless of the order stats were configured in
+    const int32 FocusIndex = FDAStatLayout::Get().FindStatIndex(FName("TestFocus"));
+    TestTrue(TEXT("Custom stat is registered in the layout"), FocusIndex != INDEX_NONE);
+    TestEqual(TEXT("Thirst by index"), Statline->GetCurrentStatValueByIndex(FDAStatLayout::Thirst), 80.0f);
+    TestEqual(TEXT("Custom stat by index"), Statline->GetCurrentStatValueByIndex(FocusIndex), 50.0f);
+    TestFalse(TEXT("Stats the component lacks are absent"), Statline->HasStat(FDAStatLayout::Mana));
+
+    TArray<int32> Dirty;
+    Statline->ConsumeDirtyStats(Dirty);
+    TestEqual(TEXT("SetStats marks every stat dirty"), Dirty.Num(), 3);
+
+    // A write bumps the version and only dirties the stat that changed
+    const uint32 VersionBefore = Statline->GetStatVersion();
+    Statline->UpdateStat(FName("Health"), -10.0f);
+    TestEqual(TEXT("Health updated by name"), Statline->GetCurrentStatValueByIndex(FDAStatLayout::Health), 90.0f);
+    TestTrue(TEXT("Version advanced"), Statline->GetStatVersion() > VersionBefore);
+
+    TArray<int32> Changed;
+    Statline->GetStatsChangedSince(VersionBefore, Changed);
+    TestEqual(TEXT("One stat changed since the previous version"), Changed.Num(), 1);
+    TestTrue(TEXT("Health is dirty"), Statline->IsStatDirty(FDAStatLayout::Health));
+    TestFalse(TEXT("Thirst is not dirty"), Statline->IsStatDirty(FDAStatLayout::Thirst));
+
+    // A write that clamps to the same value changes nothing
+    const uint32 VersionAfterWrite = Statline->GetStatVersion();
+    Statline->UpdateStatByIndex(FDAStatLayout::Thirst, 100.0f);
+    TestEqual(TEXT("Clamped no-op leaves the version alone"), Statline->GetStatVersion(), VersionAfterWrite);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatlineComponentEffectDurationTest, "DarkAge.Statline.EffectDuration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStatlineComponentEffectDurationTest::RunTest(const FString& Parameters)
+{
+    // Expiry runs on the world's timer wheel, so the component needs a real world
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    AActor* DummyActor = World->SpawnActor<AActor>();
+    UStatlineComponent* Statline = NewObject<UStatlineComponent>(DummyActor);
+    Statline->RegisterComponent();
+    UDATimerWheelSubsystem* TimerWheel = World->GetSubsystem<UDATimerWheelSubsystem>();
+
+    UDataTable* EffectTable = NewObject<UDataTable>();
+    EffectTable->RowStruct = FStatusEffectData::StaticStruct();
+
+    FStatusEffectData Lingering;
+    Lingering.EffectID = FName("Lingering");
+    Lingering.ApplicationMethod = EStatusEffectApplication::Persistent;
+    Lingering.BaseDuration = 0.0f;
+    Lingering.TickInterval = 0.0f;
+    EffectTable->AddRow(Lingering.EffectID, Lingering);
+
+    FStatusEffectData Timed = Lingering;
+    Timed.EffectID = FName("Timed");
+    Timed.BaseDuration = 1.0f;
+    EffectTable->AddRow(Timed.EffectID, Timed);
+
+    FDataTableRowHandle LingeringHandle;
+    LingeringHandle.DataTable = EffectTable;
+    LingeringHandle.RowName = Lingering.EffectID;
+    FDataTableRowHandle TimedHandle;
+    TimedHandle.DataTable = EffectTable;
+    TimedHandle.RowName = Timed.EffectID;
+
+    Statline->ApplyStatusEffect(LingeringHandle, DummyActor);
+    Statline->ApplyStatusEffect(TimedHandle, DummyActor);
+    TestEqual(TEXT("Both effects applied"), Statline->ActiveStatusEffects.Num(), 2);
+    TestFalse(TEXT("Zero-duration effect has no expiry timer"), Statline->ActiveStatusEffects[0].ExpiryTimer.IsValid());
+
+    // Past the timed effect's duration only the timed effect is removed
+    TimerWheel->Tick(2.0f);
+    TestEqual(TEXT("Zero-duration effect persists"), Statline->ActiveStatusEffects.Num(), 1);
+    TestTrue(TEXT("Remaining effect is the zero-duration one"),
+        Statline->ActiveStatusEffects.Num() == 1 && Statline->ActiveStatusEffects[0].EffectID == Lingering.EffectID);
+
+    Statline->RemoveStatusEffect(Lingering.EffectID);
+    TestEqual(TEXT("Zero-duration effect ends when removed"), Statline->ActiveStatusEffects.Num(), 0);
+
+    World->DestroyWorld(false);
+    return true;
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2025 RaioCore
+// Unit test for calendar event firing and pruning in the time system
+
+#include "Misc/AutomationTest.h"
+#include "Engine/GameInstance.h"
+#include "Core/TimeSystem.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimeSystemCalendarTest, "DarkAge.Core.TimeSystem.Calendar", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTimeSystemCalendarTest::RunTest(const FString& Parameters)
+{
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+    UTimeSystem* TimeSystem = NewObject<UTimeSystem>(GameInstance);
+
+    TimeSystem->SetCurrentDateTime(FGameDateTime(50, 1, 1, 8, 0));
+    TimeSystem->AddCalendarEvent(FGameDateTime(50, 1, 1, 8, 1), FName("Market"), TEXT("Morning market"));
+    TimeSystem->AddCalendarEvent(FGameDateTime(50, 1, 1, 8, 5), FName("Bell"), TEXT("Temple bell"));
+    TimeSystem->AddCalendarEvent(FGameDateTime(50, 1, 2, 9, 0), FName("Festival"), TEXT("Tomorrow's festival"));
+    TestEqual(TEXT("All events pending"), TimeSystem->GetNumCalendarEvents(), 3);
+
+    // One game minute per real second at normal scale
+    TimeSystem->UpdateTime(2.0f);
+    TestEqual(TEXT("The first event is removed once fired"), TimeSystem->GetNumCalendarEvents(), 2);
+
+    // Several events passed in one update are all removed
+    TimeSystem->UpdateTime(10.0f);
+    TestEqual(TEXT("Only the future event remains"), TimeSystem->GetNumCalendarEvents(), 1);
+    TestEqual(TEXT("The future event is still upcoming"), TimeSystem->GetUpcomingEvents(1).Num(), 1);
+
+    // Going back doesn't bring fired events back
+    TimeSystem->SetCurrentDateTime(FGameDateTime(50, 1, 1, 8, 0));
+    TimeSystem->UpdateTime(10.0f);
+    TestEqual(TEXT("Fired events are not replayed"), TimeSystem->GetNumCalendarEvents(), 1);
+
+    return true;
+}